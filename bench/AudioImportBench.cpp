@@ -0,0 +1,100 @@
+// ============================================================================
+//  File        : AudioImportBench.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-05
+//  Description : Disk, memory and open time of the raw WAV assets against
+//                their imported OGG / FLAC versions.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "AudioImporter.h"
+#include "Bench.h"
+#include <SFML/Audio.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+
+namespace
+{
+/// @brief Source WAVs, relative to the repository root.
+constexpr auto AUDIO_SOURCE_DIRECTORY = "assets/audio";
+
+/// @brief Timed opens per file, averaged.
+constexpr int OPEN_ITERATIONS = 10;
+
+/// @brief Mean time to open a file the way the game will play it: streamed for music, fully decoded for SFX.
+/// @param path file to open.
+/// @param isStreamed whether the file is music.
+/// @return mean milliseconds.
+double MeasureOpenMs(const std::string &path, bool isStreamed)
+{
+    return MeasureMs(OPEN_ITERATIONS,
+                     [&]()
+                     {
+                         if (isStreamed)
+                         {
+                             sf::Music music;
+                             music.openFromFile(path);
+                         }
+                         else
+                         {
+                             sf::SoundBuffer buffer;
+                             buffer.loadFromFile(path);
+                         }
+                     });
+}
+} // namespace
+
+/// @brief Imports a scratch copy of assets/audio and prints what the compressed formats save. The repository's own
+/// assets are never modified.
+CT_BENCH(AudioImportSavings)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path scratch = fs::temp_directory_path() / "ct_audio_import_bench";
+    std::error_code ec;
+
+    fs::remove_all(scratch, ec);
+    fs::create_directories(scratch, ec);
+
+    for (const auto &entry : fs::directory_iterator(AUDIO_SOURCE_DIRECTORY, ec))
+    {
+        if (entry.path().extension() == ".wav")
+        {
+            fs::copy_file(entry.path(), scratch / entry.path().filename(), ec);
+        }
+    }
+
+    const AudioImportReport report = AudioImporter::ImportDirectory(scratch.generic_string());
+
+    std::printf("%-16s %-9s %8s %11s %11s %7s %11s %11s %9s %9s\n", "file", "mode", "seconds", "wav bytes",
+                "out bytes", "disk %", "pcm bytes", "ram bytes", "wav ms", "out ms");
+
+    for (const auto &file : report.files)
+    {
+        if (!file.isOk)
+        {
+            std::printf("%-16s FAILED\n", fs::path(file.sourcePath).filename().string().c_str());
+            continue;
+        }
+
+        const double diskPercent = file.sourceBytes ? 100.0 * file.outputBytes / file.sourceBytes : 0.0;
+
+        std::printf("%-16s %-9s %8.2f %11zu %11zu %6.1f%% %11zu %11zu %9.3f %9.3f\n",
+                    fs::path(file.sourcePath).filename().string().c_str(), file.isStreamed ? "stream" : "memory",
+                    file.durationSeconds, file.sourceBytes, file.outputBytes, diskPercent, file.decodedBytes,
+                    file.residentBytes, MeasureOpenMs(file.sourcePath, file.isStreamed),
+                    MeasureOpenMs(file.outputPath, file.isStreamed));
+    }
+
+    std::printf("\nDisk: %zu -> %zu bytes (saved %zu)\n", report.sourceBytes, report.outputBytes,
+                report.sourceBytes - std::min(report.sourceBytes, report.outputBytes));
+    std::printf("RAM while playing, fully decoded vs streamed music: %zu -> %zu bytes (saved %zu)\n",
+                report.decodedBytes, report.residentBytes,
+                report.decodedBytes - std::min(report.decodedBytes, report.residentBytes));
+
+    fs::remove_all(scratch, ec);
+}
@@ -0,0 +1,95 @@
+// ============================================================================
+//  File        : AudioMixBench.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-20
+//  Description : Software mixer throughput, rendered offline with no audio
+//                device, in voices mixed per second of CPU time.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "AudioBus.h"
+#include "Bench.h"
+#include "SoftwareMixer.h"
+#include <SFML/Audio.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+/// @brief Rate of the synthetic voices and the mix.
+constexpr unsigned int SAMPLE_RATE = 48000;
+
+/// @brief Seconds of audio rendered per timed run; the voices last longer, so none ends mid run.
+constexpr std::size_t RENDER_SECONDS = 2;
+
+/// @brief Frames per Mix call, the chunk the mixer streams in.
+constexpr std::size_t BLOCK_FRAMES = 512;
+
+/// @brief Timed runs per voice count, averaged.
+constexpr int MIX_ITERATIONS = 5;
+
+/// @brief Builds a buffer of noise, so no kernel can take a shortcut on silence.
+/// @param buffer receives the samples.
+/// @param channels 1 or 2.
+/// @param seconds length.
+void FillNoise(sf::SoundBuffer &buffer, unsigned int channels, std::size_t seconds)
+{
+    std::vector<sf::Int16> samples(SAMPLE_RATE * seconds * channels);
+    std::uint32_t state = 0x9E3779B9u;
+
+    for (sf::Int16 &sample : samples)
+    {
+        state = state * 1664525u + 1013904223u;
+        sample = static_cast<sf::Int16>(static_cast<int>(state >> 16) - 32768);
+    }
+
+    buffer.loadFromSamples(samples.data(), samples.size(), channels, SAMPLE_RATE);
+}
+} // namespace
+
+/// @brief Mixes a growing number of voices, half mono and half stereo, and prints how many voices one core mixes in
+/// real time. Runs entirely offline: the mixer stream is never played.
+CT_BENCH(SoftwareMixThroughput)
+{
+    AudioBuses buses;
+    sf::SoundBuffer mono;
+    sf::SoundBuffer stereo;
+    FillNoise(mono, 1, RENDER_SECONDS + 1);
+    FillNoise(stereo, 2, RENDER_SECONDS + 1);
+
+    std::vector<sf::Int16> output(BLOCK_FRAMES * 2);
+
+    std::printf("%8s %12s %14s %16s\n", "voices", "ms / run", "x real time", "voices / sec");
+
+    for (const std::size_t voices : {1, 8, 32, 128, 512})
+    {
+        SoftwareMixer mixer(buses, SAMPLE_RATE);
+
+        const double ms = MeasureMs(MIX_ITERATIONS,
+                                    [&]()
+                                    {
+                                        mixer.StopAll();
+
+                                        for (std::size_t i = 0; i < voices; ++i)
+                                        {
+                                            mixer.Play(i % 2 ? stereo : mono, AudioBusId::Sfx, 0.5f,
+                                                       (i % 3) * 0.5f - 0.5f);
+                                        }
+
+                                        for (std::size_t frame = 0; frame < SAMPLE_RATE * RENDER_SECONDS;
+                                             frame += BLOCK_FRAMES)
+                                        {
+                                            mixer.Mix(output.data(), BLOCK_FRAMES);
+                                        }
+                                    });
+
+        // Voice-seconds of audio mixed per second of wall time.
+        const double realTime = RENDER_SECONDS * 1000.0 / ms;
+
+        std::printf("%8zu %12.3f %14.1f %16.0f\n", voices, ms, realTime, realTime * voices);
+    }
+}
@@ -0,0 +1,64 @@
+// ============================================================================
+//  File        : Bench.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-05
+//  Description : Minimal benchmark registry and timing helpers used by the
+//                CT_bench executable.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+/// @brief A named benchmark body registered with CT_BENCH.
+struct BenchCase
+{
+    const char *name;
+    void (*run)();
+};
+
+/// @brief Every benchmark registered in this executable, in registration order.
+/// @return reference to the registry.
+inline std::vector<BenchCase> &BenchRegistry()
+{
+    static std::vector<BenchCase> registry;
+    return registry;
+}
+
+/// @brief Adds a benchmark to the registry during static initialization.
+struct BenchRegistrar
+{
+    BenchRegistrar(const char *name, void (*run)())
+    {
+        BenchRegistry().push_back({name, run});
+    }
+};
+
+/// @brief Declares and registers a benchmark body: CT_BENCH(MyBench) { ... }
+#define CT_BENCH(Name)                                                                                                 \
+    static void Name();                                                                                                \
+    static const BenchRegistrar Name##Registrar(#Name, &Name);                                                         \
+    static void Name()
+
+/// @brief Runs fn the given number of times and returns the mean wall time of one run.
+/// @param iterations number of runs, at least 1.
+/// @param fn work to time.
+/// @return mean milliseconds per run.
+template <typename Fn> double MeasureMs(int iterations, Fn &&fn)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        fn();
+    }
+
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count() / (iterations > 0 ? iterations : 1);
+}
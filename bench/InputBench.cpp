@@ -0,0 +1,114 @@
+// ============================================================================
+//  File        : InputBench.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-22
+//  Description : Per frame InputManager cost: action queries by name against
+//                queries by integer id, with the end of frame state update.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "Bench.h"
+#include "InputManager.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+/// @brief Bound actions, about what a game scene with menus uses.
+constexpr std::size_t ACTION_COUNT = 16;
+
+/// @brief Simulated frames per timed run.
+constexpr int FRAME_COUNT = 100000;
+
+/// @brief Timed runs per API, averaged.
+constexpr int INPUT_ITERATIONS = 5;
+
+/// @brief Feeds one frame of events: a key goes down every few frames and comes back up a frame later.
+/// @param frame frame number.
+void FeedEvents(int frame)
+{
+    sf::Event event;
+    event.type = frame % 2 ? sf::Event::KeyReleased : sf::Event::KeyPressed;
+    event.key.code = static_cast<sf::Keyboard::Key>(sf::Keyboard::A + (frame / 2) % ACTION_COUNT);
+
+    InputManager::Instance().Update(event);
+}
+
+/// @brief Runs FRAME_COUNT frames that each ask for the pressed, just pressed and just released state of every action.
+/// @param query asks one action for its three states and returns how many were set.
+/// @return set states seen, so the queries cannot be optimized away.
+template <typename Query> std::size_t RunFrames(Query &&query)
+{
+    std::size_t hits = 0;
+
+    for (int frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+        FeedEvents(frame);
+
+        for (std::size_t action = 0; action < ACTION_COUNT; ++action)
+        {
+            hits += query(action);
+        }
+
+        InputManager::Instance().PostUpdate();
+    }
+
+    return hits;
+}
+} // namespace
+
+/// @brief Times a frame of action queries through the string API, which hashes the name on every call, and through
+/// the InputActionId API, which is an array index and a bit test.
+CT_BENCH(InputActionLookup)
+{
+    auto &input = InputManager::Instance();
+    input.Init(std::make_shared<Settings>());
+
+    std::vector<std::string> names;
+    std::vector<InputActionId> ids;
+
+    for (std::size_t i = 0; i < ACTION_COUNT; ++i)
+    {
+        names.push_back("BenchAction" + std::to_string(i));
+        ids.push_back(input.BindKey(names.back(), static_cast<sf::Keyboard::Key>(sf::Keyboard::A + i)));
+    }
+
+    std::size_t stringHits = 0;
+    std::size_t idHits = 0;
+
+    const double stringMs = MeasureMs(INPUT_ITERATIONS,
+                                      [&]()
+                                      {
+                                          stringHits = RunFrames(
+                                              [&](std::size_t i)
+                                              {
+                                                  return input.IsKeyPressed(names[i]) +
+                                                         input.IsKeyJustPressed(names[i]) +
+                                                         input.IsKeyJustReleased(names[i]);
+                                              });
+                                      });
+
+    const double idMs = MeasureMs(INPUT_ITERATIONS,
+                                  [&]()
+                                  {
+                                      idHits = RunFrames(
+                                          [&](std::size_t i)
+                                          {
+                                              return input.IsKeyPressed(ids[i]) + input.IsKeyJustPressed(ids[i]) +
+                                                     input.IsKeyJustReleased(ids[i]);
+                                          });
+                                  });
+
+    input.Shutdown();
+
+    const double queries = static_cast<double>(FRAME_COUNT) * ACTION_COUNT * 3;
+
+    std::printf("%10s %12s %14s %10s\n", "api", "ms / run", "ns / query", "hits");
+    std::printf("%10s %12.3f %14.2f %10zu\n", "string", stringMs, stringMs * 1e6 / queries, stringHits);
+    std::printf("%10s %12.3f %14.2f %10zu\n", "id", idMs, idMs * 1e6 / queries, idHits);
+    std::printf("id lookups are %.1fx faster\n", idMs > 0.0 ? stringMs / idMs : 0.0);
+}
@@ -0,0 +1,90 @@
+// ============================================================================
+//  File        : TextureCacheBench.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-09
+//  Description : Splash to menu texture load time with and without the on
+//                disk decoded texture cache.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "AssetManager.h"
+#include "Bench.h"
+#include "MainMenuAssets.h"
+#include "SplashAssets.h"
+#include <cstdio>
+#include <filesystem>
+
+namespace
+{
+/// @brief Timed passes per configuration, averaged.
+constexpr int LOAD_ITERATIONS = 5;
+
+/// @brief Loads every texture the splash and main menu scenes request, on a fresh AssetManager.
+/// @param cacheDirectory texture disk cache directory.
+/// @param isCacheEnabled whether the texture disk cache is used.
+void LoadSplashAndMenuTextures(const std::string &cacheDirectory, bool isCacheEnabled)
+{
+    auto &assets = AssetManager::Instance();
+    assets.Init(std::make_shared<Settings>());
+    assets.GetTextureDiskCache().SetDirectory(cacheDirectory);
+    assets.GetTextureDiskCache().SetEnabled(isCacheEnabled);
+
+    for (const auto &[key, path] : SplashAssets::Textures)
+    {
+        assets.LoadTexture(key, path);
+    }
+
+    for (const auto &[key, path] : MainMenuAssets::Textures)
+    {
+        assets.LoadTexture(key, path);
+    }
+
+    assets.Shutdown();
+}
+
+/// @brief Sums the size of every file in a directory.
+/// @param directory directory to measure.
+/// @return bytes.
+std::uintmax_t DirectoryBytes(const std::filesystem::path &directory)
+{
+    std::uintmax_t total = 0;
+    std::error_code ec;
+
+    for (const auto &entry : std::filesystem::directory_iterator(directory, ec))
+    {
+        std::error_code entryError;
+        total += entry.is_regular_file(entryError) ? entry.file_size(entryError) : 0;
+    }
+
+    return total;
+}
+} // namespace
+
+/// @brief Times the splash and main menu texture loads decoding every PNG, then filling a scratch texture cache, then
+/// mapping from it. Each pass starts from an empty AssetManager, like a cold start.
+CT_BENCH(SplashToMenuTextureCache)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path scratch = fs::temp_directory_path() / "ct_texture_cache_bench";
+    const std::string directory = scratch.generic_string();
+    std::error_code ec;
+
+    fs::remove_all(scratch, ec);
+
+    const double decodedMs = MeasureMs(LOAD_ITERATIONS, [&]() { LoadSplashAndMenuTextures(directory, false); });
+    const double fillMs = MeasureMs(1, [&]() { LoadSplashAndMenuTextures(directory, true); });
+    const double cookedMs = MeasureMs(LOAD_ITERATIONS, [&]() { LoadSplashAndMenuTextures(directory, true); });
+
+    std::printf("%-28s %10s\n", "splash + menu textures", "ms / pass");
+    std::printf("%-28s %10.3f\n", "decode PNG (no cache)", decodedMs);
+    std::printf("%-28s %10.3f\n", "decode PNG + write cache", fillMs);
+    std::printf("%-28s %10.3f\n", "mapped from cache", cookedMs);
+    std::printf("\nSpeedup: %.2fx, cache size on disk: %ju bytes\n", cookedMs > 0.0 ? decodedMs / cookedMs : 0.0,
+                DirectoryBytes(scratch));
+
+    fs::remove_all(scratch, ec);
+}
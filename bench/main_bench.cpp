@@ -0,0 +1,52 @@
+// ============================================================================
+//  File        : main_bench.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-05
+//  Description : Main entry point for the Chaos Theory benchmark executable.
+//                Run from the repository root so asset paths resolve.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "Bench.h"
+#include "LogManager.h"
+#include <cstdio>
+#include <string_view>
+
+/// @brief Runs every registered benchmark, or only those whose name contains argv[1].
+/// @param argc argument count.
+/// @param argv optional name filter.
+/// @return 0 when at least one benchmark ran.
+int main(int argc, char **argv)
+{
+    const std::string_view filter = argc > 1 ? argv[1] : "";
+
+    LogManager::Instance().Init();
+
+    int ran = 0;
+
+    for (const auto &bench : BenchRegistry())
+    {
+        if (!filter.empty() && std::string_view(bench.name).find(filter) == std::string_view::npos)
+        {
+            continue;
+        }
+
+        std::printf("[ RUN  ] %s\n", bench.name);
+        bench.run();
+        std::printf("[ DONE ] %s\n\n", bench.name);
+
+        ++ran;
+    }
+
+    LogManager::Instance().Shutdown();
+
+    if (ran == 0)
+    {
+        std::printf("No benchmark matches '%.*s'.\n", static_cast<int>(filter.size()), filter.data());
+    }
+
+    return ran > 0 ? 0 : 1;
+}
@@ -13,6 +13,7 @@
 #include "AssetManager.h"
 #include "AudioManager.h"
 #include "GameScene.h"
+#include "GlyphCache.h"
 #include "InputManager.h"
 #include "Macros.h"
 #include "MainMenuScene.h"
@@ -20,44 +21,151 @@
 #include "SceneManager.h"
 #include "SceneTransitionManager.h"
 #include "SettingsManager.h"
+#include "SplashAssets.h"
 #include "SplashScene.h"
+#include "StartupGraph.h"
 #include "UIManager.h"
 #include "WindowManager.h"
 #include "version.h"
+#include <filesystem>
+
+namespace
+{
+/// @brief Path of the persistent settings file.
+constexpr auto CONFIG_FILE_PATH = "config.json";
+
+/// @brief Audio event definitions, inside Settings::m_audioDirectory.
+constexpr auto AUDIO_EVENTS_FILE = "events.json";
+
+/// @brief Root directory of every asset that can be hot reloaded.
+constexpr auto ASSET_ROOT_PATH = "assets";
+
+/// @brief Time each frame may spend uploading slices of streamed textures, in milliseconds.
+constexpr float TEXTURE_UPLOAD_BUDGET_MS = 2.0f;
+} // namespace
 
 /// @brief Initializes the Application with all the Managers; holding final ownership over the provided settings.
+/// Manager startup is declared as a dependency graph: config parsing, the audio device and the first font and splash
+/// decodes run on a startup thread pool while the window and GL bound steps run here on the main thread.
 void Application::Init()
 {
 #if defined(_MSC_VER) && defined(_DEBUG)
     _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
 #endif
 
+    m_startTime = std::chrono::steady_clock::now();
+
+    // Every other task logs, so the logger is the root of the graph rather than a node in it.
     LogManager::Instance().Init();
 
-    std::shared_ptr<Settings> settings = std::make_shared<Settings>();
-    SettingsManager::Instance().LoadFromFile("config.json");
+    StartupGraph graph;
+
+    graph.Add("Config", StartupAffinity::Worker, {},
+              [this]()
+              {
+                  SettingsManager::Instance().LoadFromFile(CONFIG_FILE_PATH);
+                  m_settings = SettingsManager::Instance().GetSettings();
+
+                  return m_settings != nullptr;
+              });
+
+    graph.Add("UIManager", StartupAffinity::MainThread, {},
+              []()
+              {
+                  UIManager::Instance().Init();
+                  return UIManager::Instance().IsInitialized();
+              });
+
+    graph.Add("WindowManager", StartupAffinity::MainThread, {"Config"},
+              [this]()
+              {
+                  WindowManager::Instance().Init(m_settings, sf::Style::Titlebar);
+                  return WindowManager::Instance().IsOpen();
+              });
+
+    graph.Add("InputManager", StartupAffinity::MainThread, {"Config"},
+              [this]()
+              {
+                  InputManager::Instance().Init(m_settings);
+                  return InputManager::Instance().IsInitialized();
+              });
+
+    graph.Add("AssetManager", StartupAffinity::Worker, {"Config"},
+              [this]()
+              {
+                  AssetManager::Instance().Init(m_settings);
+                  return AssetManager::Instance().IsInitialized();
+              });
+
+    graph.Add("AudioManager", StartupAffinity::Worker, {"Config"},
+              [this]()
+              {
+                  AudioManager::Instance().Init(m_settings);
+                  AudioManager::Instance().StartAudioThread();
+                  return AudioManager::Instance().IsInitialized();
+              });
+
+    // Main thread: loading the event sounds fills AssetManager caches the scenes use.
+    graph.Add("AudioEvents", StartupAffinity::MainThread, {"AssetManager", "AudioManager"},
+              [this]()
+              {
+                  // A missing or broken event file only silences the events; it is logged, not fatal.
+                  AudioManager::Instance().LoadEvents(m_settings->m_audioDirectory + AUDIO_EVENTS_FILE);
+                  return true;
+              });
+
+    graph.Add("DefaultFont", StartupAffinity::Worker, {"AssetManager"},
+              [this]() { return AssetManager::Instance().PrefetchFont(m_settings->m_fontDirectory + "Default.ttf"); });
 
-    m_settings = SettingsManager::Instance().GetSettings();
+    graph.Add("SplashTexture", StartupAffinity::Worker, {"AssetManager"},
+              []()
+              {
+                  return AssetManager::Instance().PrefetchTexture(
+                      SplashAssets::Textures.at(SplashAssets::SplashBackground));
+              });
 
-    UIManager::Instance().Init();
-    WindowManager::Instance().Init(m_settings, sf::Style::Titlebar);
-    InputManager::Instance().Init(m_settings);
-    AssetManager::Instance().Init(m_settings);
-    AudioManager::Instance().Init(m_settings);
-    SceneManager::Instance().Init(m_settings);
+    graph.Add("FileWatcher", StartupAffinity::Worker, {},
+              [this]()
+              {
+                  // Unsupported platforms simply run without hot reload.
+                  m_fileWatcher.Start({ASSET_ROOT_PATH, CONFIG_FILE_PATH});
+                  return true;
+              });
 
-    SceneManager::Instance().PushScene(SceneManager::Instance().Create(SceneID::Splash));
+    graph.Add("SceneManager", StartupAffinity::MainThread,
+              {"UIManager", "WindowManager", "InputManager", "AssetManager", "AudioManager", "AudioEvents"},
+              [this]()
+              {
+                  SceneManager::Instance().Init(m_settings);
+                  return SceneManager::Instance().IsInitialized();
+              });
 
-    if (!WindowManager::Instance().IsOpen())
+    graph.Add("SplashScene", StartupAffinity::MainThread, {"SceneManager", "SplashTexture"},
+              []()
+              {
+                  SceneManager::Instance().PushScene(SceneManager::Instance().Create(SceneID::Splash));
+                  return SceneManager::Instance().HasActiveScene();
+              });
+
+    bool isReady = false;
+
+    {
+        ThreadPool startupPool;
+        isReady = graph.Run(startupPool);
+    }
+
+    graph.LogTimings();
+
+    if (!isReady || !WindowManager::Instance().IsOpen())
     {
-        CT_LOG_ERROR("App::Init() - Window failed to open. Aborting.");
+        CT_LOG_ERROR("App::Init() - Startup failed. Aborting.");
         return;
     }
 
     m_isRunning = true;
     m_isInitialized = true;
 
-    CT_LOG_INFO("Application initialized.");
+    CT_LOG_INFO("Application initialized in {:.2f} ms.", MillisecondsSinceStart());
     CT_LOG_INFO("ChaosTheory v{}", CT_VERSION_STRING);
 }
 
@@ -68,14 +176,36 @@ void Application::Run()
 
     while (m_isRunning && WindowManager::Instance().IsOpen() && SceneManager::Instance().HasActiveScene())
     {
-        float dt = clock.restart().asSeconds();
+        const float dt = NextFrameDelta(clock);
+
+        if (!m_isRunning)
+        {
+            break;
+        }
 
         ProcessEvents();
+
+        if (m_inputRecorder.IsOpen())
+        {
+            m_inputRecorder.WriteFrame(dt, InputManager::Instance().GetFrameEvents(),
+                                       InputManager::Instance().GetFrameStartMs());
+        }
+
+        ProcessHotReload();
         AudioManager::Instance().Update(dt);
         SceneManager::Instance().Update(dt);
         SceneTransitionManager::Instance().Update(dt);
+        AudioManager::Instance().FlushSFX();
         InputManager::Instance().PostUpdate();
+        AssetManager::Instance().PumpTextureUploads(TEXTURE_UPLOAD_BUDGET_MS);
         Render();
+
+        if (!m_hasRenderedFirstFrame)
+        {
+            m_hasRenderedFirstFrame = true;
+
+            CT_LOG_INFO("Time to first frame: {:.2f} ms.", MillisecondsSinceStart());
+        }
     }
 
     CT_LOG_INFO("No active scenes left. Shutting down application.");
@@ -86,8 +216,20 @@ void Application::Run()
 /// @brief Shuts down the Application after shutting down any manager and resets internal state.
 void Application::Shutdown()
 {
+    m_fileWatcher.Stop();
+
+    m_inputRecorder.Close();
+    m_isReplayingInput = false;
+
+    // Fonts are released by the AssetManager, so the warm set must go first.
+    GlyphCache::Instance().LogStats();
+    GlyphCache::Instance().Clear();
+
     WindowManager::Instance().Shutdown();
     InputManager::Instance().Shutdown();
+
+    // The software mixer reads sound buffers directly, so nothing may still be playing them.
+    AudioManager::Instance().StopAllSFX();
     AssetManager::Instance().Shutdown();
     SceneManager::Instance().Shutdown();
     AudioManager::Instance().Shutdown();
@@ -100,39 +242,201 @@ void Application::Shutdown()
     m_isInitialized = false;
 }
 
-/// @brief Requests any event processing that needs to be finalized in a game frame.
+/// @brief Records every frame's delta and input events from the next frame on, appending each frame to the file as
+/// it ends, so a crash keeps the frames that led up to it. Call it between Init and Run.
+/// @param filepath recording to create or replace.
+/// @return false if the file cannot be created; the application then runs without recording.
+bool Application::RecordInput(const std::string &filepath)
+{
+    CT_WARN_IF_UNINITIALIZED_RET("Application", "RecordInput", false);
+
+    if (!m_inputRecorder.Open(filepath))
+    {
+        return false;
+    }
+
+    CT_LOG_INFO("Recording input to '{}'.", filepath);
+
+    return true;
+}
+
+/// @brief Replays a recording written by RecordInput in place of the keyboard and mouse: each frame gets the recorded
+/// delta and events, and the InputManager's clock follows the recorded deltas, so the run repeats frame for frame.
+/// The application closes when the recording ends. Call it between Init and Run.
+/// @param filepath recording to replay.
+/// @return false if the recording cannot be loaded; the application then runs on live input.
+bool Application::ReplayInput(const std::string &filepath)
+{
+    CT_WARN_IF_UNINITIALIZED_RET("Application", "ReplayInput", false);
+
+    if (!m_inputReplay.LoadFromFile(filepath))
+    {
+        return false;
+    }
+
+    m_replayFrame = 0;
+    m_isReplayingInput = true;
+    InputManager::Instance().SetManualClock(true);
+
+    CT_LOG_INFO("Replaying {} frames, {} input events, from '{}'.", m_inputReplay.GetFrameCount(),
+                m_inputReplay.GetEventCount(), filepath);
+
+    return true;
+}
+
+/// @brief Returns the delta of the frame about to run: the measured time since the previous frame, or the recorded
+/// one during a replay. Ends the run once a replay has no frame left.
+/// @param clock the main loop's frame clock.
+/// @return frame delta, in seconds.
+float Application::NextFrameDelta(sf::Clock &clock)
+{
+    const float measured = clock.restart().asSeconds();
+
+    if (!m_isReplayingInput)
+    {
+        return measured;
+    }
+
+    if (m_replayFrame >= m_inputReplay.GetFrameCount())
+    {
+        CT_LOG_INFO("Input replay finished after {} frames.", m_replayFrame);
+
+        m_isRunning = false;
+
+        return 0.0f;
+    }
+
+    const float dt = m_inputReplay.GetFrame(m_replayFrame).dt;
+    InputManager::Instance().AdvanceManualClock(static_cast<double>(dt) * 1000.0);
+
+    return dt;
+}
+
+/// @brief Requests any event processing that needs to be finalized in a game frame. During a replay the window is
+/// still polled, for close, resize and focus, but its input events are dropped and the recorded frame's are fed
+/// through the same path instead.
 void Application::ProcessEvents()
 {
     sf::Event event;
 
     while (WindowManager::Instance().PollEvent(event))
     {
+        if (m_isReplayingInput && InputManager::IsInputEvent(event))
+        {
+            continue;
+        }
+
+        // First, so the event is stamped as close to the poll as possible.
         InputManager::Instance().Update(event);
 
-        if (SceneManager::Instance().HasActiveScene())
+        if (!DispatchEvent(event))
         {
-            SceneManager::Instance().GetActiveScene()->HandleEvent(event);
+            return;
         }
-        else
-        {
-            m_isRunning = false;
+    }
+
+    if (!m_isReplayingInput)
+    {
+        return;
+    }
+
+    const InputFrame &frame = m_inputReplay.GetFrame(m_replayFrame++);
+    const double frameStartMs = InputManager::Instance().GetFrameStartMs();
 
+    for (const TimedInputEvent &timed : frame.events)
+    {
+        InputManager::Instance().Update(timed.event, frameStartMs + timed.timeMs);
+
+        if (!DispatchEvent(timed.event))
+        {
             return;
         }
+    }
+}
+
+/// @brief Hands an event to the active scene and reacts to the window closing.
+/// @param event polled or replayed event.
+/// @return false if there is no active scene left, which stops the application.
+bool Application::DispatchEvent(const sf::Event &event)
+{
+    if (!SceneManager::Instance().HasActiveScene())
+    {
+        m_isRunning = false;
+
+        return false;
+    }
+
+    SceneManager::Instance().GetActiveScene()->HandleEvent(event);
 
-        switch (event.type)
+    switch (event.type)
+    {
+        case sf::Event::Closed:
+            m_isRunning = false;
+            CT_LOG_INFO("Application closing from window close event.");
+            break;
+
+        default:
+            break;
+    }
+
+    return true;
+}
+
+/// @brief Applies file changes collected by the FileWatcher since the previous frame. Only the changed files are
+/// re-decoded; assets are reloaded in place so existing sprites keep their texture.
+void Application::ProcessHotReload()
+{
+    for (const auto &path : m_fileWatcher.ConsumeChanges())
+    {
+        if (std::filesystem::path(path).filename() == CONFIG_FILE_PATH)
+        {
+            ReloadConfig();
+        }
+        else if (std::filesystem::path(path).filename() == AUDIO_EVENTS_FILE)
         {
-            case sf::Event::Closed:
-                m_isRunning = false;
-                CT_LOG_INFO("Application closing from window close event.");
-                break;
+            AudioManager::Instance().StopAllSFX();
+            AudioManager::Instance().LoadEvents(path);
+        }
+        else
+        {
+            const auto extension = std::filesystem::path(path).extension();
+            const bool isFont = extension == ".ttf";
+
+            // A sound buffer reloads in place; the software mixer must not be reading it meanwhile.
+            if (extension == ".wav" || extension == ".ogg" || extension == ".flac")
+            {
+                AudioManager::Instance().StopAllSFX();
+            }
 
-            default:
-                break;
+            // A reloaded font starts with empty glyph pages.
+            if (AssetManager::Instance().ReloadFromDisk(path) && isFont)
+            {
+                GlyphCache::Instance().Invalidate();
+                GlyphCache::Instance().PrewarmUI();
+            }
         }
     }
 }
 
+/// @brief Re-reads config.json and pushes any changed values to the managers that cache them: volumes and mixing to
+/// the AudioManager, key bindings to the InputManager and resolution, vsync and frame limit to the WindowManager.
+void Application::ReloadConfig()
+{
+    const Settings previous = *m_settings;
+
+    if (!SettingsManager::Instance().LoadFromFile(CONFIG_FILE_PATH) ||
+        !SettingsManager::Instance().IsDifferentFrom(previous))
+    {
+        return;
+    }
+
+    AudioManager::Instance().HotReload(m_settings);
+    InputManager::Instance().HotReload(m_settings);
+    WindowManager::Instance().HotReload(previous);
+
+    CT_LOG_INFO("Application hot reloaded {}.", CONFIG_FILE_PATH);
+}
+
 /// @brief Renders any necessary finalized imagery in the game frame.
 void Application::Render()
 {
@@ -142,4 +446,13 @@ void Application::Render()
     SceneTransitionManager::Instance().Render(WindowManager::Instance().GetWindow());
 
     WindowManager::Instance().EndDraw();
-}
\ No newline at end of file
+}
+
+/// @brief Returns the time elapsed since Init started.
+/// @return milliseconds.
+double Application::MillisecondsSinceStart() const
+{
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - m_startTime;
+
+    return elapsed.count();
+}
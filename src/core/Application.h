@@ -11,9 +11,15 @@
 
 #pragma once
 
+#include "FileWatcher.h"
+#include "InputRecording.h"
 #include "SceneManager.h"
 #include "Settings.h"
+#include <SFML/System/Clock.hpp>
+#include <chrono>
+#include <cstddef>
 #include <memory>
+#include <string>
 
 // ============================================================================
 //  Class       : Application
@@ -21,10 +27,13 @@
 //                of the ChaosTheory game engine. Acts as the entry point
 //                for runtime execution.
 //  Responsibilities:
-//      - Initializes and shuts down all core managers
+//      - Initializes all core managers through a startup graph
+//      - Shuts down all core managers
 //      - Processes window events
 //      - Updates active scenes and managers
 //      - Handles the render loop and time delta
+//      - Hot reloads changed assets and config.json
+//      - Records the input stream, or replays one in place of the keyboard
 //
 // ============================================================================
 class Application
@@ -39,12 +48,29 @@ class Application
     void Init();
     void Run();
 
+    bool RecordInput(const std::string &filepath);
+    bool ReplayInput(const std::string &filepath);
+
   private:
     void Shutdown();
+    float NextFrameDelta(sf::Clock &clock);
     void ProcessEvents();
+    bool DispatchEvent(const sf::Event &event);
+    void ProcessHotReload();
+    void ReloadConfig();
     void Render();
+    double MillisecondsSinceStart() const;
 
     bool m_isRunning = false;
+    bool m_hasRenderedFirstFrame = false;
     bool m_isInitialized = false;
     std::shared_ptr<Settings> m_settings;
+    FileWatcher m_fileWatcher;
+    std::chrono::steady_clock::time_point m_startTime;
+
+    // Input recording and replay; both can run at once, which re-records a replay to check it is deterministic.
+    InputRecordingWriter m_inputRecorder;
+    bool m_isReplayingInput = false;
+    std::size_t m_replayFrame = 0;
+    InputRecording m_inputReplay;
 };
\ No newline at end of file
@@ -0,0 +1,408 @@
+// ============================================================================
+//  File        : AssetCache.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-02
+//  Description : Content addressed storage for a single SFML resource type.
+//                Names are aliases onto shared resources, so the same file
+//                requested under several keys is decoded only once. Every
+//                alias owns a dense slot so handle lookups are one index.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include "AssetId.h"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// @brief Snapshot of how well a content addressed cache is deduplicating its loads.
+struct AssetCacheReport
+{
+    std::size_t uniqueResources = 0;
+    std::size_t aliasCount = 0;
+    std::size_t dedupedLoads = 0;
+    std::size_t residentBytes = 0;
+    std::size_t dedupedBytes = 0;
+
+    AssetCacheReport &operator+=(const AssetCacheReport &other)
+    {
+        uniqueResources += other.uniqueResources;
+        aliasCount += other.aliasCount;
+        dedupedLoads += other.dedupedLoads;
+        residentBytes += other.residentBytes;
+        dedupedBytes += other.dedupedBytes;
+
+        return *this;
+    }
+};
+
+// ============================================================================
+//  Class       : AssetCache
+//  Purpose     : Second level cache keyed by canonical path and content hash.
+//
+//  Responsibilities:
+//      - Owns one resource per unique file content.
+//      - Maps any number of names (aliases) onto that resource.
+//      - Interns aliases as AssetIds backed by dense handle slots.
+//      - Tracks the bytes that duplicate requests did not have to decode.
+//
+// ============================================================================
+template <typename T> class AssetCache
+{
+  public:
+    /// @brief A single decoded resource, shared by every alias that points at it.
+    struct Entry
+    {
+        std::unique_ptr<T> resource;
+        std::string canonicalPath;
+        std::uint64_t contentHash = 0;
+        std::size_t bytes = 0;
+
+        /// @brief Source bytes kept alive for resources that stream from memory (sf::Font).
+        std::vector<char> retained;
+
+        /// @brief Scene that was loading when the resource was decoded.
+        std::string scene;
+
+        /// @brief Every name that resolves to this resource, in registration order.
+        std::vector<std::string> aliases;
+    };
+
+    /// @brief Returns the resource behind a handle, or nullptr. This is the hot path: one bounds check and one index.
+    /// @param handle dense slot index.
+    /// @return pointer to the shared resource.
+    T *Get(AssetHandle handle) const
+    {
+        return handle.index < m_slots.size() ? m_slots[handle.index]->resource.get() : nullptr;
+    }
+
+    /// @brief Resolves an interned id to its dense handle.
+    /// @param id hashed asset key.
+    /// @return handle, invalid if id is not registered.
+    AssetHandle GetHandle(AssetId id) const
+    {
+        auto it = m_ids.find(id);
+
+        return it == m_ids.end() ? AssetHandle{} : it->second;
+    }
+
+    /// @brief Returns the resource registered under id, or nullptr.
+    /// @param id hashed asset key.
+    /// @return pointer to the shared resource.
+    T *Find(AssetId id) const
+    {
+        return Get(GetHandle(id));
+    }
+
+    /// @brief String convenience layer over Find(AssetId). Debug builds verify the hash really belongs to name.
+    /// @param name alias to look up.
+    /// @return pointer to the shared resource.
+    T *Find(const std::string &name) const
+    {
+        const AssetHandle handle = GetHandle(MakeAssetId(name));
+
+#ifndef NDEBUG
+        if (handle.IsValid() && m_slotNames[handle.index] != name)
+        {
+            return nullptr;
+        }
+#endif
+
+        return Get(handle);
+    }
+
+    /// @brief Returns whether name is already an alias in this cache.
+    /// @param name alias to look up.
+    /// @return true / false
+    bool Contains(const std::string &name) const
+    {
+        const AssetHandle handle = GetHandle(MakeAssetId(name));
+
+        return handle.IsValid() && m_slotNames[handle.index] == name;
+    }
+
+    /// @brief Returns whether registering name would collide with a different key that hashes to the same AssetId.
+    /// @param name alias about to be registered.
+    /// @return the key already holding the id, or empty when there is no collision.
+    std::string FindCollision(const std::string &name) const
+    {
+        const AssetHandle handle = GetHandle(MakeAssetId(name));
+
+        if (handle.IsValid() && m_slotNames[handle.index] != name)
+        {
+            return m_slotNames[handle.index];
+        }
+
+        return {};
+    }
+
+    /// @brief Returns the key a handle was registered with.
+    /// @param handle dense slot index.
+    /// @return registered alias, or empty if handle is stale.
+    const std::string &GetName(AssetHandle handle) const
+    {
+        static const std::string empty;
+
+        return handle.index < m_slotNames.size() ? m_slotNames[handle.index] : empty;
+    }
+
+    /// @brief Aliases name onto a resource that was already loaded from canonicalPath, without touching the file.
+    /// @param name new alias.
+    /// @param canonicalPath canonical source path.
+    /// @return true if the path was already resident.
+    bool TryAliasPath(const std::string &name, const std::string &canonicalPath)
+    {
+        auto it = m_pathIndex.find(canonicalPath);
+
+        if (it == m_pathIndex.end())
+        {
+            return false;
+        }
+
+        Link(name, canonicalPath, *it->second);
+
+        return true;
+    }
+
+    /// @brief Aliases name onto a resource with identical content loaded from any path.
+    /// @param name new alias.
+    /// @param canonicalPath canonical source path, remembered for future lookups.
+    /// @param contentHash hash of the source bytes.
+    /// @return true if the content was already resident.
+    bool TryAliasContent(const std::string &name, const std::string &canonicalPath, std::uint64_t contentHash)
+    {
+        auto it = m_contentIndex.find(contentHash);
+
+        if (it == m_contentIndex.end())
+        {
+            return false;
+        }
+
+        m_pathIndex[canonicalPath] = it->second;
+        Link(name, canonicalPath, *it->second);
+
+        return true;
+    }
+
+    /// @brief Takes ownership of a freshly decoded resource and aliases name onto it.
+    /// @param name first alias.
+    /// @param canonicalPath canonical source path.
+    /// @param contentHash hash of the source bytes.
+    /// @param bytes size of the source file.
+    /// @param resource decoded resource.
+    /// @param retained optional source bytes that must outlive the resource.
+    /// @return reference to the stored resource.
+    T &Insert(const std::string &name, const std::string &canonicalPath, std::uint64_t contentHash, std::size_t bytes,
+              std::unique_ptr<T> resource, std::vector<char> retained = {})
+    {
+        auto entry = std::make_unique<Entry>();
+        entry->resource = std::move(resource);
+        entry->canonicalPath = canonicalPath;
+        entry->contentHash = contentHash;
+        entry->bytes = bytes;
+        entry->retained = std::move(retained);
+
+        Entry &stored = *entry;
+        m_entries.push_back(std::move(entry));
+        m_contentIndex[contentHash] = &stored;
+        m_pathIndex[canonicalPath] = &stored;
+        AddSlot(name, canonicalPath, stored);
+
+        return *stored.resource;
+    }
+
+    /// @brief Returns the entry that was decoded from canonicalPath, or nullptr.
+    /// @param canonicalPath canonical source path.
+    /// @return pointer to the entry.
+    Entry *FindByPath(const std::string &canonicalPath) const
+    {
+        auto it = m_pathIndex.find(canonicalPath);
+
+        return it == m_pathIndex.end() ? nullptr : it->second;
+    }
+
+    /// @brief Calls fn with every resident entry, in load order.
+    /// @param fn callable taking const Entry &.
+    template <typename Fn> void ForEachEntry(Fn &&fn) const
+    {
+        for (const auto &entry : m_entries)
+        {
+            fn(*entry);
+        }
+    }
+
+    /// @brief Returns whether an entry holds aliases requested from another file that only shared its content.
+    /// @param entry entry about to be reloaded.
+    /// @return true if reloading it in place would change what those aliases resolve to.
+    bool HasForeignAliases(const Entry &entry) const
+    {
+        for (std::size_t i = 0; i < m_slots.size(); ++i)
+        {
+            if (m_slots[i] == &entry && m_slotPaths[i] != entry.canonicalPath)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// @brief Moves an entry to a new content hash after its resource was reloaded in place. Aliases requested from
+    /// other files keep the old content: they move onto previous, a copy of the resource taken before the reload.
+    /// @param entry entry whose resource now holds new content.
+    /// @param contentHash hash of the new source bytes.
+    /// @param bytes size of the new source file.
+    /// @param previous copy of the old resource, required when HasForeignAliases was true before the reload.
+    void Rehash(Entry &entry, std::uint64_t contentHash, std::size_t bytes, std::unique_ptr<T> previous = nullptr)
+    {
+        Entry *kept = previous ? &SplitForeignAliases(entry, std::move(previous)) : nullptr;
+
+        // Any other path still pointing here matched the old content; it keeps it, or decodes on its next load.
+        for (auto it = m_pathIndex.begin(); it != m_pathIndex.end();)
+        {
+            if (it->second != &entry || it->first == entry.canonicalPath)
+            {
+                ++it;
+            }
+            else if (kept)
+            {
+                it->second = kept;
+                ++it;
+            }
+            else
+            {
+                it = m_pathIndex.erase(it);
+            }
+        }
+
+        if (auto it = m_contentIndex.find(entry.contentHash); it != m_contentIndex.end() && it->second == &entry)
+        {
+            if (kept)
+            {
+                it->second = kept;
+            }
+            else
+            {
+                m_contentIndex.erase(it);
+            }
+        }
+
+        entry.contentHash = contentHash;
+        entry.bytes = bytes;
+        m_contentIndex.try_emplace(contentHash, &entry);
+    }
+
+    /// @brief Drops every alias and resource.
+    void Clear()
+    {
+        m_slots.clear();
+        m_slotNames.clear();
+        m_slotPaths.clear();
+        m_ids.clear();
+        m_pathIndex.clear();
+        m_contentIndex.clear();
+        m_entries.clear();
+        m_dedupedLoads = 0;
+        m_dedupedBytes = 0;
+    }
+
+    /// @brief Summarizes aliasing and deduplication for this cache.
+    /// @return AssetCacheReport
+    AssetCacheReport Report() const
+    {
+        AssetCacheReport report;
+        report.uniqueResources = m_entries.size();
+        report.aliasCount = m_slots.size() - std::min(m_slots.size(), m_entries.size());
+        report.dedupedLoads = m_dedupedLoads;
+        report.dedupedBytes = m_dedupedBytes;
+
+        for (const auto &entry : m_entries)
+        {
+            report.residentBytes += entry->bytes;
+        }
+
+        return report;
+    }
+
+  private:
+    /// @brief Points name at entry, counting the avoided decode when name is new.
+    void Link(const std::string &name, const std::string &canonicalPath, Entry &entry)
+    {
+        if (Contains(name))
+        {
+            return;
+        }
+
+        AddSlot(name, canonicalPath, entry);
+        ++m_dedupedLoads;
+        m_dedupedBytes += entry.bytes;
+    }
+
+    /// @brief Appends a dense slot for name and interns its AssetId.
+    void AddSlot(const std::string &name, const std::string &canonicalPath, Entry &entry)
+    {
+        const AssetHandle handle{static_cast<std::uint32_t>(m_slots.size())};
+
+        m_slots.push_back(&entry);
+        m_slotNames.push_back(name);
+        m_slotPaths.push_back(canonicalPath);
+        m_ids[MakeAssetId(name)] = handle;
+        entry.aliases.push_back(name);
+    }
+
+    /// @brief Moves the aliases requested from other files onto a new entry owning previous, with the old content.
+    /// The retained bytes move too: a copied sf::Font still reads the buffer it was opened from.
+    Entry &SplitForeignAliases(Entry &entry, std::unique_ptr<T> previous)
+    {
+        auto split = std::make_unique<Entry>();
+        split->resource = std::move(previous);
+        split->contentHash = entry.contentHash;
+        split->bytes = entry.bytes;
+        split->retained = std::move(entry.retained);
+        split->scene = entry.scene;
+
+        for (std::size_t i = 0; i < m_slots.size(); ++i)
+        {
+            if (m_slots[i] != &entry || m_slotPaths[i] == entry.canonicalPath)
+            {
+                continue;
+            }
+
+            if (split->canonicalPath.empty())
+            {
+                split->canonicalPath = m_slotPaths[i];
+            }
+
+            m_slots[i] = split.get();
+            split->aliases.push_back(m_slotNames[i]);
+            std::erase(entry.aliases, m_slotNames[i]);
+        }
+
+        Entry &stored = *split;
+        m_entries.push_back(std::move(split));
+
+        return stored;
+    }
+
+  private:
+    std::vector<Entry *> m_slots;
+    std::vector<std::string> m_slotNames;
+
+    /// @brief Canonical path each alias was requested from, so a reload knows which aliases are its own.
+    std::vector<std::string> m_slotPaths;
+
+    std::unordered_map<AssetId, AssetHandle> m_ids;
+    std::vector<std::unique_ptr<Entry>> m_entries;
+    std::unordered_map<std::string, Entry *> m_pathIndex;
+    std::unordered_map<std::uint64_t, Entry *> m_contentIndex;
+
+    std::size_t m_dedupedLoads = 0;
+    std::size_t m_dedupedBytes = 0;
+};
@@ -11,10 +11,15 @@
 // ============================================================================
 
 #include "AssetManager.h"
+#include "AudioImporter.h"
+#include "GlyphCache.h"
+#include "Hash.h"
 #include "Macros.h"
 #include "Settings.h"
+#include "SoundNormalizer.h"
 
 #include <filesystem>
+#include <fstream>
 
 /// @brief These static references to certain sf objects are used for short circuit logic where the AssetManager might
 /// not yet be initialized, so doing routine logic would be dangerous.
@@ -28,6 +33,483 @@ static sf::Texture dummyTexture;
 
 /// @brief An empty, but valid Font.
 static sf::Font dummyFont;
+
+/// @brief Where the load telemetry report is written at shutdown.
+constexpr auto TELEMETRY_REPORT_PATH = "log/asset_telemetry.json";
+
+/// @brief How many of the slowest loads the log summary lists.
+constexpr std::size_t TELEMETRY_SUMMARY_COUNT = 10;
+
+/// @brief Resolves a filepath to a stable key so "a/../b.png" and "b.png" share a cache slot.
+/// @param filepath path as requested by the caller.
+/// @return canonical generic path, or filepath itself if it cannot be resolved.
+std::string CanonicalPath(const std::string &filepath)
+{
+    std::error_code ec;
+    const auto canonical = std::filesystem::weakly_canonical(filepath, ec);
+
+    return ec ? filepath : canonical.generic_string();
+}
+
+/// @brief Reads an entire file into memory.
+/// @param filepath file to read.
+/// @param bytes destination buffer.
+/// @return true / false
+bool ReadFileBytes(const std::string &filepath, std::vector<char> &bytes)
+{
+    std::ifstream in(filepath, std::ios::binary | std::ios::ate);
+
+    if (!in.is_open())
+    {
+        return false;
+    }
+
+    const auto size = static_cast<std::size_t>(in.tellg());
+    bytes.resize(size);
+    in.seekg(0);
+
+    return static_cast<bool>(in.read(bytes.data(), static_cast<std::streamsize>(size)));
+}
+
+/// @brief Type specific stages of the shared load path; texture fields stay null for sounds, and all of them for fonts.
+struct LoadOptions
+{
+    /// @brief Decoded texture cache to read from and write to.
+    const TextureDiskCache *textureCache = nullptr;
+
+    /// @brief When set, large textures are created empty and filled over the next frames.
+    TextureStreamer *streamer = nullptr;
+
+    /// @brief Normalized sound cache to read from and write to.
+    const SoundDiskCache *soundCache = nullptr;
+
+    /// @brief Rate sounds are resampled to at load time; 0 keeps them as decoded.
+    unsigned int soundSampleRate = 0;
+};
+
+/// @brief Returns the size of the pixels a texture source holds.
+/// @param source decoded image or disk cache mapping.
+/// @return size in pixels.
+sf::Vector2u PixelSize(const PrefetchedAsset &source)
+{
+    return source.cooked.IsValid() ? sf::Vector2u(source.cooked.width, source.cooked.height) : source.image.getSize();
+}
+
+/// @brief Returns whether a texture source is uploaded by the streamer instead of in one call.
+/// @param source decoded image or disk cache mapping.
+/// @param options texture stages of this load.
+/// @return true / false
+bool IsStreamed(const PrefetchedAsset &source, const LoadOptions &options)
+{
+    return options.streamer && TextureStreamer::ShouldStream(PixelSize(source));
+}
+
+/// @brief Decodes an image and uploads it to the GPU as two separately timed stages. A prefetched image skips the
+/// decode, and pixels mapped from the texture disk cache go straight to the upload. A streamed texture is only created
+/// here; StartStreaming queues its pixels.
+/// @param texture destination texture.
+/// @param source encoded image, possibly already decoded or cooked.
+/// @param record receives decode and upload times.
+/// @param options texture stages of this load.
+/// @return true / false
+bool DecodeInto(sf::Texture &texture, PrefetchedAsset &source, AssetLoadRecord &record,
+                const LoadOptions &options)
+{
+    AssetStopwatch stopwatch;
+
+    if (!source.cooked.IsValid() && !source.isDecoded)
+    {
+        if (!source.image.loadFromMemory(source.bytes.data(), source.bytes.size()))
+        {
+            return false;
+        }
+
+        source.isDecoded = true;
+    }
+
+    record.decodeMs = stopwatch.Restart();
+
+    const sf::Vector2u size = PixelSize(source);
+
+    if (!texture.create(size.x, size.y))
+    {
+        return false;
+    }
+
+    if (!IsStreamed(source, options))
+    {
+        texture.update(source.cooked.IsValid() ? source.cooked.pixels : source.image.getPixelsPtr());
+    }
+
+    record.uploadMs = stopwatch.Restart();
+
+    return true;
+}
+
+/// @brief Converts a decoded sound to the device rate, and to mono when both its channels are the same signal, so no
+/// voice has to be resampled while it plays.
+/// @param buffer decoded sound buffer, replaced in place when anything changed.
+/// @param sampleRate device rate, or 0 to keep the sound as decoded.
+/// @return true / false
+bool NormalizeSound(sf::SoundBuffer &buffer, unsigned int sampleRate)
+{
+    std::vector<sf::Int16> normalized;
+    unsigned int channels = 0;
+
+    if (sampleRate == 0 ||
+        !SoundNormalizer::Normalize(buffer.getSamples(), static_cast<std::size_t>(buffer.getSampleCount()),
+                                    buffer.getChannelCount(), buffer.getSampleRate(), sampleRate, normalized, channels))
+    {
+        return true;
+    }
+
+    return buffer.loadFromSamples(normalized.data(), normalized.size(), channels, sampleRate);
+}
+
+/// @brief Decodes audio into a sound buffer and normalizes it. SFML fills the OpenAL buffer inside the same call, so
+/// it counts as decode. Samples mapped from the sound disk cache are already normalized and go straight in.
+/// @param buffer destination sound buffer.
+/// @param source encoded audio, or cache mapping.
+/// @param record receives the decode time.
+/// @param options sound normalization of this load.
+/// @return true / false
+bool DecodeInto(sf::SoundBuffer &buffer, PrefetchedAsset &source, AssetLoadRecord &record, const LoadOptions &options)
+{
+    AssetStopwatch stopwatch;
+    bool decoded = false;
+
+    if (source.cookedSound.IsValid())
+    {
+        const CookedSound &cooked = source.cookedSound;
+        decoded = buffer.loadFromSamples(cooked.samples, cooked.sampleCount, cooked.channelCount, cooked.sampleRate);
+    }
+    else
+    {
+        decoded = buffer.loadFromMemory(source.bytes.data(), source.bytes.size()) &&
+                  NormalizeSound(buffer, options.soundSampleRate);
+    }
+
+    record.decodeMs = stopwatch.Restart();
+
+    return decoded;
+}
+
+/// @brief Opens a font face. Glyphs are rasterized later, on first use.
+/// @param font destination font.
+/// @param source font file, whose bytes must outlive the font.
+/// @param record receives the decode time.
+/// @return true / false
+bool DecodeInto(sf::Font &font, PrefetchedAsset &source, AssetLoadRecord &record, const LoadOptions &)
+{
+    AssetStopwatch stopwatch;
+    const bool decoded = font.loadFromMemory(source.bytes.data(), source.bytes.size());
+    record.decodeMs = stopwatch.Restart();
+
+    return decoded;
+}
+
+/// @brief Hands a created texture and its pixels to the streamer, when DecodeInto left the upload to it.
+/// @param texture created, still empty texture.
+/// @param source decoded image or disk cache mapping, moved into the streamer.
+/// @param options texture stages of this load.
+void StartStreaming(sf::Texture &texture, PrefetchedAsset &source, const LoadOptions &options)
+{
+    if (IsStreamed(source, options))
+    {
+        options.streamer->Enqueue(texture, std::move(source));
+    }
+}
+
+/// @brief Sounds and fonts are always complete after DecodeInto.
+template <typename T> void StartStreaming(T &, PrefetchedAsset &, const LoadOptions &)
+{
+}
+
+/// @brief Writes the pixels of a freshly decoded image to the texture disk cache, so the next run can skip the decode.
+/// @param diskCache destination cache.
+/// @param canonicalPath canonical source path.
+/// @param source source bytes and decoded image.
+void StoreCooked(const TextureDiskCache &diskCache, const std::string &canonicalPath, const PrefetchedAsset &source)
+{
+    const sf::Vector2u size = source.image.getSize();
+
+    if (!diskCache.Store(canonicalPath, source.contentHash, source.bytes.size(), size.x, size.y,
+                         source.image.getPixelsPtr()))
+    {
+        CT_LOG_DEBUG("AssetManager: '{}' was not written to the texture disk cache.", canonicalPath);
+    }
+}
+
+/// @brief Writes a freshly decoded texture to the texture disk cache, when this load has one.
+/// @param canonicalPath canonical source path.
+/// @param source source bytes and decoded image.
+/// @param options texture stages of this load.
+void StoreCooked(const sf::Texture &, const std::string &canonicalPath, const PrefetchedAsset &source,
+                 const LoadOptions &options)
+{
+    if (options.textureCache)
+    {
+        StoreCooked(*options.textureCache, canonicalPath, source);
+    }
+}
+
+/// @brief Writes the samples of a freshly decoded and normalized sound to the sound disk cache, so the next run can
+/// skip both the decode and the resampling. Nothing is cached while normalization is off.
+/// @param buffer normalized sound buffer.
+/// @param canonicalPath canonical source path.
+/// @param source source bytes.
+/// @param options sound stages of this load.
+void StoreCooked(const sf::SoundBuffer &buffer, const std::string &canonicalPath, const PrefetchedAsset &source,
+                 const LoadOptions &options)
+{
+    if (!options.soundCache || options.soundSampleRate == 0)
+    {
+        return;
+    }
+
+    if (!options.soundCache->Store(canonicalPath, source.contentHash, source.bytes.size(), buffer.getSampleRate(),
+                                   buffer.getChannelCount(), buffer.getSamples(),
+                                   static_cast<std::size_t>(buffer.getSampleCount())))
+    {
+        CT_LOG_DEBUG("AssetManager: '{}' was not written to the sound disk cache.", canonicalPath);
+    }
+}
+
+/// @brief Fonts are not cooked.
+template <typename T> void StoreCooked(const T &, const std::string &, const PrefetchedAsset &, const LoadOptions &)
+{
+}
+
+/// @brief Shared load path for every resource type. Requests for a path that is already resident, or for a file whose
+/// content matches a resident resource, become aliases instead of a second decode. Work already done by a Prefetch call
+/// is claimed instead of repeated, and textures and sounds found in their disk caches skip both the read and the
+/// decode. Every
+/// request that is not already registered under name is recorded in telemetry.
+/// @param cache destination cache.
+/// @param prefetched results of earlier Prefetch calls.
+/// @param options disk cache, streaming and normalization stages, empty for resource types that have none.
+/// @param telemetry receives the load timings.
+/// @param name index to store.
+/// @param filepath value to store.
+/// @param typeName readable resource type for logging.
+/// @param retainBytes keep the source bytes alive for resources that read from memory lazily (sf::Font).
+/// @return true / false
+template <typename T>
+bool LoadIntoCache(AssetCache<T> &cache, AssetPrefetchStore &prefetched, const LoadOptions &options,
+                   AssetTelemetry &telemetry, const std::string &name, const std::string &filepath, const char *typeName,
+                   bool retainBytes)
+{
+    if (cache.Contains(name))
+    {
+        return true;
+    }
+
+    if (const std::string existing = cache.FindCollision(name); !existing.empty())
+    {
+        CT_LOG_ERROR("AssetManager: {} key '{}' collides with '{}' (same AssetId). Rename one of them.", typeName, name,
+                     existing);
+
+        return false;
+    }
+
+    AssetLoadRecord record;
+    record.name = name;
+    record.type = typeName;
+    record.path = filepath;
+
+    const std::string canonical = CanonicalPath(filepath);
+
+    if (cache.TryAliasPath(name, canonical))
+    {
+        CT_LOG_DEBUG("AssetManager: {} '{}' aliased onto resident '{}'.", typeName, name, canonical);
+
+        record.wasAliased = true;
+        telemetry.Record(std::move(record));
+
+        return true;
+    }
+
+    PrefetchedAsset source;
+    record.wasPrefetched = prefetched.Take(canonical, source);
+
+    if (!record.wasPrefetched)
+    {
+        AssetStopwatch stopwatch;
+
+        if (options.textureCache && options.textureCache->Load(canonical, source.cooked))
+        {
+            source.contentHash = source.cooked.contentHash;
+        }
+        else if (options.soundCache && options.soundSampleRate != 0 &&
+                 options.soundCache->Load(canonical, options.soundSampleRate, source.cookedSound))
+        {
+            source.contentHash = source.cookedSound.contentHash;
+        }
+        else if (!ReadFileBytes(filepath, source.bytes))
+        {
+            CT_LOG_ERROR("Failed to load {}: {}", typeName, filepath);
+
+            return false;
+        }
+        else
+        {
+            source.contentHash = Fnv1a64(source.bytes.data(), source.bytes.size());
+        }
+
+        record.readMs = stopwatch.Restart();
+    }
+
+    record.wasCooked = source.IsCooked();
+    record.bytes = source.GetSourceSize();
+
+    const std::uint64_t hash = source.contentHash;
+
+    if (cache.TryAliasContent(name, canonical, hash))
+    {
+        CT_LOG_DEBUG("AssetManager: {} '{}' content matches a resident {}, aliased.", typeName, name, typeName);
+
+        record.wasAliased = true;
+        telemetry.Record(std::move(record));
+
+        return true;
+    }
+
+    auto resource = std::make_unique<T>();
+
+    if (!DecodeInto(*resource, source, record, options))
+    {
+        CT_LOG_ERROR("Failed to load {}: {}", typeName, filepath);
+
+        return false;
+    }
+
+    T &loaded = *resource;
+
+    // Prefetched images were already written by the worker that decoded them.
+    if (!record.wasPrefetched && !record.wasCooked)
+    {
+        StoreCooked(loaded, canonical, source, options);
+    }
+
+    const std::size_t size = record.bytes;
+    cache.Insert(name, canonical, hash, size, std::move(resource),
+                 retainBytes ? std::move(source.bytes) : std::vector<char>{});
+    cache.FindByPath(canonical)->scene = telemetry.GetScene();
+    StartStreaming(loaded, source, options);
+    telemetry.Record(std::move(record));
+
+    return true;
+}
+
+/// @brief Decodes bytes and uploads them into an existing texture, so sprites pointing at it keep working.
+/// @param texture resident texture.
+/// @param bytes new encoded image.
+/// @return true / false
+bool ReloadInPlace(sf::Texture &texture, const std::vector<char> &bytes, const LoadOptions &)
+{
+    sf::Image image;
+
+    return image.loadFromMemory(bytes.data(), bytes.size()) && texture.loadFromImage(image);
+}
+
+/// @brief Decodes and normalizes bytes and swaps the samples into an existing buffer. SFML stops and detaches every
+/// sound playing the buffer when it is assigned, so callers stop sound effects first.
+/// @param buffer resident sound buffer.
+/// @param bytes new encoded audio.
+/// @param options sound normalization, as for the first load.
+/// @return true / false
+bool ReloadInPlace(sf::SoundBuffer &buffer, const std::vector<char> &bytes, const LoadOptions &options)
+{
+    sf::SoundBuffer decoded;
+
+    if (!decoded.loadFromMemory(bytes.data(), bytes.size()) || !NormalizeSound(decoded, options.soundSampleRate))
+    {
+        return false;
+    }
+
+    buffer = decoded;
+
+    return true;
+}
+
+/// @brief Opens bytes as a font and swaps it into an existing font, so texts pointing at it keep working.
+/// @param font resident font.
+/// @param bytes new font file; the caller must keep them alive as the entry's retained bytes.
+/// @return true / false
+bool ReloadInPlace(sf::Font &font, const std::vector<char> &bytes, const LoadOptions &)
+{
+    sf::Font decoded;
+
+    if (!decoded.loadFromMemory(bytes.data(), bytes.size()))
+    {
+        return false;
+    }
+
+    font = decoded;
+
+    return true;
+}
+
+/// @brief Re-decodes the resource loaded from canonicalPath, if any, in place. Unchanged content is skipped.
+/// @param cache cache that may hold the path.
+/// @param canonicalPath canonical source path.
+/// @param options stages to apply again, as for the first load.
+/// @param typeName readable resource type for logging.
+/// @param retainBytes keep the new source bytes alive (sf::Font).
+/// @return true if the resource was re-decoded.
+template <typename T>
+bool ReloadInCache(AssetCache<T> &cache, const std::string &canonicalPath, const LoadOptions &options,
+                   const char *typeName, bool retainBytes)
+{
+    auto *entry = cache.FindByPath(canonicalPath);
+
+    if (!entry)
+    {
+        return false;
+    }
+
+    std::vector<char> bytes;
+
+    if (!ReadFileBytes(canonicalPath, bytes))
+    {
+        CT_LOG_WARN("AssetManager: could not read changed {} '{}', keeping previous.", typeName, canonicalPath);
+
+        return false;
+    }
+
+    const std::uint64_t hash = Fnv1a64(bytes.data(), bytes.size());
+
+    if (hash == entry->contentHash)
+    {
+        return false;
+    }
+
+    // Names loaded from other files with the same bytes must keep those bytes, so they get a copy of the old resource.
+    std::unique_ptr<T> previous;
+
+    if (cache.HasForeignAliases(*entry))
+    {
+        previous = std::make_unique<T>(*entry->resource);
+    }
+
+    if (!ReloadInPlace(*entry->resource, bytes, options))
+    {
+        CT_LOG_ERROR("AssetManager: failed to decode changed {} '{}', keeping previous.", typeName, canonicalPath);
+
+        return false;
+    }
+
+    cache.Rehash(*entry, hash, bytes.size(), std::move(previous));
+
+    if (retainBytes)
+    {
+        entry->retained = std::move(bytes);
+    }
+
+    CT_LOG_INFO("AssetManager: hot reloaded {} '{}'.", typeName, canonicalPath);
+
+    return true;
+}
 } // namespace
 
 /// @brief Get the current Instance for this AssetManager singleton.
@@ -57,10 +539,16 @@ void AssetManager::Shutdown()
     CT_WARN_IF_UNINITIALIZED("AssetManager", "Shutdown");
 
     CT_LOG_INFO("Clearing asset cache...");
-
-    m_textures.clear();
-    m_sounds.clear();
-    m_fonts.clear();
+    LogCacheReport();
+    LogTelemetrySummary();
+    WriteTelemetryReport(TELEMETRY_REPORT_PATH);
+
+    m_textureStreamer.Clear();
+    m_textures.Clear();
+    m_sounds.Clear();
+    m_fonts.Clear();
+    m_prefetched.Clear();
+    m_telemetry.Clear();
     m_isInitialized = false;
 
     CT_LOG_INFO("AssetManager shutdown.");
@@ -81,23 +569,7 @@ bool AssetManager::LoadFont(const std::string &name, const std::string &filepath
 {
     CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "LoadFont", false);
 
-    if (m_fonts.contains(name))
-    {
-        return true;
-    }
-
-    sf::Font font;
-
-    if (!font.loadFromFile(filepath))
-    {
-        CT_LOG_ERROR("Failed to load font: {}", filepath);
-
-        return false;
-    }
-
-    m_fonts[name] = std::move(font);
-
-    return true;
+    return LoadIntoCache(m_fonts, m_prefetched, LoadOptions{}, m_telemetry, name, filepath, "font", true);
 }
 
 /// @brief Return a pointer to the requested font if it exists in internal storage.
@@ -107,16 +579,44 @@ sf::Font *AssetManager::GetFont(const std::string &name)
 {
     CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "GetFont", nullptr);
 
-    auto it = m_fonts.find(name);
+    sf::Font *font = m_fonts.Find(name);
 
-    if (it == m_fonts.end())
+    if (!font)
     {
         CT_LOG_WARN("Font '{}' not found.", name);
-
-        return nullptr;
     }
 
-    return &it->second;
+    return font;
+}
+
+/// @brief Return a pointer to the requested font by interned id, skipping string hashing entirely.
+/// @param id AssetId built with MakeAssetId.
+/// @return pointer to the font, or nullptr.
+sf::Font *AssetManager::GetFont(AssetId id)
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "GetFont", nullptr);
+
+    return m_fonts.Find(id);
+}
+
+/// @brief Return a pointer to the requested font by dense handle. This is the cheapest lookup available.
+/// @param handle handle from GetFontHandle.
+/// @return pointer to the font, or nullptr if the handle is stale.
+sf::Font *AssetManager::GetFont(AssetHandle handle)
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "GetFont", nullptr);
+
+    return m_fonts.Get(handle);
+}
+
+/// @brief Resolves an interned id to a dense handle, meant to be done once outside the hot path.
+/// @param id AssetId built with MakeAssetId.
+/// @return valid handle, or an invalid one if the font has not been loaded.
+AssetHandle AssetManager::GetFontHandle(AssetId id) const
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "GetFontHandle", AssetHandle{});
+
+    return m_fonts.GetHandle(id);
 }
 
 /// @brief Load the requested texture into internal storage for later use by name index.
@@ -127,23 +627,38 @@ bool AssetManager::LoadTexture(const std::string &name, const std::string &filep
 {
     CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "LoadTexture", false);
 
-    if (m_textures.contains(name))
-    {
-        return true;
-    }
+    return LoadIntoCache(m_textures, m_prefetched, LoadOptions{&m_textureDiskCache, nullptr}, m_telemetry, name,
+                         filepath, "texture", false);
+}
 
-    sf::Texture texture;
+/// @brief Loads a texture like LoadTexture, but a large image is only created here and its pixels are uploaded in
+/// slices by PumpTextureUploads over the following frames. Until then GetTextureStreamer().GetProxy returns a low
+/// resolution stand-in to draw.
+/// @param name index to store.
+/// @param filepath value to store.
+/// @return true / false
+bool AssetManager::LoadTextureStreamed(const std::string &name, const std::string &filepath)
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "LoadTextureStreamed", false);
 
-    if (!texture.loadFromFile(filepath))
-    {
-        CT_LOG_ERROR("Failed to load texture: {}", filepath);
+    return LoadIntoCache(m_textures, m_prefetched, LoadOptions{&m_textureDiskCache, &m_textureStreamer},
+                         m_telemetry, name, filepath, "texture", false);
+}
 
-        return false;
-    }
+/// @brief Uploads slices of streamed textures, within a time budget. Call once per frame on the main thread.
+/// @param budgetMs time allowed this frame, in milliseconds.
+void AssetManager::PumpTextureUploads(float budgetMs)
+{
+    CT_WARN_IF_UNINITIALIZED("AssetManager", "PumpTextureUploads");
 
-    m_textures[name] = std::move(texture);
+    m_textureStreamer.Pump(budgetMs);
+}
 
-    return true;
+/// @brief Returns the streamer, to ask whether a texture is complete or get its proxy.
+/// @return m_textureStreamer.
+const TextureStreamer &AssetManager::GetTextureStreamer() const
+{
+    return m_textureStreamer;
 }
 
 /// @brief Return a pointer to the requested texture if it exists in internal storage.
@@ -153,19 +668,50 @@ sf::Texture *AssetManager::GetTexture(const std::string &name)
 {
     CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "GetTexture", nullptr);
 
-    auto it = m_textures.find(name);
+    sf::Texture *texture = m_textures.Find(name);
 
-    if (it == m_textures.end())
+    if (!texture)
     {
         CT_LOG_WARN("Texture '{}' not found.", name);
-
-        return nullptr;
     }
 
-    return &it->second;
+    return texture;
 }
 
-/// @brief Load the requested sound into internal storage for later use by name index.
+/// @brief Return a pointer to the requested texture by interned id, skipping string hashing entirely.
+/// @param id AssetId built with MakeAssetId.
+/// @return pointer to the texture, or nullptr.
+sf::Texture *AssetManager::GetTexture(AssetId id)
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "GetTexture", nullptr);
+
+    return m_textures.Find(id);
+}
+
+/// @brief Return a pointer to the requested texture by dense handle. This is the cheapest lookup available.
+/// @param handle handle from GetTextureHandle.
+/// @return pointer to the texture, or nullptr if the handle is stale.
+sf::Texture *AssetManager::GetTexture(AssetHandle handle)
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "GetTexture", nullptr);
+
+    return m_textures.Get(handle);
+}
+
+/// @brief Resolves an interned id to a dense handle, meant to be done once outside the hot path.
+/// @param id AssetId built with MakeAssetId.
+/// @return valid handle, or an invalid one if the texture has not been loaded.
+AssetHandle AssetManager::GetTextureHandle(AssetId id) const
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "GetTextureHandle", AssetHandle{});
+
+    return m_textures.GetHandle(id);
+}
+
+/// @brief Load the requested sound into internal storage for later use by name index. A WAV path is transparently
+/// swapped for its imported OGG / FLAC version when one is up to date. The decoded samples are resampled to the sound
+/// sample rate, and down mixed to mono when both channels carry the same signal; the result is kept in the sound disk
+/// cache for the next run.
 /// @param name index to store.
 /// @param filepath value to store.
 /// @return true / false
@@ -173,22 +719,23 @@ bool AssetManager::LoadSound(const std::string &name, const std::string &filepat
 {
     CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "LoadSound", false);
 
-    if (m_sounds.contains(name))
+    const LoadOptions options{nullptr, nullptr, &m_soundDiskCache, m_soundSampleRate};
+
+    if (!LoadIntoCache(m_sounds, m_prefetched, options, m_telemetry, name, AudioImporter::ResolveSource(filepath),
+                       "sound", false))
     {
-        return true;
+        return false;
     }
 
-    sf::SoundBuffer buffer;
+    const sf::SoundBuffer *buffer = m_sounds.Find(name);
 
-    if (!buffer.loadFromFile(filepath))
+    if (buffer && AudioImporter::ShouldStream(buffer->getDuration().asSeconds()))
     {
-        CT_LOG_ERROR("Failed to load sound: {}", filepath);
-
-        return false;
+        CT_LOG_WARN("AssetManager: sound '{}' is {:.1f}s and fully decoded in memory. Long tracks should stream "
+                    "through AudioManager::PlayMusic.",
+                    name, buffer->getDuration().asSeconds());
     }
 
-    m_sounds[name] = std::move(buffer);
-
     return true;
 }
 
@@ -199,14 +746,256 @@ sf::SoundBuffer *AssetManager::GetSound(const std::string &name)
 {
     CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "GetSound", nullptr);
 
-    auto it = m_sounds.find(name);
+    sf::SoundBuffer *sound = m_sounds.Find(name);
 
-    if (it == m_sounds.end())
+    if (!sound)
     {
-        CT_LOG_WARN("Texture '{}' not found.", name);
+        CT_LOG_WARN("Sound '{}' not found.", name);
+    }
 
-        return nullptr;
+    return sound;
+}
+
+/// @brief Return a pointer to the requested sound by interned id, skipping string hashing entirely.
+/// @param id AssetId built with MakeAssetId.
+/// @return pointer to the sound, or nullptr.
+sf::SoundBuffer *AssetManager::GetSound(AssetId id)
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "GetSound", nullptr);
+
+    return m_sounds.Find(id);
+}
+
+/// @brief Return a pointer to the requested sound by dense handle. This is the cheapest lookup available.
+/// @param handle handle from GetSoundHandle.
+/// @return pointer to the sound, or nullptr if the handle is stale.
+sf::SoundBuffer *AssetManager::GetSound(AssetHandle handle)
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "GetSound", nullptr);
+
+    return m_sounds.Get(handle);
+}
+
+/// @brief Resolves an interned id to a dense handle, meant to be done once outside the hot path.
+/// @param id AssetId built with MakeAssetId.
+/// @return valid handle, or an invalid one if the sound has not been loaded.
+AssetHandle AssetManager::GetSoundHandle(AssetId id) const
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "GetSoundHandle", AssetHandle{});
+
+    return m_sounds.GetHandle(id);
+}
+
+/// @brief Reads and decodes an image ahead of its LoadTexture call, leaving only the GPU upload for the main thread.
+/// An image found in the texture disk cache is only mapped; a decoded one is written to it. Safe to call from any
+/// thread once the AssetManager is initialized.
+/// @param filepath image file that will be loaded later.
+/// @return true / false
+bool AssetManager::PrefetchTexture(const std::string &filepath)
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "PrefetchTexture", false);
+
+    const std::string canonical = CanonicalPath(filepath);
+    PrefetchedAsset asset;
+
+    if (m_textureDiskCache.Load(canonical, asset.cooked))
+    {
+        asset.contentHash = asset.cooked.contentHash;
+        m_prefetched.Put(canonical, std::move(asset));
+
+        return true;
     }
 
-    return &it->second;
+    if (!ReadFileBytes(filepath, asset.bytes) || !asset.image.loadFromMemory(asset.bytes.data(), asset.bytes.size()))
+    {
+        CT_LOG_WARN("AssetManager: failed to prefetch texture '{}'.", filepath);
+
+        return false;
+    }
+
+    asset.contentHash = Fnv1a64(asset.bytes.data(), asset.bytes.size());
+    asset.isDecoded = true;
+    StoreCooked(m_textureDiskCache, canonical, asset);
+    m_prefetched.Put(canonical, std::move(asset));
+
+    return true;
+}
+
+/// @brief Reads a font file ahead of its LoadFont call. Opening the face is cheap and stays with the load; glyphs are
+/// rasterized on first use. Safe to call from any thread once the AssetManager is initialized.
+/// @param filepath font file that will be loaded later.
+/// @return true / false
+bool AssetManager::PrefetchFont(const std::string &filepath)
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "PrefetchFont", false);
+
+    PrefetchedAsset asset;
+
+    if (!ReadFileBytes(filepath, asset.bytes))
+    {
+        CT_LOG_WARN("AssetManager: failed to prefetch font '{}'.", filepath);
+
+        return false;
+    }
+
+    asset.contentHash = Fnv1a64(asset.bytes.data(), asset.bytes.size());
+    m_prefetched.Put(CanonicalPath(filepath), std::move(asset));
+
+    return true;
+}
+
+/// @brief Re-decodes every resident resource that was loaded from filepath, keeping the same objects so existing
+/// sprites, texts and sounds see the new content. Files that are not resident are ignored.
+/// @param filepath changed file.
+/// @return true if anything was reloaded.
+bool AssetManager::ReloadFromDisk(const std::string &filepath)
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AssetManager", "ReloadFromDisk", false);
+
+    const std::string canonical = CanonicalPath(filepath);
+
+    // A streaming texture would otherwise get its old rows uploaded over the reloaded image.
+    m_textureStreamer.Flush();
+
+    bool reloaded = ReloadInCache(m_textures, canonical, LoadOptions{}, "texture", false);
+    reloaded |= ReloadInCache(m_sounds, canonical, LoadOptions{nullptr, nullptr, &m_soundDiskCache, m_soundSampleRate},
+                              "sound", false);
+    reloaded |= ReloadInCache(m_fonts, canonical, LoadOptions{}, "font", true);
+
+    return reloaded;
+}
+
+/// @brief Returns the on disk decoded texture cache, to disable it or move its directory before loading.
+/// @return m_textureDiskCache.
+TextureDiskCache &AssetManager::GetTextureDiskCache()
+{
+    return m_textureDiskCache;
+}
+
+/// @brief Returns the on disk normalized sound cache, to disable it or move its directory before loading.
+/// @return m_soundDiskCache.
+SoundDiskCache &AssetManager::GetSoundDiskCache()
+{
+    return m_soundDiskCache;
+}
+
+/// @brief Sets the rate sounds are resampled to when they load, normally the rate of the audio device and the
+/// software mixer. Sounds already resident keep their rate. Not synchronized; set it before any load.
+/// @param sampleRate frames per second, or 0 to keep every sound as decoded.
+void AssetManager::SetSoundSampleRate(unsigned int sampleRate)
+{
+    m_soundSampleRate = sampleRate;
+}
+
+/// @brief Returns the rate sounds are resampled to when they load.
+/// @return m_soundSampleRate.
+unsigned int AssetManager::GetSoundSampleRate() const
+{
+    return m_soundSampleRate;
+}
+
+/// @brief Combines the content addressed cache statistics for textures, sounds and fonts.
+/// @return summed AssetCacheReport.
+AssetCacheReport AssetManager::GetCacheReport() const
+{
+    AssetCacheReport report = m_textures.Report();
+    report += m_sounds.Report();
+    report += m_fonts.Report();
+
+    return report;
+}
+
+/// @brief Writes the aliasing and deduplication figures for each resource type to the log.
+void AssetManager::LogCacheReport() const
+{
+    const auto logOne = [](const char *type, const AssetCacheReport &report)
+    {
+        CT_LOG_INFO("AssetCache [{}]: {} unique, {} aliases, {} deduped loads, {} bytes resident, {} bytes deduped.",
+                    type, report.uniqueResources, report.aliasCount, report.dedupedLoads, report.residentBytes,
+                    report.dedupedBytes);
+    };
+
+    logOne("Textures", m_textures.Report());
+    logOne("Sounds", m_sounds.Report());
+    logOne("Fonts", m_fonts.Report());
+}
+
+/// @brief Estimates the memory of every resident texture, sound and font. Figures are computed on each call, so font
+/// glyph pages that grew since the load are included.
+/// @return AssetMemoryReport
+AssetMemoryReport AssetManager::GetMemoryReport() const
+{
+    AssetMemoryReport report;
+
+    const auto makeRecord = [](const char *type, const auto &entry, const AssetMemoryUsage &usage)
+    {
+        AssetMemoryRecord record;
+        record.type = type;
+        record.path = entry.canonicalPath;
+        record.scene = entry.scene;
+        record.aliases = entry.aliases;
+        record.usage = usage;
+
+        return record;
+    };
+
+    // No texture loaded through the AssetManager generates a mipmap.
+    m_textures.ForEachEntry([&](const auto &entry)
+                            { report.Add(makeRecord("texture", entry, EstimateAssetMemory(*entry.resource, false))); });
+
+    m_sounds.ForEachEntry([&](const auto &entry)
+                          { report.Add(makeRecord("sound", entry, EstimateAssetMemory(*entry.resource))); });
+
+    m_fonts.ForEachEntry(
+        [&](const auto &entry)
+        {
+            const auto sizes = GlyphCache::Instance().GetWarmSizes(*entry.resource);
+            report.Add(makeRecord("font", entry, EstimateAssetMemory(*entry.resource, entry.retained.size(), sizes)));
+        });
+
+    return report;
+}
+
+/// @brief Writes the memory totals per type and per scene to the log.
+/// @param context what triggered the dump, e.g. the scene being pushed.
+void AssetManager::LogMemoryReport(const std::string &context) const
+{
+    CT_WARN_IF_UNINITIALIZED("AssetManager", "LogMemoryReport");
+
+    GetMemoryReport().Log(context);
+}
+
+/// @brief Attributes every following load to scene. Called by the SceneManager before a scene initializes.
+/// @param scene readable scene name.
+void AssetManager::SetLoadingScene(const std::string &scene)
+{
+    m_telemetry.SetScene(scene);
+}
+
+/// @brief Returns the load timings recorded since initialization.
+/// @return m_telemetry.
+const AssetTelemetry &AssetManager::GetTelemetry() const
+{
+    return m_telemetry;
+}
+
+/// @brief Writes the load timings, slowest first, as JSON. Also done automatically at shutdown.
+/// @param filepath destination file.
+/// @return true / false
+bool AssetManager::WriteTelemetryReport(const std::string &filepath) const
+{
+    const bool written = m_telemetry.WriteJson(filepath);
+
+    if (written)
+    {
+        CT_LOG_INFO("AssetManager: load telemetry written to '{}'.", filepath);
+    }
+
+    return written;
+}
+
+/// @brief Logs per scene load totals and the slowest loads.
+void AssetManager::LogTelemetrySummary() const
+{
+    m_telemetry.LogSummary(TELEMETRY_SUMMARY_COUNT);
 }
@@ -12,11 +12,19 @@
 
 #pragma once
 
+#include "AssetCache.h"
+#include "AssetId.h"
+#include "AssetMemory.h"
+#include "AssetPrefetch.h"
+#include "AssetTelemetry.h"
 #include "Settings.h"
+#include "SoundDiskCache.h"
+#include "TextureDiskCache.h"
+#include "TextureStreamer.h"
 #include <SFML/Audio.hpp>
 #include <SFML/Graphics.hpp>
+#include <memory>
 #include <string>
-#include <unordered_map>
 
 // ============================================================================
 //  Class       : AssetManager
@@ -25,6 +33,16 @@
 //  Responsibilities:
 //      - Initializes and shuts down
 //      - Returns fonts, textures, and sounds in cache
+//      - Deduplicates identical files requested under different names
+//      - Resolves interned AssetIds to dense handles for hot path lookups
+//      - Reloads changed files in place for hot reloading
+//      - Times every load and reports it per asset and per scene
+//      - Estimates CPU and GPU memory per asset, type and scene
+//      - Accepts file reads and image decodes prefetched on worker threads
+//      - Keeps decoded textures on disk so later runs skip the image decode
+//      - Streams large textures to the GPU over several frames
+//      - Normalizes sounds to the device rate, and to mono where stereo
+//        adds nothing, and keeps the result on disk
 //
 // ============================================================================
 class AssetManager
@@ -39,12 +57,47 @@ class AssetManager
 
     bool LoadFont(const std::string &name, const std::string &filepath);
     sf::Font *GetFont(const std::string &name);
+    sf::Font *GetFont(AssetId id);
+    sf::Font *GetFont(AssetHandle handle);
+    AssetHandle GetFontHandle(AssetId id) const;
 
     bool LoadTexture(const std::string &name, const std::string &filepath);
     sf::Texture *GetTexture(const std::string &name);
+    sf::Texture *GetTexture(AssetId id);
+    sf::Texture *GetTexture(AssetHandle handle);
+    AssetHandle GetTextureHandle(AssetId id) const;
+
+    bool LoadTextureStreamed(const std::string &name, const std::string &filepath);
+    void PumpTextureUploads(float budgetMs);
+    const TextureStreamer &GetTextureStreamer() const;
 
     bool LoadSound(const std::string &name, const std::string &filepath);
     sf::SoundBuffer *GetSound(const std::string &name);
+    sf::SoundBuffer *GetSound(AssetId id);
+    sf::SoundBuffer *GetSound(AssetHandle handle);
+    AssetHandle GetSoundHandle(AssetId id) const;
+
+    bool PrefetchTexture(const std::string &filepath);
+    bool PrefetchFont(const std::string &filepath);
+
+    bool ReloadFromDisk(const std::string &filepath);
+
+    TextureDiskCache &GetTextureDiskCache();
+    SoundDiskCache &GetSoundDiskCache();
+
+    void SetSoundSampleRate(unsigned int sampleRate);
+    unsigned int GetSoundSampleRate() const;
+
+    AssetCacheReport GetCacheReport() const;
+    void LogCacheReport() const;
+
+    AssetMemoryReport GetMemoryReport() const;
+    void LogMemoryReport(const std::string &context) const;
+
+    void SetLoadingScene(const std::string &scene);
+    const AssetTelemetry &GetTelemetry() const;
+    bool WriteTelemetryReport(const std::string &filepath) const;
+    void LogTelemetrySummary() const;
 
   private:
     AssetManager() = default;
@@ -54,11 +107,20 @@ class AssetManager
     AssetManager &operator=(const AssetManager &) = delete;
 
   private:
-    std::unordered_map<std::string, sf::Texture> m_textures;
-    std::unordered_map<std::string, sf::SoundBuffer> m_sounds;
-    std::unordered_map<std::string, sf::Font> m_fonts;
+    AssetCache<sf::Texture> m_textures;
+    AssetCache<sf::SoundBuffer> m_sounds;
+    AssetCache<sf::Font> m_fonts;
+
+    AssetPrefetchStore m_prefetched;
+    TextureDiskCache m_textureDiskCache;
+    SoundDiskCache m_soundDiskCache;
+    TextureStreamer m_textureStreamer;
+    AssetTelemetry m_telemetry;
 
     std::shared_ptr<const Settings> m_settings;
 
+    /// @brief Matches the SoftwareMixer and the usual OpenAL device rate.
+    unsigned int m_soundSampleRate = 44100;
+
     bool m_isInitialized = false;
 };
@@ -0,0 +1,240 @@
+// ============================================================================
+//  File        : AssetMemory.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-11
+//  Description : Estimated CPU and GPU memory held by resident assets, with
+//                totals per resource type, per scene and per asset.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "AssetMemory.h"
+#include "Macros.h"
+#include <algorithm>
+
+namespace
+{
+/// @brief Bytes per RGBA8 texel.
+constexpr std::size_t BYTES_PER_TEXEL = 4;
+
+/// @brief Bytes per sample held by sf::SoundBuffer.
+constexpr std::size_t BYTES_PER_SAMPLE = sizeof(sf::Int16);
+
+/// @brief Bytes in one mebibyte, for log output.
+constexpr double BYTES_PER_MIB = 1024.0 * 1024.0;
+
+/// @brief Converts bytes to mebibytes for log output.
+/// @param bytes byte count.
+/// @return size in MiB.
+double ToMiB(std::size_t bytes)
+{
+    return static_cast<double>(bytes) / BYTES_PER_MIB;
+}
+} // namespace
+
+/// @brief Returns the GPU bytes of an RGBA8 texture, including every mip level below the base when it has a mipmap.
+/// @param size base level size in texels.
+/// @param hasMipmap whether generateMipmap was called on the texture.
+/// @return estimated bytes.
+std::size_t EstimateTextureBytes(const sf::Vector2u &size, bool hasMipmap)
+{
+    std::size_t bytes = static_cast<std::size_t>(size.x) * size.y * BYTES_PER_TEXEL;
+
+    if (!hasMipmap || bytes == 0)
+    {
+        return bytes;
+    }
+
+    unsigned int width = size.x;
+    unsigned int height = size.y;
+
+    while (width > 1 || height > 1)
+    {
+        width = std::max(1u, width / 2);
+        height = std::max(1u, height / 2);
+        bytes += static_cast<std::size_t>(width) * height * BYTES_PER_TEXEL;
+    }
+
+    return bytes;
+}
+
+/// @brief Estimates a texture. SFML keeps no pixel copy on the CPU, so it is all GPU memory.
+/// @param texture resident texture.
+/// @param hasMipmap whether generateMipmap was called on the texture.
+/// @return estimated usage.
+AssetMemoryUsage EstimateAssetMemory(const sf::Texture &texture, bool hasMipmap)
+{
+    AssetMemoryUsage usage;
+    usage.gpuBytes = EstimateTextureBytes(texture.getSize(), hasMipmap);
+    usage.assetCount = 1;
+
+    return usage;
+}
+
+/// @brief Estimates a sound buffer: 16 bit samples for every frame of every channel, held by SFML. The copy inside
+/// the audio driver is not counted.
+/// @param buffer resident sound buffer.
+/// @return estimated usage.
+AssetMemoryUsage EstimateAssetMemory(const sf::SoundBuffer &buffer)
+{
+    // getSampleCount already spans every channel: it is frames * channels.
+    AssetMemoryUsage usage;
+    usage.cpuBytes = static_cast<std::size_t>(buffer.getSampleCount()) * BYTES_PER_SAMPLE;
+    usage.assetCount = 1;
+
+    return usage;
+}
+
+/// @brief Estimates a font: the source file kept alive for FreeType, and the glyph page of every character size that
+/// was rasterized.
+/// @param font resident font.
+/// @param retainedBytes size of the source bytes the font streams from.
+/// @param glyphSizes character sizes with glyphs on a page; other sizes are skipped since querying them would create
+/// their page.
+/// @return estimated usage.
+AssetMemoryUsage EstimateAssetMemory(const sf::Font &font, std::size_t retainedBytes,
+                                     const std::vector<unsigned int> &glyphSizes)
+{
+    AssetMemoryUsage usage;
+    usage.cpuBytes = retainedBytes;
+    usage.assetCount = 1;
+
+    for (unsigned int size : glyphSizes)
+    {
+        usage.gpuBytes += EstimateTextureBytes(font.getTexture(size).getSize(), false);
+    }
+
+    return usage;
+}
+
+/// @brief Adds one resident resource to the report.
+/// @param record resource and its estimated usage.
+void AssetMemoryReport::Add(AssetMemoryRecord record)
+{
+    m_records.push_back(std::move(record));
+}
+
+/// @brief Returns every resident resource, in the order they were added.
+/// @return m_records.
+const std::vector<AssetMemoryRecord> &AssetMemoryReport::GetRecords() const
+{
+    return m_records;
+}
+
+/// @brief Returns the resource an alias resolves to.
+/// @param name alias the asset was loaded under.
+/// @return record, or nullptr if no resource has that alias.
+const AssetMemoryRecord *AssetMemoryReport::FindAsset(const std::string &name) const
+{
+    for (const auto &record : m_records)
+    {
+        if (std::find(record.aliases.begin(), record.aliases.end(), name) != record.aliases.end())
+        {
+            return &record;
+        }
+    }
+
+    return nullptr;
+}
+
+/// @brief Returns the usage summed over every resource.
+/// @return AssetMemoryUsage
+AssetMemoryUsage AssetMemoryReport::GetTotal() const
+{
+    AssetMemoryUsage total;
+
+    for (const auto &record : m_records)
+    {
+        total += record.usage;
+    }
+
+    return total;
+}
+
+/// @brief Returns the usage summed over one resource type.
+/// @param type "texture", "sound" or "font".
+/// @return AssetMemoryUsage
+AssetMemoryUsage AssetMemoryReport::GetByType(const std::string &type) const
+{
+    AssetMemoryUsage total;
+
+    for (const auto &record : m_records)
+    {
+        if (record.type == type)
+        {
+            total += record.usage;
+        }
+    }
+
+    return total;
+}
+
+/// @brief Returns the usage summed over the resources first loaded by one scene.
+/// @param scene scene name, as given to AssetManager::SetLoadingScene.
+/// @return AssetMemoryUsage
+AssetMemoryUsage AssetMemoryReport::GetByScene(const std::string &scene) const
+{
+    AssetMemoryUsage total;
+
+    for (const auto &record : m_records)
+    {
+        if (record.scene == scene)
+        {
+            total += record.usage;
+        }
+    }
+
+    return total;
+}
+
+/// @brief Returns the usage of every resource type.
+/// @return map of type to usage.
+std::map<std::string, AssetMemoryUsage> AssetMemoryReport::GroupByType() const
+{
+    std::map<std::string, AssetMemoryUsage> groups;
+
+    for (const auto &record : m_records)
+    {
+        groups[record.type] += record.usage;
+    }
+
+    return groups;
+}
+
+/// @brief Returns the usage of every scene that loaded a resident resource.
+/// @return map of scene to usage.
+std::map<std::string, AssetMemoryUsage> AssetMemoryReport::GroupByScene() const
+{
+    std::map<std::string, AssetMemoryUsage> groups;
+
+    for (const auto &record : m_records)
+    {
+        groups[record.scene] += record.usage;
+    }
+
+    return groups;
+}
+
+/// @brief Writes the total, per type and per scene figures to the log.
+/// @param context what triggered the dump, e.g. the scene being pushed.
+void AssetMemoryReport::Log(const std::string &context) const
+{
+    const AssetMemoryUsage total = GetTotal();
+
+    CT_LOG_INFO("AssetMemory ({}): {} assets, {:.2f} MiB CPU, {:.2f} MiB GPU.", context, total.assetCount,
+                ToMiB(total.cpuBytes), ToMiB(total.gpuBytes));
+
+    for (const auto &[type, usage] : GroupByType())
+    {
+        CT_LOG_INFO("AssetMemory [{}]: {} assets, {:.2f} MiB CPU, {:.2f} MiB GPU.", type, usage.assetCount,
+                    ToMiB(usage.cpuBytes), ToMiB(usage.gpuBytes));
+    }
+
+    for (const auto &[scene, usage] : GroupByScene())
+    {
+        CT_LOG_INFO("AssetMemory [{}]: {} assets, {:.2f} MiB CPU, {:.2f} MiB GPU.", scene, usage.assetCount,
+                    ToMiB(usage.cpuBytes), ToMiB(usage.gpuBytes));
+    }
+}
@@ -0,0 +1,92 @@
+// ============================================================================
+//  File        : AssetMemory.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-11
+//  Description : Estimated CPU and GPU memory held by resident assets, with
+//                totals per resource type, per scene and per asset.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+/// @brief Estimated bytes held by one asset, or summed over several.
+struct AssetMemoryUsage
+{
+    std::size_t cpuBytes = 0;
+    std::size_t gpuBytes = 0;
+    std::size_t assetCount = 0;
+
+    std::size_t TotalBytes() const
+    {
+        return cpuBytes + gpuBytes;
+    }
+
+    AssetMemoryUsage &operator+=(const AssetMemoryUsage &other)
+    {
+        cpuBytes += other.cpuBytes;
+        gpuBytes += other.gpuBytes;
+        assetCount += other.assetCount;
+
+        return *this;
+    }
+};
+
+/// @brief One resident resource and every alias that resolves to it.
+struct AssetMemoryRecord
+{
+    std::string type;
+    std::string path;
+    std::string scene;
+    std::vector<std::string> aliases;
+
+    AssetMemoryUsage usage;
+};
+
+std::size_t EstimateTextureBytes(const sf::Vector2u &size, bool hasMipmap);
+AssetMemoryUsage EstimateAssetMemory(const sf::Texture &texture, bool hasMipmap);
+AssetMemoryUsage EstimateAssetMemory(const sf::SoundBuffer &buffer);
+AssetMemoryUsage EstimateAssetMemory(const sf::Font &font, std::size_t retainedBytes,
+                                     const std::vector<unsigned int> &glyphSizes);
+
+// ============================================================================
+//  Class       : AssetMemoryReport
+//  Purpose     : Snapshot of what resident assets cost, built on demand by
+//                the AssetManager.
+//
+//  Responsibilities:
+//      - Holds one record per resident resource
+//      - Sums records per type, per scene and overall
+//      - Finds the record behind any alias
+//      - Writes the figures to the log
+//
+// ============================================================================
+class AssetMemoryReport
+{
+  public:
+    void Add(AssetMemoryRecord record);
+
+    const std::vector<AssetMemoryRecord> &GetRecords() const;
+    const AssetMemoryRecord *FindAsset(const std::string &name) const;
+
+    AssetMemoryUsage GetTotal() const;
+    AssetMemoryUsage GetByType(const std::string &type) const;
+    AssetMemoryUsage GetByScene(const std::string &scene) const;
+
+    std::map<std::string, AssetMemoryUsage> GroupByType() const;
+    std::map<std::string, AssetMemoryUsage> GroupByScene() const;
+
+    void Log(const std::string &context) const;
+
+  private:
+    std::vector<AssetMemoryRecord> m_records;
+};
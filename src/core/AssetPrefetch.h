@@ -0,0 +1,113 @@
+// ============================================================================
+//  File        : AssetPrefetch.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-07
+//  Description : Thread safe hand off of asset work done ahead of time on
+//                worker threads (file read, hashing, image decode) to the
+//                main thread load path.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include "SoundDiskCache.h"
+#include "TextureDiskCache.h"
+#include <SFML/Graphics/Image.hpp>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// @brief Source bytes of an asset, plus whatever could be decoded without a GL context.
+struct PrefetchedAsset
+{
+    std::vector<char> bytes;
+    std::uint64_t contentHash = 0;
+
+    /// @brief Decoded pixels for textures; only the GPU upload is left for the main thread.
+    sf::Image image;
+    bool isDecoded = false;
+
+    /// @brief Pixels mapped from the TextureDiskCache; when valid, bytes and image are left empty.
+    CookedTexture cooked;
+
+    /// @brief Samples mapped from the SoundDiskCache; when valid, bytes are left empty.
+    CookedSound cookedSound;
+
+    bool IsCooked() const
+    {
+        return cooked.IsValid() || cookedSound.IsValid();
+    }
+
+    /// @brief Size of the source file, whether its bytes were read or a cache entry stood in for them.
+    std::size_t GetSourceSize() const
+    {
+        return cooked.IsValid() ? cooked.sourceSize : cookedSound.IsValid() ? cookedSound.sourceSize : bytes.size();
+    }
+};
+
+// ============================================================================
+//  Class       : AssetPrefetchStore
+//  Purpose     : Holds prefetched assets by canonical path until the main
+//                thread load claims them.
+//
+//  Responsibilities:
+//      - Accepts results from any thread
+//      - Hands each result out exactly once
+//
+// ============================================================================
+class AssetPrefetchStore
+{
+  public:
+    /// @brief Stores a prefetched asset, replacing an older one for the same path.
+    /// @param canonicalPath canonical source path.
+    /// @param asset prefetched bytes and decode.
+    void Put(const std::string &canonicalPath, PrefetchedAsset asset)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_assets[canonicalPath] = std::move(asset);
+    }
+
+    /// @brief Removes and returns the prefetched asset for a path.
+    /// @param canonicalPath canonical source path.
+    /// @param asset receives the prefetched data.
+    /// @return true if the path had been prefetched.
+    bool Take(const std::string &canonicalPath, PrefetchedAsset &asset)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_assets.find(canonicalPath);
+
+        if (it == m_assets.end())
+        {
+            return false;
+        }
+
+        asset = std::move(it->second);
+        m_assets.erase(it);
+
+        return true;
+    }
+
+    /// @brief Returns how many prefetched assets are still unclaimed.
+    /// @return count.
+    std::size_t Size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_assets.size();
+    }
+
+    /// @brief Drops every unclaimed asset.
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_assets.clear();
+    }
+
+  private:
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, PrefetchedAsset> m_assets;
+};
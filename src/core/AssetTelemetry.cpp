@@ -0,0 +1,214 @@
+// ============================================================================
+//  File        : AssetTelemetry.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-06
+//  Description : Per asset load timings collected by the AssetManager, with
+//                a sorted JSON report and a log summary.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "AssetTelemetry.h"
+#include "Macros.h"
+#include "nlohmann/json.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+
+using json = nlohmann::json;
+
+namespace
+{
+/// @brief Time and bytes summed over a group of loads.
+struct LoadTotals
+{
+    double readMs = 0.0;
+    double decodeMs = 0.0;
+    double uploadMs = 0.0;
+    std::size_t bytes = 0;
+    std::size_t count = 0;
+
+    void Add(const AssetLoadRecord &record)
+    {
+        readMs += record.readMs;
+        decodeMs += record.decodeMs;
+        uploadMs += record.uploadMs;
+        bytes += record.bytes;
+        ++count;
+    }
+
+    double TotalMs() const
+    {
+        return readMs + decodeMs + uploadMs;
+    }
+};
+
+/// @brief Serializes a group total.
+/// @param totals summed loads.
+/// @return json object.
+json ToJson(const LoadTotals &totals)
+{
+    return json{{"count", totals.count},       {"bytes", totals.bytes},
+                {"total_ms", totals.TotalMs()}, {"read_ms", totals.readMs},
+                {"decode_ms", totals.decodeMs}, {"upload_ms", totals.uploadMs}};
+}
+} // namespace
+
+/// @brief Sets the scene that subsequent loads are attributed to.
+/// @param scene readable scene name.
+void AssetTelemetry::SetScene(const std::string &scene)
+{
+    m_scene = scene;
+}
+
+/// @brief Returns the scene that loads are currently attributed to.
+/// @return m_scene.
+const std::string &AssetTelemetry::GetScene() const
+{
+    return m_scene;
+}
+
+/// @brief Stores a finished load, tagged with the current scene.
+/// @param record timings and size of the load.
+void AssetTelemetry::Record(AssetLoadRecord record)
+{
+    record.scene = m_scene;
+    m_records.push_back(std::move(record));
+}
+
+/// @brief Returns every load in the order it happened.
+/// @return m_records.
+const std::vector<AssetLoadRecord> &AssetTelemetry::GetRecords() const
+{
+    return m_records;
+}
+
+/// @brief Returns every load, slowest first.
+/// @return sorted copy of the records.
+std::vector<AssetLoadRecord> AssetTelemetry::GetSortedRecords() const
+{
+    std::vector<AssetLoadRecord> sorted = m_records;
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const AssetLoadRecord &a, const AssetLoadRecord &b) { return a.TotalMs() > b.TotalMs(); });
+
+    return sorted;
+}
+
+/// @brief Returns the time spent in every recorded load.
+/// @return milliseconds.
+double AssetTelemetry::GetTotalMs() const
+{
+    double total = 0.0;
+
+    for (const auto &record : m_records)
+    {
+        total += record.TotalMs();
+    }
+
+    return total;
+}
+
+/// @brief Writes the loads, slowest first, plus per scene and per type totals as JSON.
+/// @param filepath destination file; its directory is created if needed.
+/// @return true / false
+bool AssetTelemetry::WriteJson(const std::string &filepath) const
+{
+    std::map<std::string, LoadTotals> byScene;
+    std::map<std::string, LoadTotals> byType;
+    json loads = json::array();
+
+    for (const auto &record : GetSortedRecords())
+    {
+        byScene[record.scene].Add(record);
+        byType[record.type].Add(record);
+
+        loads.push_back({{"name", record.name},
+                         {"type", record.type},
+                         {"path", record.path},
+                         {"scene", record.scene},
+                         {"bytes", record.bytes},
+                         {"aliased", record.wasAliased},
+                         {"prefetched", record.wasPrefetched},
+                         {"cooked", record.wasCooked},
+                         {"total_ms", record.TotalMs()},
+                         {"read_ms", record.readMs},
+                         {"decode_ms", record.decodeMs},
+                         {"upload_ms", record.uploadMs}});
+    }
+
+    json report;
+    report["total_ms"] = GetTotalMs();
+    report["loads"] = std::move(loads);
+
+    for (const auto &[scene, totals] : byScene)
+    {
+        report["scenes"][scene] = ToJson(totals);
+    }
+
+    for (const auto &[type, totals] : byType)
+    {
+        report["types"][type] = ToJson(totals);
+    }
+
+    const std::filesystem::path path(filepath);
+    std::error_code ec;
+
+    if (path.has_parent_path())
+    {
+        std::filesystem::create_directories(path.parent_path(), ec);
+    }
+
+    std::ofstream out(filepath);
+
+    if (!out.is_open())
+    {
+        CT_LOG_WARN("AssetTelemetry: could not write report to '{}'.", filepath);
+
+        return false;
+    }
+
+    out << report.dump(4);
+
+    return true;
+}
+
+/// @brief Logs per scene totals and the slowest loads.
+/// @param topCount how many of the slowest loads to list.
+void AssetTelemetry::LogSummary(std::size_t topCount) const
+{
+    std::map<std::string, LoadTotals> byScene;
+
+    for (const auto &record : m_records)
+    {
+        byScene[record.scene].Add(record);
+    }
+
+    CT_LOG_INFO("AssetTelemetry: {} loads, {:.2f} ms total.", m_records.size(), GetTotalMs());
+
+    for (const auto &[scene, totals] : byScene)
+    {
+        CT_LOG_INFO("AssetTelemetry [{}]: {} loads, {:.2f} ms (read {:.2f}, decode {:.2f}, upload {:.2f}), {} bytes.",
+                    scene, totals.count, totals.TotalMs(), totals.readMs, totals.decodeMs, totals.uploadMs,
+                    totals.bytes);
+    }
+
+    const auto sorted = GetSortedRecords();
+
+    for (std::size_t i = 0; i < std::min(topCount, sorted.size()); ++i)
+    {
+        const auto &record = sorted[i];
+
+        CT_LOG_INFO("AssetTelemetry #{}: {} '{}' ({}) {:.2f} ms (read {:.2f}, decode {:.2f}, upload {:.2f}), {} bytes.",
+                    i + 1, record.type, record.name, record.scene, record.TotalMs(), record.readMs, record.decodeMs,
+                    record.uploadMs, record.bytes);
+    }
+}
+
+/// @brief Forgets every recorded load. The current scene is kept.
+void AssetTelemetry::Clear()
+{
+    m_records.clear();
+}
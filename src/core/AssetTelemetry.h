@@ -0,0 +1,95 @@
+// ============================================================================
+//  File        : AssetTelemetry.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-06
+//  Description : Per asset load timings collected by the AssetManager, with
+//                a sorted JSON report and a log summary.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/// @brief One load request as seen by the AssetManager.
+struct AssetLoadRecord
+{
+    std::string name;
+    std::string type;
+    std::string path;
+    std::string scene;
+
+    double readMs = 0.0;
+    double decodeMs = 0.0;
+    double uploadMs = 0.0;
+
+    std::size_t bytes = 0;
+
+    /// @brief True when the request was served by an already resident resource.
+    bool wasAliased = false;
+
+    /// @brief True when a worker already read (and possibly decoded) the file; only main thread time is recorded.
+    bool wasPrefetched = false;
+
+    /// @brief True when decoded pixels came from the on disk texture cache instead of the source image.
+    bool wasCooked = false;
+
+    double TotalMs() const
+    {
+        return readMs + decodeMs + uploadMs;
+    }
+};
+
+/// @brief Measures one stage of a load. Restart between stages.
+class AssetStopwatch
+{
+  public:
+    double Restart()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        const std::chrono::duration<double, std::milli> elapsed = now - m_start;
+        m_start = now;
+
+        return elapsed.count();
+    }
+
+  private:
+    std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+};
+
+// ============================================================================
+//  Class       : AssetTelemetry
+//  Purpose     : Collects AssetLoadRecords and reports where load time goes.
+//
+//  Responsibilities:
+//      - Tags every load with the scene that requested it
+//      - Sorts loads by total time
+//      - Writes the JSON report and the log summary
+//
+// ============================================================================
+class AssetTelemetry
+{
+  public:
+    void SetScene(const std::string &scene);
+    const std::string &GetScene() const;
+
+    void Record(AssetLoadRecord record);
+    const std::vector<AssetLoadRecord> &GetRecords() const;
+    std::vector<AssetLoadRecord> GetSortedRecords() const;
+    double GetTotalMs() const;
+
+    bool WriteJson(const std::string &filepath) const;
+    void LogSummary(std::size_t topCount) const;
+
+    void Clear();
+
+  private:
+    std::vector<AssetLoadRecord> m_records;
+    std::string m_scene = "None";
+};
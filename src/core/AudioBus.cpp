@@ -0,0 +1,82 @@
+// ============================================================================
+//  File        : AudioBus.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-15
+//  Description : Gain and mute of the master, music, sfx and ui buses, and
+//                the effective gain every sound on a bus ends up with.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "AudioBus.h"
+#include <algorithm>
+
+/// @brief Constructor for the AudioBuses: every bus at full gain and unmuted.
+AudioBuses::AudioBuses()
+{
+    m_gains.fill(1.f);
+    m_isMuted.fill(false);
+
+    for (auto &gain : m_effectiveGains)
+    {
+        gain.store(1.f);
+    }
+}
+
+/// @brief Sets the gain of one bus.
+/// @param bus bus to change.
+/// @param gain linear gain, clamped to 0 to 1.
+void AudioBuses::SetGain(AudioBusId bus, float gain)
+{
+    m_gains[static_cast<std::size_t>(bus)] = std::clamp(gain, 0.f, 1.f);
+    Recompute();
+}
+
+/// @brief Returns the gain of one bus, ignoring mute and the master bus.
+/// @param bus bus to query.
+/// @return linear gain, 0 to 1.
+float AudioBuses::GetGain(AudioBusId bus) const
+{
+    return m_gains[static_cast<std::size_t>(bus)];
+}
+
+/// @brief Mutes or unmutes one bus. Muting Master silences every bus.
+/// @param bus bus to change.
+/// @param isMuted true to mute.
+void AudioBuses::SetMuted(AudioBusId bus, bool isMuted)
+{
+    m_isMuted[static_cast<std::size_t>(bus)] = isMuted;
+    Recompute();
+}
+
+/// @brief Returns whether one bus is muted, ignoring the master bus.
+/// @param bus bus to query.
+/// @return true / false
+bool AudioBuses::IsMuted(AudioBusId bus) const
+{
+    return m_isMuted[static_cast<std::size_t>(bus)];
+}
+
+/// @brief Returns the gain a sound on the bus is actually played at: its own gain times the master gain, or 0 if
+/// either is muted. Safe to call from the mixer thread.
+/// @param bus bus to query.
+/// @return linear gain, 0 to 1.
+float AudioBuses::GetEffectiveGain(AudioBusId bus) const
+{
+    return m_effectiveGains[static_cast<std::size_t>(bus)].load(std::memory_order_relaxed);
+}
+
+/// @brief Refreshes every effective gain after a bus changed.
+void AudioBuses::Recompute()
+{
+    const std::size_t master = static_cast<std::size_t>(AudioBusId::Master);
+    const float masterGain = m_isMuted[master] ? 0.f : m_gains[master];
+
+    for (std::size_t i = 0; i < BUS_COUNT; ++i)
+    {
+        const float gain = m_isMuted[i] ? 0.f : m_gains[i];
+        m_effectiveGains[i].store(i == master ? masterGain : gain * masterGain, std::memory_order_relaxed);
+    }
+}
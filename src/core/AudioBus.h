@@ -0,0 +1,63 @@
+// ============================================================================
+//  File        : AudioBus.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-15
+//  Description : Gain and mute of the master, music, sfx and ui buses, and
+//                the effective gain every sound on a bus ends up with.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/// @brief Buses sounds are routed through. Every bus other than Master feeds Master.
+enum class AudioBusId : std::uint8_t
+{
+    Master,
+    Music,
+    Sfx,
+    UI,
+    Count
+};
+
+// ============================================================================
+//  Class       : AudioBuses
+//  Purpose     : Holds the bus hierarchy and resolves each bus's final gain.
+//
+//  Responsibilities:
+//      - Stores gain and mute per bus
+//      - Recomputes the effective gains whenever a bus changes, so a volume
+//        change costs one pass over the buses, not over the voices
+//      - Lets the mixer thread read effective gains without locking
+//
+// ============================================================================
+class AudioBuses
+{
+  public:
+    AudioBuses();
+
+    void SetGain(AudioBusId bus, float gain);
+    float GetGain(AudioBusId bus) const;
+
+    void SetMuted(AudioBusId bus, bool isMuted);
+    bool IsMuted(AudioBusId bus) const;
+
+    float GetEffectiveGain(AudioBusId bus) const;
+
+  private:
+    void Recompute();
+
+  private:
+    static constexpr std::size_t BUS_COUNT = static_cast<std::size_t>(AudioBusId::Count);
+
+    std::array<float, BUS_COUNT> m_gains;
+    std::array<bool, BUS_COUNT> m_isMuted;
+    std::array<std::atomic<float>, BUS_COUNT> m_effectiveGains;
+};
@@ -0,0 +1,166 @@
+// ============================================================================
+//  File        : AudioEnvelope.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-18
+//  Description : Gain ramp advanced by the sample frames it is applied to,
+//                so a fade lasts exactly its length whatever the frame rate.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "AudioEnvelope.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+/// @brief Quarter turn, mapping ramp progress onto the equal power sine and cosine curves.
+constexpr float HALF_PI = 1.57079632679f;
+
+/// @brief Exponential ramps start from or end at this gain instead of silence, which has no decibel value (-60 dB).
+constexpr float EXPONENTIAL_FLOOR = 0.001f;
+} // namespace
+
+/// @brief Jumps to a gain and holds it.
+/// @param gain new gain.
+void AudioEnvelope::Set(float gain)
+{
+    m_from = gain;
+    m_to = gain;
+    m_position = 0.0;
+    m_length = 0.0;
+}
+
+/// @brief Starts a ramp from the current gain, so a fade that interrupts another continues without a jump.
+/// @param target gain at the end of the ramp.
+/// @param length ramp length, in the unit Advance and Apply count: sample frames for audio, seconds for visuals.
+/// @param curve ramp shape.
+void AudioEnvelope::Start(float target, double length, EnvelopeCurve curve)
+{
+    if (length <= 0.0)
+    {
+        Set(target);
+
+        return;
+    }
+
+    m_from = GetGain();
+    m_to = target;
+    m_position = 0.0;
+    m_length = length;
+    m_curve = curve;
+}
+
+/// @brief Moves along the ramp.
+/// @param amount distance to move, in the unit the ramp was started with.
+/// @return gain at the new position.
+float AudioEnvelope::Advance(double amount)
+{
+    m_position += amount;
+
+    return GetGain();
+}
+
+/// @brief Scales interleaved samples in place, one gain per frame, and advances one unit per frame. Once the ramp is
+/// over the held gain is applied to the whole block, or nothing is done at unity.
+/// @param samples interleaved 16 bit samples.
+/// @param frames frames in samples.
+/// @param channels samples per frame.
+void AudioEnvelope::Apply(std::int16_t *samples, std::size_t frames, unsigned int channels)
+{
+    std::size_t frame = 0;
+
+    for (; frame < frames && !IsDone(); ++frame)
+    {
+        const float gain = GetGain();
+
+        for (unsigned int c = 0; c < channels; ++c)
+        {
+            std::int16_t &sample = samples[frame * channels + c];
+            sample = static_cast<std::int16_t>(sample * gain);
+        }
+
+        m_position += 1.0;
+    }
+
+    m_position += static_cast<double>(frames - frame);
+
+    if (frame == frames || m_to == 1.f)
+    {
+        return;
+    }
+
+    for (std::size_t i = frame * channels; i < frames * channels; ++i)
+    {
+        samples[i] = static_cast<std::int16_t>(samples[i] * m_to);
+    }
+}
+
+/// @brief Returns the gain at the current position.
+/// @return gain.
+float AudioEnvelope::GetGain() const
+{
+    if (IsDone())
+    {
+        return m_to;
+    }
+
+    return Evaluate(m_from, m_to, static_cast<float>(m_position / m_length), m_curve);
+}
+
+/// @brief Returns the gain the envelope is heading to, or holding.
+/// @return m_to.
+float AudioEnvelope::GetTarget() const
+{
+    return m_to;
+}
+
+/// @brief Returns whether the ramp ended at least lag units ago. An owner whose output is heard late passes its
+/// latency, so the ramp only counts as done once its end was actually heard.
+/// @param lag how far past the end the position must be.
+/// @return true / false
+bool AudioEnvelope::IsDone(double lag) const
+{
+    return m_position >= m_length + lag;
+}
+
+/// @brief Evaluates a ramp shape.
+/// @param from gain at progress 0.
+/// @param to gain at progress 1.
+/// @param progress 0 to 1.
+/// @param curve ramp shape.
+/// @return gain.
+float AudioEnvelope::Evaluate(float from, float to, float progress, EnvelopeCurve curve)
+{
+    progress = std::clamp(progress, 0.f, 1.f);
+
+    switch (curve)
+    {
+        case EnvelopeCurve::EqualPower:
+        {
+            // A rising ramp follows the sine, a falling one the cosine; kept between the endpoints when both are set.
+            const float gain = from * std::cos(progress * HALF_PI) + to * std::sin(progress * HALF_PI);
+
+            return std::clamp(gain, std::min(from, to), std::max(from, to));
+        }
+
+        case EnvelopeCurve::Exponential:
+        {
+            if (progress >= 1.f)
+            {
+                return to;
+            }
+
+            const float start = std::max(from, EXPONENTIAL_FLOOR);
+            const float end = std::max(to, EXPONENTIAL_FLOOR);
+
+            return start * std::pow(end / start, progress);
+        }
+
+        case EnvelopeCurve::Linear:
+        default:
+            return from + (to - from) * progress;
+    }
+}
@@ -0,0 +1,63 @@
+// ============================================================================
+//  File        : AudioEnvelope.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-18
+//  Description : Gain ramp advanced by the sample frames it is applied to,
+//                so a fade lasts exactly its length whatever the frame rate.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/// @brief Shape of a gain ramp.
+enum class EnvelopeCurve : std::uint8_t
+{
+    /// @brief Gain moves at a constant rate.
+    Linear,
+
+    /// @brief Sine and cosine quarter turns; two opposite ramps keep the summed loudness level.
+    EqualPower,
+
+    /// @brief Gain moves at a constant rate in decibels, which the ear hears as an even fade.
+    Exponential
+};
+
+// ============================================================================
+//  Class       : AudioEnvelope
+//  Purpose     : Ramps a gain from its current value to a target over a
+//                length measured in whatever the owner advances it by.
+//
+//  Responsibilities:
+//      - Evaluates linear, equal power and exponential ramps
+//      - Scales interleaved samples with a per frame gain, advancing itself
+//      - Holds the target once the ramp is over
+//
+// ============================================================================
+class AudioEnvelope
+{
+  public:
+    void Set(float gain);
+    void Start(float target, double length, EnvelopeCurve curve);
+
+    float Advance(double amount);
+    void Apply(std::int16_t *samples, std::size_t frames, unsigned int channels);
+
+    float GetGain() const;
+    float GetTarget() const;
+    bool IsDone(double lag = 0.0) const;
+
+    static float Evaluate(float from, float to, float progress, EnvelopeCurve curve);
+
+  private:
+    float m_from = 1.f;
+    float m_to = 1.f;
+    double m_position = 0.0;
+    double m_length = 0.0;
+    EnvelopeCurve m_curve = EnvelopeCurve::Linear;
+};
@@ -0,0 +1,359 @@
+// ============================================================================
+//  File        : AudioEventBank.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-19
+//  Description : Named audio events read from a data file: each maps to a
+//                pool of preloaded sounds with randomized volume and pitch,
+//                a cooldown, a voice priority and a bus.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "AudioEventBank.h"
+#include "AssetManager.h"
+#include "Macros.h"
+#include "nlohmann/json.hpp"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+using json = nlohmann::json;
+
+namespace
+{
+/// @brief Returned by GetTrack for names the bank does not know.
+const std::string NO_TRACK;
+
+/// @brief Parses a bus name.
+/// @param name "master", "music", "sfx" or "ui".
+/// @return matching bus, or the sfx bus for anything else.
+AudioBusId FromStringToBus(const std::string &name)
+{
+    if (name == "master")
+    {
+        return AudioBusId::Master;
+    }
+
+    if (name == "music")
+    {
+        return AudioBusId::Music;
+    }
+
+    if (name == "ui")
+    {
+        return AudioBusId::UI;
+    }
+
+    return AudioBusId::Sfx; // default fallback
+}
+
+/// @brief Parses a voice category name.
+/// @param name "ui", "weapon", "explosion" or "default".
+/// @return matching category, or the default category for anything else.
+SfxCategory FromStringToCategory(const std::string &name)
+{
+    if (name == "ui")
+    {
+        return SfxCategory::UI;
+    }
+
+    if (name == "weapon")
+    {
+        return SfxCategory::Weapon;
+    }
+
+    if (name == "explosion")
+    {
+        return SfxCategory::Explosion;
+    }
+
+    return SfxCategory::Default; // default fallback
+}
+
+/// @brief Reads a randomization range written either as one number or as [min, max].
+/// @param def event definition.
+/// @param key range to read.
+/// @return min and max, equal when the key is missing (no randomization).
+std::pair<float, float> ReadRange(const json &def, const char *key)
+{
+    if (!def.contains(key))
+    {
+        return {1.f, 1.f};
+    }
+
+    const json &value = def.at(key);
+
+    if (value.is_array())
+    {
+        const float a = value.at(0).get<float>();
+        const float b = value.at(1).get<float>();
+
+        return {std::min(a, b), std::max(a, b)};
+    }
+
+    const float single = value.get<float>();
+
+    return {single, single};
+}
+} // namespace
+
+/// @brief Reads event definitions from a JSON file and loads every sound they use.
+/// @param filepath JSON file with "music" and "events" objects.
+/// @param audioDirectory directory sound and track file names are relative to.
+/// @return false if the file cannot be read or parsed; the bank is left empty.
+bool AudioEventBank::LoadFromFile(const std::string &filepath, const std::string &audioDirectory)
+{
+    std::ifstream in(filepath);
+
+    if (!in.is_open())
+    {
+        CT_LOG_ERROR("AudioEventBank: failed to open '{}'.", filepath);
+        Clear();
+
+        return false;
+    }
+
+    std::stringstream text;
+    text << in.rdbuf();
+
+    return LoadFromString(text.str(), audioDirectory);
+}
+
+/// @brief Reads event definitions from JSON text and loads every sound they use, replacing what the bank held. An
+/// event whose sounds all fail to load is skipped, so triggering it later is a cheap no-op.
+/// @param text JSON with "music" and "events" objects.
+/// @param audioDirectory directory sound and track file names are relative to.
+/// @return false if the text cannot be parsed; the bank is left empty.
+bool AudioEventBank::LoadFromString(const std::string &text, const std::string &audioDirectory)
+{
+    Clear();
+
+    try
+    {
+        const json j = json::parse(text);
+
+        for (const auto &[name, file] : j.value("music", json::object()).items())
+        {
+            m_tracks[MakeAssetId(name)] = audioDirectory + file.get<std::string>();
+        }
+
+        for (const auto &[name, def] : j.value("events", json::object()).items())
+        {
+            Event event;
+
+            for (const json &file : def.at("sounds"))
+            {
+                const std::string key = file.get<std::string>();
+
+                if (!AssetManager::Instance().LoadSound(key, audioDirectory + key))
+                {
+                    CT_LOG_WARN("AudioEventBank: event '{}' skips sound '{}', it failed to load.", name, key);
+                    continue;
+                }
+
+                event.sounds.push_back(AssetManager::Instance().GetSoundHandle(MakeAssetId(key)));
+            }
+
+            if (event.sounds.empty())
+            {
+                CT_LOG_WARN("AudioEventBank: event '{}' has no playable sound, skipped.", name);
+                continue;
+            }
+
+            std::tie(event.minGain, event.maxGain) = ReadRange(def, "volume");
+            std::tie(event.minPitch, event.maxPitch) = ReadRange(def, "pitch");
+            event.cooldownMs = def.value("cooldown_ms", 0.0);
+            event.bus = FromStringToBus(def.value("bus", "sfx"));
+            event.params.priority = def.value("priority", 0);
+            event.params.category = FromStringToCategory(def.value("category", "default"));
+            event.params.maxInstances = def.value("max_instances", std::size_t{0});
+
+            SlotFor(MakeAssetId(name)) = std::move(event);
+        }
+    }
+
+    catch (const json::exception &e)
+    {
+        CT_LOG_ERROR("AudioEventBank: JSON parse error: {}", e.what());
+        Clear();
+
+        return false;
+    }
+
+    CT_LOG_INFO("AudioEventBank: loaded {} events and {} music tracks.", GetEventCount(), m_tracks.size());
+
+    return true;
+}
+
+/// @brief Forgets every event and track. Each event name keeps its slot, so a handle resolved before stays bound to
+/// that name: it triggers nothing until the name loads again, and never another event.
+void AudioEventBank::Clear()
+{
+    for (Event &event : m_events)
+    {
+        event = Event{};
+    }
+
+    m_tracks.clear();
+}
+
+/// @brief Returns how many events loaded.
+/// @return loaded event count.
+std::size_t AudioEventBank::GetEventCount() const
+{
+    return static_cast<std::size_t>(
+        std::count_if(m_events.begin(), m_events.end(), [](const Event &event) { return !event.sounds.empty(); }));
+}
+
+/// @brief Resolves an event name to its handle. Call once at load time and keep the handle.
+/// @param id MakeAssetId of the event name.
+/// @return handle, invalid if the event is unknown or was skipped.
+AudioEventHandle AudioEventBank::GetHandle(AssetId id) const
+{
+    auto it = m_handles.find(id);
+
+    if (it == m_handles.end() || m_events[it->second.index].sounds.empty())
+    {
+        return AudioEventHandle{};
+    }
+
+    return it->second;
+}
+
+/// @brief Returns the file of a named music track, ready to pass to PlayMusic.
+/// @param id MakeAssetId of the track name.
+/// @return path inside the audio directory, or an empty string if the track is unknown.
+const std::string &AudioEventBank::GetTrack(AssetId id) const
+{
+    auto it = m_tracks.find(id);
+
+    return it == m_tracks.end() ? NO_TRACK : it->second;
+}
+
+/// @brief Triggers an event: picks a variation and a random gain and pitch. A trigger inside the event's cooldown is
+/// dropped. Costs an array index and a few random numbers; no strings, no hashing.
+/// @param handle event to trigger.
+/// @param nowMs current time in milliseconds, from any steady clock.
+/// @param shot receives the sound to play.
+/// @return false if the handle is invalid, its event is not loaded, the event is cooling down, or its sound is gone.
+bool AudioEventBank::Trigger(AudioEventHandle handle, double nowMs, AudioEventShot &shot)
+{
+    if (!handle.IsValid() || handle.index >= m_events.size())
+    {
+        return false;
+    }
+
+    Event &event = m_events[handle.index];
+
+    if (event.sounds.empty())
+    {
+        return false;
+    }
+
+    if (nowMs - event.lastTriggerMs < event.cooldownMs)
+    {
+        ++m_cooldownDropCount;
+
+        return false;
+    }
+
+    const std::size_t variation = PickVariation(event);
+    shot.buffer = AssetManager::Instance().GetSound(event.sounds[variation]);
+
+    if (!shot.buffer)
+    {
+        return false;
+    }
+
+    event.lastTriggerMs = nowMs;
+    event.lastVariation = variation;
+
+    shot.gain = Random(event.minGain, event.maxGain);
+    shot.pitch = Random(event.minPitch, event.maxPitch);
+    shot.params = event.params;
+    shot.bus = event.bus;
+
+    return true;
+}
+
+/// @brief Returns how many triggers were dropped by cooldowns.
+/// @return m_cooldownDropCount.
+std::size_t AudioEventBank::GetCooldownDropCount() const
+{
+    return m_cooldownDropCount;
+}
+
+/// @brief Restarts the random sequence, so tests and replays pick the same variations.
+/// @param seed any value; 0 is replaced, since the generator would stay at 0.
+void AudioEventBank::SetSeed(std::uint32_t seed)
+{
+    m_randomState = seed != 0 ? seed : 0x9E3779B9u;
+}
+
+/// @brief Returns the slot of an event name, giving the name the next free slot the first time it is seen.
+/// @param id MakeAssetId of the event name.
+/// @return the name's slot.
+AudioEventBank::Event &AudioEventBank::SlotFor(AssetId id)
+{
+    auto [it, isNew] = m_handles.try_emplace(id, AudioEventHandle{static_cast<std::uint32_t>(m_events.size())});
+
+    if (isNew)
+    {
+        m_events.emplace_back();
+    }
+
+    return m_events[it->second.index];
+}
+
+/// @brief Picks a sound from the event's pool, never the one it played last when there is a choice.
+/// @param event event being triggered.
+/// @return index into event.sounds.
+std::size_t AudioEventBank::PickVariation(const Event &event)
+{
+    const std::size_t count = event.sounds.size();
+
+    if (count == 1)
+    {
+        return 0;
+    }
+
+    if (event.lastVariation >= count)
+    {
+        return NextRandom() % count;
+    }
+
+    // Pick among the others, then step over the last one.
+    std::size_t variation = NextRandom() % (count - 1);
+
+    return variation >= event.lastVariation ? variation + 1 : variation;
+}
+
+/// @brief Returns a uniform random value.
+/// @param min lower bound.
+/// @param max upper bound.
+/// @return value in [min, max].
+float AudioEventBank::Random(float min, float max)
+{
+    if (min >= max)
+    {
+        return min;
+    }
+
+    const float unit = static_cast<float>(NextRandom() >> 8) / 16777216.f;
+
+    return min + (max - min) * unit;
+}
+
+/// @brief Advances the xorshift32 generator; plenty for picking sounds, and far cheaper than std::mt19937.
+/// @return next 32 bit value.
+std::uint32_t AudioEventBank::NextRandom()
+{
+    m_randomState ^= m_randomState << 13;
+    m_randomState ^= m_randomState >> 17;
+    m_randomState ^= m_randomState << 5;
+
+    return m_randomState;
+}
@@ -0,0 +1,112 @@
+// ============================================================================
+//  File        : AudioEventBank.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-19
+//  Description : Named audio events read from a data file: each maps to a
+//                pool of preloaded sounds with randomized volume and pitch,
+//                a cooldown, a voice priority and a bus.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include "AssetId.h"
+#include "AudioBus.h"
+#include "SfxVoicePool.h"
+#include <SFML/Audio.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// @brief Dense index of a loaded audio event. Resolve it once with GetHandle and keep it: each event name keeps its
+/// index across reloads, so a handle never plays another event. If a reload drops the event, triggering it does
+/// nothing until the event comes back.
+struct AudioEventHandle
+{
+    static constexpr std::uint32_t InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t index = InvalidIndex;
+
+    constexpr bool IsValid() const
+    {
+        return index != InvalidIndex;
+    }
+};
+
+/// @brief One triggering of an event, with its variation and randomization already picked.
+struct AudioEventShot
+{
+    const sf::SoundBuffer *buffer = nullptr;
+    float gain = 1.f;
+    float pitch = 1.f;
+    SfxParams params;
+    AudioBusId bus = AudioBusId::Sfx;
+};
+
+// ============================================================================
+//  Class       : AudioEventBank
+//  Purpose     : Turns gameplay events into concrete sounds without any
+//                string handling at trigger time.
+//
+//  Responsibilities:
+//      - Parses event and music track definitions from JSON
+//      - Loads every event sound up front and keeps its asset handle
+//      - Picks a variation, never the same one twice in a row
+//      - Randomizes volume and pitch within each event's range
+//      - Drops triggers that come within an event's cooldown
+//      - Keeps each event name on the same handle across reloads
+//
+// ============================================================================
+class AudioEventBank
+{
+  public:
+    bool LoadFromFile(const std::string &filepath, const std::string &audioDirectory);
+    bool LoadFromString(const std::string &text, const std::string &audioDirectory);
+    void Clear();
+
+    std::size_t GetEventCount() const;
+    AudioEventHandle GetHandle(AssetId id) const;
+    const std::string &GetTrack(AssetId id) const;
+
+    bool Trigger(AudioEventHandle handle, double nowMs, AudioEventShot &shot);
+    std::size_t GetCooldownDropCount() const;
+
+    void SetSeed(std::uint32_t seed);
+
+  private:
+    /// @brief One loaded event.
+    struct Event
+    {
+        std::vector<AssetHandle> sounds;
+        float minGain = 1.f;
+        float maxGain = 1.f;
+        float minPitch = 1.f;
+        float maxPitch = 1.f;
+        double cooldownMs = 0.0;
+        SfxParams params;
+        AudioBusId bus = AudioBusId::Sfx;
+
+        double lastTriggerMs = -std::numeric_limits<double>::infinity();
+        std::size_t lastVariation = std::numeric_limits<std::size_t>::max();
+    };
+
+    Event &SlotFor(AssetId id);
+    std::size_t PickVariation(const Event &event);
+    float Random(float min, float max);
+    std::uint32_t NextRandom();
+
+  private:
+    // One slot per event name ever loaded; a slot whose event is not loaded now has no sounds.
+    std::vector<Event> m_events;
+    std::unordered_map<AssetId, AudioEventHandle> m_handles;
+    std::unordered_map<AssetId, std::string> m_tracks;
+
+    std::uint32_t m_randomState = 0x9E3779B9u;
+    std::size_t m_cooldownDropCount = 0;
+};
@@ -0,0 +1,256 @@
+// ============================================================================
+//  File        : AudioImporter.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-05
+//  Description : Converts raw WAV audio into compressed OGG / FLAC files and
+//                resolves requested WAV paths onto their compressed form.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "AudioImporter.h"
+#include "Macros.h"
+#include <SFML/Audio.hpp>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <filesystem>
+
+namespace
+{
+/// @brief Anything longer than this is treated as music: OGG on disk and streamed while playing.
+constexpr float STREAM_THRESHOLD_SECONDS = 5.f;
+
+/// @brief Audio an sf::Music keeps in memory while streaming: its 1 second read buffer plus the 3 queued buffers.
+constexpr float STREAM_WINDOW_SECONDS = 4.f;
+
+/// @brief Sample frames converted per read / write pass.
+constexpr std::size_t IMPORT_CHUNK_FRAMES = 4096;
+
+/// @brief Compressed formats ResolveSource looks for, in order of preference.
+constexpr std::array<const char *, 2> COMPRESSED_EXTENSIONS = {".ogg", ".flac"};
+
+/// @brief Returns whether path names a WAV file, ignoring case.
+/// @param path file to check.
+/// @return true / false
+bool IsWav(const std::filesystem::path &path)
+{
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    return extension == ".wav";
+}
+
+/// @brief Returns whether output exists and was written no earlier than source.
+/// @param output converted file.
+/// @param source original file.
+/// @return true / false
+bool IsUpToDate(const std::filesystem::path &output, const std::filesystem::path &source)
+{
+    std::error_code outputError;
+    std::error_code sourceError;
+
+    const auto outputTime = std::filesystem::last_write_time(output, outputError);
+    const auto sourceTime = std::filesystem::last_write_time(source, sourceError);
+
+    if (outputError)
+    {
+        return false;
+    }
+
+    // With no source left to compare against, the converted file is all there is.
+    return sourceError || outputTime >= sourceTime;
+}
+
+/// @brief Returns the size of a file, or 0 if it cannot be read.
+/// @param path file to measure.
+/// @return size in bytes.
+std::size_t FileSize(const std::filesystem::path &path)
+{
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(path, ec);
+
+    return ec ? 0 : static_cast<std::size_t>(size);
+}
+
+/// @brief Copies every sample of input into a new file; the format follows the output extension.
+/// @param input opened source file.
+/// @param outputPath file to create, closed again before returning.
+/// @return true / false
+bool Encode(sf::InputSoundFile &input, const std::string &outputPath)
+{
+    sf::OutputSoundFile writer;
+
+    if (!writer.openFromFile(outputPath, input.getSampleRate(), input.getChannelCount()))
+    {
+        return false;
+    }
+
+    std::vector<sf::Int16> samples(IMPORT_CHUNK_FRAMES * input.getChannelCount());
+
+    while (const sf::Uint64 count = input.read(samples.data(), samples.size()))
+    {
+        writer.write(samples.data(), count);
+    }
+
+    return true;
+}
+} // namespace
+
+/// @brief Maps a requested WAV path onto an up to date OGG or FLAC sibling, so callers keep using the WAV names.
+/// Non WAV paths, and WAVs that have not been imported (or were edited after importing), are returned unchanged.
+/// @param filepath path as requested by the caller.
+/// @return path of the file that should actually be opened.
+std::string AudioImporter::ResolveSource(const std::string &filepath)
+{
+    const std::filesystem::path source(filepath);
+
+    if (!IsWav(source))
+    {
+        return filepath;
+    }
+
+    for (const char *extension : COMPRESSED_EXTENSIONS)
+    {
+        std::filesystem::path candidate = source;
+        candidate.replace_extension(extension);
+
+        if (IsUpToDate(candidate, source))
+        {
+            return candidate.generic_string();
+        }
+    }
+
+    return filepath;
+}
+
+/// @brief Returns whether audio of this length should be streamed rather than decoded up front.
+/// @param durationSeconds length of the audio.
+/// @return true / false
+bool AudioImporter::ShouldStream(float durationSeconds)
+{
+    return durationSeconds > STREAM_THRESHOLD_SECONDS;
+}
+
+/// @brief Converts one WAV file next to itself: long tracks to OGG Vorbis, short effects to lossless FLAC.
+/// Files whose converted output is already newer than the WAV are measured but not re-encoded.
+/// @param filepath WAV file to convert.
+/// @return AudioImportResult, isOk false on failure.
+AudioImportResult AudioImporter::ImportFile(const std::string &filepath)
+{
+    AudioImportResult result;
+    result.sourcePath = filepath;
+    result.sourceBytes = FileSize(filepath);
+
+    sf::InputSoundFile input;
+
+    if (!input.openFromFile(filepath))
+    {
+        CT_LOG_ERROR("AudioImporter: failed to open '{}'.", filepath);
+
+        return result;
+    }
+
+    const unsigned int channelCount = input.getChannelCount();
+    const unsigned int sampleRate = input.getSampleRate();
+    const auto windowSamples = static_cast<std::size_t>(STREAM_WINDOW_SECONDS * sampleRate * channelCount);
+
+    result.durationSeconds = input.getDuration().asSeconds();
+    result.isStreamed = ShouldStream(result.durationSeconds);
+    result.decodedBytes = static_cast<std::size_t>(input.getSampleCount()) * sizeof(sf::Int16);
+    result.residentBytes =
+        result.isStreamed ? std::min(result.decodedBytes, windowSamples * sizeof(sf::Int16)) : result.decodedBytes;
+
+    std::filesystem::path output(filepath);
+    output.replace_extension(result.isStreamed ? ".ogg" : ".flac");
+    result.outputPath = output.generic_string();
+
+    if (!IsUpToDate(output, filepath))
+    {
+        if (!Encode(input, result.outputPath))
+        {
+            CT_LOG_ERROR("AudioImporter: failed to create '{}'.", result.outputPath);
+
+            return result;
+        }
+
+        result.wasConverted = true;
+    }
+
+    result.outputBytes = FileSize(output);
+    result.isOk = result.outputBytes > 0;
+
+    return result;
+}
+
+/// @brief Converts every WAV file directly inside directory.
+/// @param directory folder holding the WAV sources, e.g. Settings::m_audioDirectory.
+/// @return AudioImportReport with per file results and totals.
+AudioImportReport AudioImporter::ImportDirectory(const std::string &directory)
+{
+    AudioImportReport report;
+    std::error_code ec;
+
+    for (const auto &entry : std::filesystem::directory_iterator(directory, ec))
+    {
+        std::error_code entryError;
+
+        if (!entry.is_regular_file(entryError) || !IsWav(entry.path()))
+        {
+            continue;
+        }
+
+        AudioImportResult result = ImportFile(entry.path().generic_string());
+
+        if (result.isOk)
+        {
+            report.sourceBytes += result.sourceBytes;
+            report.outputBytes += result.outputBytes;
+            report.decodedBytes += result.decodedBytes;
+            report.residentBytes += result.residentBytes;
+        }
+        else
+        {
+            ++report.failedCount;
+        }
+
+        report.files.push_back(std::move(result));
+    }
+
+    if (ec)
+    {
+        CT_LOG_ERROR("AudioImporter: cannot read directory '{}'.", directory);
+    }
+
+    std::sort(report.files.begin(), report.files.end(),
+              [](const AudioImportResult &a, const AudioImportResult &b) { return a.sourcePath < b.sourcePath; });
+
+    return report;
+}
+
+/// @brief Writes one line per file and the disk / memory totals to the log.
+/// @param report result of ImportDirectory.
+void AudioImporter::LogReport(const AudioImportReport &report)
+{
+    for (const auto &file : report.files)
+    {
+        if (!file.isOk)
+        {
+            CT_LOG_WARN("AudioImporter: '{}' failed.", file.sourcePath);
+
+            continue;
+        }
+
+        CT_LOG_INFO("AudioImporter: '{}' -> '{}' ({}) | {:.1f}s | disk {} -> {} bytes | RAM {} -> {} bytes{}",
+                    file.sourcePath, file.outputPath, file.isStreamed ? "stream" : "in memory", file.durationSeconds,
+                    file.sourceBytes, file.outputBytes, file.decodedBytes, file.residentBytes,
+                    file.wasConverted ? "" : " | up to date");
+    }
+
+    CT_LOG_INFO("AudioImporter: {} files, {} failed. Disk {} -> {} bytes, RAM while playing {} -> {} bytes.",
+                report.files.size(), report.failedCount, report.sourceBytes, report.outputBytes, report.decodedBytes,
+                report.residentBytes);
+}
@@ -0,0 +1,74 @@
+// ============================================================================
+//  File        : AudioImporter.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-05
+//  Description : Converts raw WAV audio into compressed OGG / FLAC files and
+//                resolves requested WAV paths onto their compressed form.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/// @brief Outcome of importing a single WAV file.
+struct AudioImportResult
+{
+    std::string sourcePath;
+    std::string outputPath;
+
+    std::size_t sourceBytes = 0;
+    std::size_t outputBytes = 0;
+
+    /// @brief Size of the file once fully decoded to 16 bit PCM.
+    std::size_t decodedBytes = 0;
+
+    /// @brief Approximate memory held while playing: all of it for SFX, the streaming window for music.
+    std::size_t residentBytes = 0;
+
+    float durationSeconds = 0.f;
+    bool isStreamed = false;
+    bool wasConverted = false;
+    bool isOk = false;
+};
+
+/// @brief Totals for a whole import run.
+struct AudioImportReport
+{
+    std::vector<AudioImportResult> files;
+
+    std::size_t sourceBytes = 0;
+    std::size_t outputBytes = 0;
+    std::size_t decodedBytes = 0;
+    std::size_t residentBytes = 0;
+    std::size_t failedCount = 0;
+};
+
+// ============================================================================
+//  Class       : AudioImporter
+//  Purpose     : Offline conversion of WAV sources, and transparent lookup of
+//                the converted files at runtime.
+//
+//  Responsibilities:
+//      - Encodes long tracks as OGG Vorbis, meant to be streamed
+//      - Encodes short sound effects as FLAC, meant to be decoded in memory
+//      - Resolves "x.wav" to an up to date "x.ogg" / "x.flac" when present
+//      - Reports disk and memory savings
+//
+// ============================================================================
+class AudioImporter
+{
+  public:
+    static std::string ResolveSource(const std::string &filepath);
+    static bool ShouldStream(float durationSeconds);
+
+    static AudioImportResult ImportFile(const std::string &filepath);
+    static AudioImportReport ImportDirectory(const std::string &directory);
+
+    static void LogReport(const AudioImportReport &report);
+};
@@ -13,12 +13,51 @@
 #include "AudioManager.h"
 #include "AssetManager.h"
 #include "Macros.h"
+#include "MixKernels.h"
 #include "Settings.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 
 namespace
 {
-/// @brief Defines the max size of the sound effect ring buffer.
-const size_t MAX_SIMULTANEOUS_SOUNDS = 16;
+/// @brief Picks the bus a sound effect is routed through.
+/// @param params the sound's params.
+/// @return UI bus for UI sounds, the sfx bus otherwise.
+AudioBusId BusFor(const SfxParams &params)
+{
+    return params.category == SfxCategory::UI ? AudioBusId::UI : AudioBusId::Sfx;
+}
+
+/// @brief Places a voice in the stereo field. OpenAL pans a mono source by its direction, so the source goes on a
+/// unit circle around the listener: straight ahead when centered, fully to one side at the screen edge. At unit
+/// distance the default rolloff leaves its volume untouched.
+/// @param sound voice to pan.
+/// @param pan -1 left to 1 right.
+void PanSound(sf::Sound &sound, float pan)
+{
+    sound.setRelativeToListener(true);
+    sound.setPosition(pan, 0.f, -std::sqrt(std::max(0.f, 1.f - pan * pan)));
+}
+
+/// @brief How often the audio thread runs commands, advances fades and starts sound effects. Short enough that a
+/// fade steps far below what the ear can pick out, whatever the game frame rate.
+constexpr std::chrono::milliseconds AUDIO_TICK(5);
+
+/// @brief Sound effects quieter than this (-60 dB), counting bus, gain and distance, give up their voice.
+constexpr float INAUDIBLE_GAIN = 0.001f;
+
+/// @brief Most sound effects kept virtual at once; a virtual one costs a few dozen bytes and no audio work.
+constexpr std::size_t MAX_VIRTUAL_SFX = 256;
+
+/// @brief Lowest pitch used to work out how long a sound lasts.
+constexpr float MIN_PITCH = 0.01f;
+
+/// @brief Offline renders are always interleaved stereo, like the software mixer.
+constexpr unsigned int RENDER_CHANNELS = 2;
+
+/// @brief Frames RenderToFile renders and writes at a time.
+constexpr std::size_t FILE_BLOCK_FRAMES = 4096;
 } // namespace
 
 /// @brief Get the current Instance for this AudioManager singleton.
@@ -29,15 +68,18 @@ AudioManager &AudioManager::Instance()
     return instance;
 }
 
-/// @brief Initializes the SFML audio entities using the provided settings.
+/// @brief Initializes the SFML audio entities using the provided settings. Commands run on the calling thread until
+/// StartAudioThread is called.
 /// @param settings Settings to initialize with.
 void AudioManager::Init(std::shared_ptr<Settings> settings)
 {
     CF_EXIT_EARLY_IF_ALREADY_INITIALIZED();
 
     m_settings = settings;
-    m_music = std::make_unique<sf::Music>();
-    m_activeSounds.resize(MAX_SIMULTANEOUS_SOUNDS);
+    m_decks[0] = std::make_unique<MusicDeck>();
+    m_decks[1] = std::make_unique<MusicDeck>();
+    m_activeDeck = 0;
+    m_musicLoader = std::make_unique<ThreadPool>(1);
 
     m_masterVolume = m_settings->m_masterVolume;
     m_musicVolume = m_settings->m_musicVolume;
@@ -45,6 +87,8 @@ void AudioManager::Init(std::shared_ptr<Settings> settings)
     m_isMuted = m_settings->m_isMuted;
 
     m_isInitialized = true;
+    SubmitBusGains();
+    SetSoftwareMixing(m_settings->m_useSoftwareMixer);
 
     CT_LOG_INFO("AudioManager initialized. MasterVolume: {}, MusicVolume: {}, SFXVolume: {}, Muted: {}", m_masterVolume,
                 m_musicVolume, m_sfxVolume, m_isMuted ? "Yes" : "No");
@@ -60,6 +104,7 @@ void AudioManager::HotReload(std::shared_ptr<Settings> settings)
     SetMasterVolume(m_settings->m_masterVolume);
     SetMusicVolume(m_settings->m_musicVolume);
     SetSFXVolume(m_settings->m_sfxVolume);
+    SetSoftwareMixing(m_settings->m_useSoftwareMixer);
 
     CT_LOG_INFO("AudioManager hot reloaded settings.");
 }
@@ -69,12 +114,31 @@ void AudioManager::Shutdown()
 {
     CT_WARN_IF_UNINITIALIZED("AudioManager", "Shutdown");
 
-    if (m_music)
+    // Runs every queued command, then hands the audio state back to this thread.
+    StopAudioThread();
+
+    // Finishes any prepare still running, so the decks are no longer shared.
+    m_musicLoader.reset();
+
+    for (auto &deck : m_decks)
     {
-        m_music->stop();
+        if (deck)
+        {
+            deck->Close();
+        }
     }
 
-    m_music.reset();
+    ExecuteStopAllSFX();
+    m_events.Clear();
+    m_mixer.reset();
+    m_decks[0].reset();
+    m_decks[1].reset();
+    m_isOfflineRendering = false;
+    m_isCrossfading = false;
+    m_isFadingIn = false;
+    m_isFadingOut = false;
+    m_isSoftwareMixing = false;
+    PublishStatus();
     m_settings.reset();
     m_isInitialized = false;
 
@@ -88,101 +152,131 @@ bool AudioManager::IsInitialized() const
     return m_isInitialized;
 }
 
-/// @brief Performs internal state management during a single frame.
-/// @param dt delta time since last update.
-void AudioManager::Update(float dt)
+/// @brief Moves audio control onto its own thread. From then on every request is queued for that thread, and fades
+/// and sound effects advance at its cadence instead of the game frame rate.
+void AudioManager::StartAudioThread()
 {
-    CT_WARN_IF_UNINITIALIZED("AudioManager", "Update");
+    CT_WARN_IF_UNINITIALIZED("AudioManager", "StartAudioThread");
 
-    if (m_isFadingOut)
+    if (IsAudioThreadRunning())
     {
-        m_fadeOutTimer += dt;
-        float progress = std::min(1.f, m_fadeOutTimer / m_fadeOutDuration);
-        float targetVolume = m_musicVolume * m_masterVolume / 100.f;
-        m_music->setVolume((1.f - progress) * targetVolume);
+        return;
+    }
 
-        if (progress >= 1.f)
-        {
-            m_isFadingOut = false;
-            m_music->stop();
+    if (m_isOfflineRendering)
+    {
+        CT_LOG_WARN("AudioManager: no audio thread while rendering offline; Render drives the audio state.");
 
-            CT_LOG_INFO("Music fade-out complete.");
-        }
+        return;
     }
 
-    if (m_isFadingIn)
+    m_isThreadRunning = true;
+    m_audioThread = std::thread(&AudioManager::AudioThreadLoop, this);
+
+    CT_LOG_INFO("AudioManager: audio thread started.");
+}
+
+/// @brief Runs any queued commands, then stops the audio thread. Requests run on the calling thread again afterwards.
+void AudioManager::StopAudioThread()
+{
+    if (!IsAudioThreadRunning())
     {
-        m_fadeInTimer += dt;
-        float progress = std::min(1.f, m_fadeInTimer / m_fadeInDuration);
-        float targetVolume = m_musicVolume * m_masterVolume / 100.f;
+        return;
+    }
 
-        m_music->setVolume(progress * targetVolume);
+    m_isThreadRunning = false;
+    m_audioThread.join();
 
-        if (progress >= 1.f)
-        {
-            m_isFadingIn = false;
+    // Requests that never found room in the queue run here, in order, now that this thread owns the audio state.
+    std::deque<Command> overflow = std::move(m_overflowCommands);
+    m_overflowCommands.clear();
 
-            CT_LOG_INFO("Music fade-in complete.");
-        }
+    for (Command &command : overflow)
+    {
+        Submit(std::move(command));
+    }
+
+    CT_LOG_INFO("AudioManager: audio thread stopped.");
+}
+
+/// @brief Returns whether requests are being handled by the audio thread.
+/// @return true / false
+bool AudioManager::IsAudioThreadRunning() const
+{
+    return m_audioThread.joinable();
+}
+
+/// @brief Blocks until the audio thread has run every command submitted so far, including any that are still waiting
+/// for room in its queue. Returns at once when no audio thread is running, since commands then run as they are
+/// submitted.
+void AudioManager::SyncAudioThread()
+{
+    while (IsAudioThreadRunning() &&
+           (!PushOverflow() || m_executedCount.load(std::memory_order_acquire) < m_submittedCount))
+    {
+        std::this_thread::yield();
     }
 }
 
-/// @brief Request to begin playing a music file, with optional loop and fade features.
-/// @param filename Music file to play.
-/// @param loop Whether or not to loop.
-/// @param fadeIn IsFadingIn?
-/// @param fadeDuration How long to fade.
-void AudioManager::PlayMusic(const std::string &filename, bool loop, bool fadeIn, float fadeDuration)
+/// @brief Performs internal state management during a single frame: finishes fades the music stream has completed.
+/// Fades run on the stream itself, so their length does not depend on the frame time. With the audio thread
+/// running, this happens there instead, and this only hands over requests that found its queue full.
+void AudioManager::Update(float /*dt*/)
 {
-    CT_WARN_IF_UNINITIALIZED("AudioManager", "PlayMusic");
+    CT_WARN_IF_UNINITIALIZED("AudioManager", "Update");
 
-    if (!m_music->openFromFile(filename))
+    if (IsAudioThreadRunning())
     {
-        CT_LOG_WARN("Failed to open music file: {}", filename);
+        PushOverflow();
 
         return;
     }
 
-    m_music->setLoop(loop);
-    m_currentTrack = filename;
+    UpdateFades();
+    PublishStatus();
+}
 
-    if (fadeIn)
-    {
-        m_isFadingIn = true;
-        m_fadeInTimer = 0.f;
-        m_fadeInDuration = fadeDuration;
-        m_music->setVolume(0.f);
-    }
-    else
-    {
-        float targetVolume = m_musicVolume * m_masterVolume / 100.f;
-        m_music->setVolume(m_isMuted ? 0.f : targetVolume);
-    }
+/// @brief Request to begin playing a music file, with optional loop and fade features. Music is always streamed; a WAV
+/// name is transparently swapped for its imported OGG version when one is up to date. A track opened ahead of time by
+/// PrepareMusic starts without touching the file.
+/// @param filename Music file to play.
+/// @param loop Whether or not to loop.
+/// @param fadeIn IsFadingIn?
+/// @param fadeDuration How long to fade.
+/// @param curve Shape of the fade.
+void AudioManager::PlayMusic(const std::string &filename, bool loop, bool fadeIn, float fadeDuration,
+                             EnvelopeCurve curve)
+{
+    CT_WARN_IF_UNINITIALIZED("AudioManager", "PlayMusic");
 
-    m_music->play();
+    m_currentTrack = filename;
 
-    CT_LOG_INFO("Playing music: '{}' | Loop: {} | FadeIn: {}", filename, loop, fadeIn);
+    Command command;
+    command.type = CommandType::PlayMusic;
+    command.filename = filename;
+    command.loop = loop;
+    command.fade = fadeIn;
+    command.duration = fadeDuration;
+    command.curve = curve;
+    RequestMusic(command, {true, fadeIn, false, false});
+    Submit(std::move(command));
 }
 
 /// @brief Request to halt any playing music file, with optional fade feature.
 /// @param fadeOut Opt to slowly diminish volume on stop.
 /// @param fadeDuration Duration to fade if fadeOut true.
-void AudioManager::StopMusic(bool fadeOut, float fadeDuration)
+/// @param curve Shape of the fade.
+void AudioManager::StopMusic(bool fadeOut, float fadeDuration, EnvelopeCurve curve)
 {
     CT_WARN_IF_UNINITIALIZED("AudioManager", "StopMusic");
 
-    if (fadeOut)
-    {
-        m_isFadingOut = true;
-        m_fadeOutTimer = 0.f;
-        m_fadeOutDuration = fadeDuration;
-    }
-    else
-    {
-        m_music->stop();
-    }
-
-    CT_LOG_INFO("Stopping music. FadeOut: {}", fadeOut);
+    Command command;
+    command.type = CommandType::StopMusic;
+    command.fade = fadeOut;
+    command.duration = fadeDuration;
+    command.curve = curve;
+    RequestMusic(command, {fadeOut, false, fadeOut, fadeOut && IsCrossfading()});
+    Submit(std::move(command));
 }
 
 /// @brief Request to pause any playing music file.
@@ -190,11 +284,10 @@ void AudioManager::PauseMusic()
 {
     CT_WARN_IF_UNINITIALIZED("AudioManager", "PauseMusic");
 
-    if (m_music->getStatus() == sf::Music::Playing)
-    {
-        m_music->pause();
-        CT_LOG_INFO("Music paused");
-    }
+    Command command;
+    command.type = CommandType::PauseMusic;
+    RequestMusic(command, {false, IsFadingIn(), IsFadingOut(), IsCrossfading()});
+    Submit(std::move(command));
 }
 
 /// @brief Request to continue playing any paused music file.
@@ -202,20 +295,20 @@ void AudioManager::ResumeMusic()
 {
     CT_WARN_IF_UNINITIALIZED("AudioManager", "ResumeMusic");
 
-    if (m_music->getStatus() == sf::Music::Paused)
-    {
-        m_music->play();
-        CT_LOG_INFO("Music resumed");
-    }
+    Command command;
+    command.type = CommandType::ResumeMusic;
+    Submit(std::move(command));
 }
 
-/// @brief Return the state of whether any music is currently playing.
+/// @brief Return the state of whether any music is currently playing, as of the last audio update. Like the other
+/// music queries, it never waits for the audio thread: until the last play, stop, pause or switch has run there, it
+/// answers with the state that request asked for, so a caller always sees its own calls.
 /// @return true / false
 bool AudioManager::IsMusicPlaying() const
 {
     CT_WARN_IF_UNINITIALIZED_RET("AudioManager", "IsMusicPlaying", false);
 
-    return m_music->getStatus() == sf::Music::Playing;
+    return IsMusicRequestPending() ? m_requestedMusic.isMusicPlaying : m_status.isMusicPlaying.load();
 }
 
 /// @brief Return the state of whether any music file is currently in the process of fading out.
@@ -224,7 +317,7 @@ bool AudioManager::IsFadingOut() const
 {
     CT_WARN_IF_UNINITIALIZED_RET("AudioManager", "IsFadingOut", false);
 
-    return m_isFadingOut;
+    return IsMusicRequestPending() ? m_requestedMusic.isFadingOut : m_status.isFadingOut.load();
 }
 
 /// @brief Return the state of whether any music file is currently in the process of fading in.
@@ -233,174 +326,1700 @@ bool AudioManager::IsFadingIn() const
 {
     CT_WARN_IF_UNINITIALIZED_RET("AudioManager", "IsFadingIn", false);
 
-    return m_isFadingIn;
+    return IsMusicRequestPending() ? m_requestedMusic.isFadingIn : m_status.isFadingIn.load();
 }
 
-/// @brief Request to play a sound effect from a ring buffer of SFML managed sound buffers.
-/// @param filename Sound Effect file to add to ring buffer in support of up to 16 concurrent sfx files.
-void AudioManager::PlaySFX(const std::string &filename)
+/// @brief Return the state of whether two tracks are currently overlapping in a crossfade.
+/// @return true / false
+bool AudioManager::IsCrossfading() const
 {
-    CT_WARN_IF_UNINITIALIZED("AudioManager", "PlaySFX");
+    CT_WARN_IF_UNINITIALIZED_RET("AudioManager", "IsCrossfading", false);
+
+    return IsMusicRequestPending() ? m_requestedMusic.isCrossfading : m_status.isCrossfading.load();
+}
+
+/// @brief Opens a track on the idle deck from a background thread, parsing its header and filling its first stream
+/// buffers, so a later PlayMusic or SwitchTrack to it starts at once. Call it while the previous scene is still
+/// running. Music requests made before the prepare finishes wait for it, which costs no more than opening the track
+/// there and then; the audio thread keeps mixing and starting sound effects meanwhile.
+/// @param filename Music file to open.
+/// @return false if the AudioManager is not initialized; a track that cannot be prepared is opened by PlayMusic.
+bool AudioManager::PrepareMusic(const std::string &filename)
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AudioManager", "PrepareMusic", false);
 
-    sf::SoundBuffer &buffer = *AssetManager::Instance().GetSound(filename);
+    m_isPreparingMusic = true;
 
-    sf::Sound &sound = m_activeSounds[m_nextSoundIndex];
-    sound.setBuffer(buffer);
-    sound.setVolume(m_sfxVolume * m_masterVolume / 100.f);
-    sound.play();
+    Command command;
+    command.type = CommandType::PrepareMusic;
+    command.filename = filename;
+    Submit(std::move(command));
 
-    m_nextSoundIndex = (m_nextSoundIndex + 1) % MAX_SIMULTANEOUS_SOUNDS;
+    return true;
 }
 
-/// @brief Synchronizes the Settings object with the internals of the AudioManager volume controls.
-/// @param volume new masterVolume Settings to use.
-void AudioManager::SetMasterVolume(float volume)
+/// @brief Returns whether a track is still being prepared in the background.
+/// @return true / false
+bool AudioManager::IsPreparingMusic() const
 {
-    CT_WARN_IF_UNINITIALIZED("AudioManager", "SetMasterVolume");
+    return m_isPreparingMusic;
+}
 
-    m_masterVolume = std::clamp(volume, 0.f, 100.f);
+/// @brief Blocks until any background prepare has finished.
+void AudioManager::WaitForPreparedMusic()
+{
+    SyncAudioThread();
+    WaitForMusicLoader();
+}
 
-    if (m_settings)
+/// @brief Sets the region a track loops over, applied every time the track is opened.
+/// @param filename Music file, as passed to PlayMusic.
+/// @param points loop region in sample frames.
+void AudioManager::SetMusicLoopPoints(const std::string &filename, const MusicLoopPoints &points)
+{
+    Command command;
+    command.type = CommandType::SetLoopPoints;
+    command.filename = filename;
+    command.loopPoints = points;
+    Submit(std::move(command));
+}
+
+/// @brief Request to play a sound effect. The request is queued and started by the next flush, merged with any
+/// identical requests made in between.
+/// @param filename Name of a loaded sound.
+void AudioManager::PlaySFX(const std::string &filename)
+{
+    PlaySFX(MakeAssetId(filename));
+}
+
+/// @brief Request to play a sound effect by interned id, avoiding any string hashing on the call.
+/// @param id AssetId of a loaded sound.
+void AudioManager::PlaySFX(AssetId id)
+{
+    CT_WARN_IF_UNINITIALIZED("AudioManager", "PlaySFX");
+
+    if (const sf::SoundBuffer *buffer = AssetManager::Instance().GetSound(id))
     {
-        m_settings->m_masterVolume = m_masterVolume;
+        Command command;
+        command.type = CommandType::PlaySFX;
+        command.id = id;
+        command.buffer = buffer;
+        Submit(std::move(command));
     }
+}
+
+/// @brief Request to play a sound effect at a world position. It is panned and attenuated relative to the listener,
+/// and culled before it reaches a voice when it would be off screen or inaudible.
+/// @param filename Name of a loaded sound.
+/// @param position emitter position, in world units.
+void AudioManager::PlaySFX(const std::string &filename, const sf::Vector2f &position)
+{
+    PlaySFX(MakeAssetId(filename), position);
+}
+
+/// @brief Request to play a sound effect by interned id at a world position.
+/// @param id AssetId of a loaded sound.
+/// @param position emitter position, in world units.
+void AudioManager::PlaySFX(AssetId id, const sf::Vector2f &position)
+{
+    CT_WARN_IF_UNINITIALIZED("AudioManager", "PlaySFX");
 
-    // Recalculate final music volume if music is active
-    if (m_music)
+    if (const sf::SoundBuffer *buffer = AssetManager::Instance().GetSound(id))
     {
-        m_music->setVolume(m_isMuted ? 0.f : (m_musicVolume * m_masterVolume / 100.f));
+        Command command;
+        command.type = CommandType::PlaySFX;
+        command.id = id;
+        command.buffer = buffer;
+        command.isPositional = true;
+        command.position = position;
+        Submit(std::move(command));
     }
 }
 
-/// @brief Returns the AudioManagers current master volume.
-/// @return m_masterVolume.
-float AudioManager::GetMasterVolume() const
+/// @brief Loads the audio event definitions and every sound they use, replacing the previous ones. Handles resolved
+/// before keep pointing at the same event name; one whose event was removed plays nothing.
+/// @param filepath JSON file of events and music tracks; file names in it are relative to the audio directory.
+/// @return false if the file cannot be read or parsed.
+bool AudioManager::LoadEvents(const std::string &filepath)
 {
-    CT_WARN_IF_UNINITIALIZED_RET("AudioManager", "GetMasterVolume", 0.f);
+    CT_WARN_IF_UNINITIALIZED_RET("AudioManager", "LoadEvents", false);
 
-    return m_masterVolume;
+    return m_events.LoadFromFile(filepath, m_settings->m_audioDirectory);
 }
 
-/// @brief Synchronizes the Settings object with the internals of the AudioManager volume controls.
-/// @param volume new m_musicVolume.
-void AudioManager::SetMusicVolume(float volume)
+/// @brief Resolves an event name to its handle. Call once at load time; triggering by handle is then an array index.
+/// @param id MakeAssetId of the event name.
+/// @return handle, invalid if the event is unknown.
+AudioEventHandle AudioManager::GetEventHandle(AssetId id) const
 {
-    CT_WARN_IF_UNINITIALIZED("AudioManager", "SetMusicVolume");
+    return m_events.GetHandle(id);
+}
 
-    m_musicVolume = std::clamp(volume, 0.f, 100.f);
+/// @brief Returns the file of a music track named in the event data.
+/// @param id MakeAssetId of the track name.
+/// @return path ready for PlayMusic, or an empty string if the track is unknown.
+const std::string &AudioManager::GetEventTrack(AssetId id) const
+{
+    return m_events.GetTrack(id);
+}
 
-    if (m_settings)
+/// @brief Triggers an audio event: a random variation with random volume and pitch, unless it is cooling down.
+/// @param handle event resolved with GetEventHandle.
+void AudioManager::PlayEvent(AudioEventHandle handle)
+{
+    CT_WARN_IF_UNINITIALIZED("AudioManager", "PlayEvent");
+
+    SubmitEvent(handle, false, {});
+}
+
+/// @brief Triggers an audio event at a world position; it is panned, attenuated and culled like a positional PlaySFX.
+/// @param handle event resolved with GetEventHandle.
+/// @param position emitter position, in world units.
+void AudioManager::PlayEvent(AudioEventHandle handle, const sf::Vector2f &position)
+{
+    CT_WARN_IF_UNINITIALIZED("AudioManager", "PlayEvent");
+
+    SubmitEvent(handle, true, position);
+}
+
+/// @brief Returns the loaded audio events, for inspection and tests.
+/// @return m_events.
+AudioEventBank &AudioManager::GetEvents()
+{
+    return m_events;
+}
+
+/// @brief Rolls an event on the game thread and queues the chosen sound.
+/// @param handle event to trigger.
+/// @param isPositional whether position applies.
+/// @param position emitter position, in world units.
+void AudioManager::SubmitEvent(AudioEventHandle handle, bool isPositional, const sf::Vector2f &position)
+{
+    const double nowMs = GetClockMs(m_eventClock);
+    AudioEventShot shot;
+
+    if (!m_events.Trigger(handle, nowMs, shot))
     {
-        m_settings->m_musicVolume = m_musicVolume;
+        return;
     }
 
-    if (m_music)
+    Command command;
+    command.type = CommandType::PlayEvent;
+    command.buffer = shot.buffer;
+    command.gain = shot.gain;
+    command.pitch = shot.pitch;
+    command.bus = shot.bus;
+    command.sfxParams = shot.params;
+    command.isPositional = isPositional;
+    command.position = position;
+    Submit(std::move(command));
+}
+
+/// @brief Sets where positional sound effects are heard from. Call whenever the camera moves.
+/// @param position listener position, usually the view center.
+/// @param audibleSize area around the listener that can be heard, usually the view size.
+void AudioManager::SetListener(const sf::Vector2f &position, const sf::Vector2f &audibleSize)
+{
+    Command command;
+    command.type = CommandType::SetListener;
+    command.position = position;
+    command.size = audibleSize;
+    Submit(std::move(command));
+}
+
+/// @brief Returns how many times a positional sound effect started or went virtual for being off screen or out of range.
+/// @return m_culledSfxCount.
+std::size_t AudioManager::GetCulledSFXCount() const
+{
+    return m_culledSfxCount;
+}
+
+/// @brief Returns how many sound effects are playing virtually: tracked and keeping time, but holding no voice because
+/// they cannot be heard or every voice is taken. Counted at the end of each flush, so it is safe to read from any
+/// thread; call SyncAudioThread first for a count that includes the sounds just requested.
+/// @return m_virtualSfxCount.
+std::size_t AudioManager::GetVirtualSFXCount() const
+{
+    return m_virtualSfxCount;
+}
+
+/// @brief Returns how many sound effect requests were dropped because the audio thread's queue was full.
+/// @return m_droppedSfxCount.
+std::size_t AudioManager::GetDroppedSFXCount() const
+{
+    return m_droppedSfxCount;
+}
+
+/// @brief Starts the sound effects requested since the last call, one voice per distinct sound. Call once per frame,
+/// after the scenes have updated. With the audio thread running it flushes on its own and this does nothing.
+void AudioManager::FlushSFX()
+{
+    CT_WARN_IF_UNINITIALIZED("AudioManager", "FlushSFX");
+
+    if (!IsAudioThreadRunning())
     {
-        m_music->setVolume(m_isMuted ? 0.f : (m_musicVolume * m_masterVolume / 100.f));
+        FlushPendingSFX();
     }
 }
 
-/// @brief Returns the AudioManagers current music volume.
-/// @return m_musicVolume.
-float AudioManager::GetMusicVolume() const
+/// @brief Sets the priority and category a sound effect competes for voices with.
+/// @param id AssetId of the sound.
+/// @param params priority and category.
+void AudioManager::SetSFXParams(AssetId id, const SfxParams &params)
 {
-    CT_WARN_IF_UNINITIALIZED_RET("AudioManager", "GetMusicVolume", 0.f);
-    return m_musicVolume;
+    m_requestedSfxParams[id] = params;
+
+    Command command;
+    command.type = CommandType::SetSFXParams;
+    command.id = id;
+    command.sfxParams = params;
+    Submit(std::move(command));
 }
 
-/// @brief Synchronizes the Settings object with the internals of the AudioManager volume controls.
-/// @param volume new m_sfxVolume.
-void AudioManager::SetSFXVolume(float volume)
+/// @brief Returns the priority and category of a sound effect.
+/// @param id AssetId of the sound.
+/// @return configured params, or the defaults when none were set.
+SfxParams AudioManager::GetSFXParams(AssetId id) const
 {
-    CT_WARN_IF_UNINITIALIZED("AudioManager", "SetSFXVolume");
+    auto it = m_requestedSfxParams.find(id);
 
-    m_sfxVolume = std::clamp(volume, 0.f, 100.f);
+    return it == m_requestedSfxParams.end() ? SfxParams{} : it->second;
+}
 
-    if (m_settings)
+/// @brief Stops every sound effect and drops pending requests. Call before sound buffers are released or reloaded;
+/// returns once nothing reads them any more.
+void AudioManager::StopAllSFX()
+{
+    Command command;
+    command.type = CommandType::StopAllSFX;
+    Submit(std::move(command));
+
+    SyncAudioThread();
+}
+
+/// @brief Routes sound effects through the software mixer instead of one OpenAL source per voice. Sounds already
+/// playing finish on the path they started on.
+/// @param isEnabled true to mix in software.
+void AudioManager::SetSoftwareMixing(bool isEnabled)
+{
+    CT_WARN_IF_UNINITIALIZED("AudioManager", "SetSoftwareMixing");
+
+    if (isEnabled == m_isSoftwareMixing)
     {
-        m_settings->m_sfxVolume = m_sfxVolume;
+        return;
     }
+
+    m_isSoftwareMixing = isEnabled;
+
+    Command command;
+    command.type = CommandType::SetSoftwareMixing;
+    command.isEnabled = isEnabled;
+    Submit(std::move(command));
 }
 
-/// @brief Returns the AudioManagers current sfx volume.
-/// @return m_sfxVolume.
-float AudioManager::GetSFXVolume() const
+/// @brief Returns whether sound effects go through the software mixer.
+/// @return true / false
+bool AudioManager::IsSoftwareMixing() const
 {
-    CT_WARN_IF_UNINITIALIZED_RET("AudioManager", "GetSFXVolume", 0.f);
+    return m_isSoftwareMixing;
+}
 
-    return m_sfxVolume;
+/// @brief Returns the software mixer, to read its voice count. Owned by the audio thread, whose tick waits while the
+/// access is held; call SyncAudioThread first so queued requests have run.
+/// @return the mixer, empty while software mixing is off.
+AudioStateAccess<SoftwareMixer> AudioManager::GetSoftwareMixer()
+{
+    std::unique_lock<std::mutex> lock(m_tickMutex);
+
+    return AudioStateAccess<SoftwareMixer>(std::move(lock), m_mixer.get());
 }
 
-/// @brief Sets the current volume to zero (mute), synchronizes the Settings object.
-void AudioManager::Mute()
+/// @brief Returns the bus gains, to adjust buses such as UI that have no setting of their own. Owned by the audio
+/// thread, whose tick waits while the access is held; call SyncAudioThread first so queued requests have run.
+/// @return m_buses.
+AudioStateAccess<AudioBuses> AudioManager::GetBuses()
 {
-    CT_WARN_IF_UNINITIALIZED("AudioManager", "Mute");
+    std::unique_lock<std::mutex> lock(m_tickMutex);
 
-    m_isMuted = true;
+    return AudioStateAccess<AudioBuses>(std::move(lock), &m_buses);
+}
+
+/// @brief Stops playing through the audio device and renders the mix on demand with Render instead, on a virtual clock
+/// that only advances with the frames rendered. Needs no sound card and runs as fast as the CPU allows, so fades,
+/// request merging, buses and mixing can be checked deterministically on any machine. Music and sound effects playing
+/// now are stopped; from here on sound effects always go through the software mixer, so the SfxVoicePool and its
+/// voice stealing play no part.
+/// @param sampleRate rate of the rendered mix. Only sounds and music at this rate can be heard in it.
+/// @return false if the audio thread is running; offline, the thread calling Render owns the audio state.
+bool AudioManager::StartOfflineRender(unsigned int sampleRate)
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AudioManager", "StartOfflineRender", false);
 
-    if (m_music)
+    if (IsAudioThreadRunning())
     {
-        m_music->setVolume(0.f);
+        CT_LOG_WARN("AudioManager: stop the audio thread before rendering offline.");
+
+        return false;
     }
 
-    if (m_settings)
+    StopOfflineRender();
+    WaitForMusicLoader();
+    ExecuteStopAllSFX();
+
+    for (auto &deck : m_decks)
     {
-        m_settings->m_isMuted = true;
+        deck->SetOffline(true);
     }
 
-    CT_LOG_INFO("AudioManager muted");
-}
+    m_isCrossfading = false;
+    m_isFadingIn = false;
+    m_isFadingOut = false;
 
-/// @brief Sets the current volume to the musicVolume previously set before mute. Synchronizes the Settings object.
-void AudioManager::Unmute()
-{
-    CT_WARN_IF_UNINITIALIZED("AudioManager", "Unmute");
+    // Never played: Render pulls its mix instead of the SFML stream thread.
+    m_mixer = std::make_unique<SoftwareMixer>(m_buses, sampleRate);
+    m_renderSampleRate = sampleRate;
+    m_renderedFrames = 0;
+    m_renderMix.assign(sampleRate * AUDIO_TICK.count() / 1000 * RENDER_CHANNELS, 0.f);
+    m_isOfflineRendering = true;
+    PublishStatus();
 
-    m_isMuted = false;
+    CT_LOG_INFO("AudioManager: rendering offline at {} Hz.", sampleRate);
 
-    if (m_music)
+    return true;
+}
+
+/// @brief Returns to playing through the audio device. Everything rendered offline is stopped.
+void AudioManager::StopOfflineRender()
+{
+    if (!m_isOfflineRendering)
     {
-        m_music->setVolume(m_musicVolume * m_masterVolume / 100.f);
+        return;
     }
 
-    if (m_settings)
+    WaitForMusicLoader();
+    ExecuteStopAllSFX();
+
+    for (auto &deck : m_decks)
     {
-        m_settings->m_isMuted = false;
+        deck->SetOffline(false);
     }
 
-    CT_LOG_INFO("AudioManager unmuted");
+    m_isCrossfading = false;
+    m_isFadingIn = false;
+    m_isFadingOut = false;
+
+    m_mixer.reset();
+    m_isOfflineRendering = false;
+    ExecuteSetSoftwareMixing(m_isSoftwareMixing);
+    PublishStatus();
+
+    CT_LOG_INFO("AudioManager: offline rendering stopped after {} frames.", m_renderedFrames);
 }
 
-/// @brief Returns the state of whether or not the AudioManager is muted.
-/// @return true / false
-bool AudioManager::IsMuted() const
+/// @brief Returns whether the mix is rendered offline.
+/// @return m_isOfflineRendering.
+bool AudioManager::IsOfflineRendering() const
 {
-    CT_WARN_IF_UNINITIALIZED_RET("AudioManager", "IsMuted", false);
-
-    return m_isMuted;
+    return m_isOfflineRendering;
 }
 
-/// @brief Adjusts the currently playing sound track to the requested file with optional loop feature.
-/// @param filename new File track to attempt to play.
-/// @param loop whether or not to loop the file.
-void AudioManager::SwitchTrack(const std::string &filename, bool loop)
+/// @brief Renders the next frames of the mix offline and advances the virtual clock by them. Each block of one audio
+/// thread tick plays out as that tick would: pending sound effects start, voices and music are mixed, and finished
+/// fades complete. Rendering a span therefore behaves exactly like the same span of real time.
+/// @param output receives frames * 2 interleaved stereo samples.
+/// @param frames frames to render.
+void AudioManager::Render(sf::Int16 *output, std::size_t frames)
 {
-    CT_WARN_IF_UNINITIALIZED("AudioManager", "SwitchTrack");
+    CT_WARN_IF_UNINITIALIZED("AudioManager", "Render");
 
-    if (m_currentTrack == filename)
+    if (!m_isOfflineRendering)
     {
-        CT_LOG_INFO("Requested track '{}' is already playing", filename);
+        CT_LOG_WARN("AudioManager: Render needs StartOfflineRender first.");
+        std::fill_n(output, frames * RENDER_CHANNELS, sf::Int16{0});
 
         return;
     }
 
-    StopMusic(true);
-    PlayMusic(filename, loop, true);
+    const std::size_t tickFrames = std::max<std::size_t>(1, m_renderMix.size() / RENDER_CHANNELS);
+
+    for (std::size_t done = 0; done < frames;)
+    {
+        const std::size_t count = std::min(frames - done, tickFrames);
+
+        FlushPendingSFX();
+
+        std::fill_n(m_renderMix.begin(), count * RENDER_CHANNELS, 0.f);
+        m_mixer->Accumulate(m_renderMix.data(), count);
+        ActiveDeck().Render(m_renderMix.data(), count, m_renderSampleRate);
+
+        // The idle deck belongs to the music loader while a prepare runs.
+        if (!m_isLoadingIdleDeck)
+        {
+            IdleDeck().Render(m_renderMix.data(), count, m_renderSampleRate);
+        }
+
+        ConvertToInt16(m_renderMix.data(), output + done * RENDER_CHANNELS, count * RENDER_CHANNELS);
+
+        m_renderedFrames += count;
+        done += count;
+
+        UpdateFades();
+    }
+
+    PublishStatus();
 }
 
-/// @brief Returns the current music string name.
-/// @return m_currentTrack.
-const std::string &AudioManager::GetCurrentMusicName() const
+/// @brief Renders the next seconds of the mix offline into a 16 bit stereo sound file, such as a WAV.
+/// @param filepath file to write; its extension picks the format.
+/// @param seconds length to render.
+/// @return false if not rendering offline or the file cannot be written.
+bool AudioManager::RenderToFile(const std::string &filepath, float seconds)
 {
-    return m_currentTrack;
+    CT_WARN_IF_UNINITIALIZED_RET("AudioManager", "RenderToFile", false);
+
+    if (!m_isOfflineRendering)
+    {
+        CT_LOG_WARN("AudioManager: RenderToFile needs StartOfflineRender first.");
+
+        return false;
+    }
+
+    sf::OutputSoundFile file;
+
+    if (!file.openFromFile(filepath, m_renderSampleRate, RENDER_CHANNELS))
+    {
+        CT_LOG_ERROR("AudioManager: failed to open '{}' for writing.", filepath);
+
+        return false;
+    }
+
+    std::vector<sf::Int16> block(FILE_BLOCK_FRAMES * RENDER_CHANNELS);
+    std::size_t remaining = static_cast<std::size_t>(std::max(0.f, seconds) * m_renderSampleRate);
+
+    while (remaining > 0)
+    {
+        const std::size_t count = std::min(remaining, FILE_BLOCK_FRAMES);
+
+        Render(block.data(), count);
+        file.write(block.data(), count * RENDER_CHANNELS);
+
+        remaining -= count;
+    }
+
+    CT_LOG_INFO("AudioManager: rendered {} seconds to '{}'.", seconds, filepath);
+
+    return true;
+}
+
+/// @brief Returns how far the virtual clock has advanced since StartOfflineRender.
+/// @return frames rendered.
+std::uint64_t AudioManager::GetRenderedFrames() const
+{
+    return m_renderedFrames;
+}
+
+/// @brief Returns the sound effect voice pool, to configure its limits or read its steal counts. Owned by the audio
+/// thread, whose tick waits while the access is held; call SyncAudioThread first so queued requests have run.
+/// @return m_sfxVoices.
+AudioStateAccess<SfxVoicePool> AudioManager::GetSFXVoicePool()
+{
+    std::unique_lock<std::mutex> lock(m_tickMutex);
+
+    return AudioStateAccess<SfxVoicePool>(std::move(lock), &m_sfxVoices);
+}
+
+/// @brief Returns the sound effect request merger, to configure its window or read its merge count. Owned by the audio
+/// thread, whose tick waits while the access is held; call SyncAudioThread first so queued requests have run.
+/// @return m_sfxRequests.
+AudioStateAccess<SfxCoalescer> AudioManager::GetSFXCoalescer()
+{
+    std::unique_lock<std::mutex> lock(m_tickMutex);
+
+    return AudioStateAccess<SfxCoalescer>(std::move(lock), &m_sfxRequests);
+}
+
+/// @brief Synchronizes the Settings object with the internals of the AudioManager volume controls.
+/// @param volume new masterVolume Settings to use.
+void AudioManager::SetMasterVolume(float volume)
+{
+    CT_WARN_IF_UNINITIALIZED("AudioManager", "SetMasterVolume");
+
+    m_masterVolume = std::clamp(volume, 0.f, 100.f);
+
+    if (m_settings)
+    {
+        m_settings->m_masterVolume = m_masterVolume;
+    }
+
+    SubmitBusGains();
+}
+
+/// @brief Returns the AudioManagers current master volume.
+/// @return m_masterVolume.
+float AudioManager::GetMasterVolume() const
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AudioManager", "GetMasterVolume", 0.f);
+
+    return m_masterVolume;
+}
+
+/// @brief Synchronizes the Settings object with the internals of the AudioManager volume controls.
+/// @param volume new m_musicVolume.
+void AudioManager::SetMusicVolume(float volume)
+{
+    CT_WARN_IF_UNINITIALIZED("AudioManager", "SetMusicVolume");
+
+    m_musicVolume = std::clamp(volume, 0.f, 100.f);
+
+    if (m_settings)
+    {
+        m_settings->m_musicVolume = m_musicVolume;
+    }
+
+    SubmitBusGains();
+}
+
+/// @brief Returns the AudioManagers current music volume.
+/// @return m_musicVolume.
+float AudioManager::GetMusicVolume() const
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AudioManager", "GetMusicVolume", 0.f);
+    return m_musicVolume;
+}
+
+/// @brief Synchronizes the Settings object with the internals of the AudioManager volume controls.
+/// @param volume new m_sfxVolume.
+void AudioManager::SetSFXVolume(float volume)
+{
+    CT_WARN_IF_UNINITIALIZED("AudioManager", "SetSFXVolume");
+
+    m_sfxVolume = std::clamp(volume, 0.f, 100.f);
+
+    if (m_settings)
+    {
+        m_settings->m_sfxVolume = m_sfxVolume;
+    }
+
+    SubmitBusGains();
+}
+
+/// @brief Returns the AudioManagers current sfx volume.
+/// @return m_sfxVolume.
+float AudioManager::GetSFXVolume() const
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AudioManager", "GetSFXVolume", 0.f);
+
+    return m_sfxVolume;
+}
+
+/// @brief Sets the current volume to zero (mute), synchronizes the Settings object.
+void AudioManager::Mute()
+{
+    CT_WARN_IF_UNINITIALIZED("AudioManager", "Mute");
+
+    m_isMuted = true;
+    SubmitBusGains();
+
+    if (m_settings)
+    {
+        m_settings->m_isMuted = true;
+    }
+
+    CT_LOG_INFO("AudioManager muted");
+}
+
+/// @brief Sets the current volume to the musicVolume previously set before mute. Synchronizes the Settings object.
+void AudioManager::Unmute()
+{
+    CT_WARN_IF_UNINITIALIZED("AudioManager", "Unmute");
+
+    m_isMuted = false;
+    SubmitBusGains();
+
+    if (m_settings)
+    {
+        m_settings->m_isMuted = false;
+    }
+
+    CT_LOG_INFO("AudioManager unmuted");
+}
+
+/// @brief Returns the state of whether or not the AudioManager is muted.
+/// @return true / false
+bool AudioManager::IsMuted() const
+{
+    CT_WARN_IF_UNINITIALIZED_RET("AudioManager", "IsMuted", false);
+
+    return m_isMuted;
+}
+
+/// @brief Crossfades from the current track to the requested file. The new track starts on the idle deck, opened
+/// there ahead of time if PrepareMusic was called, while the old one keeps playing until the crossfade ends.
+/// @param filename new File track to attempt to play.
+/// @param loop whether or not to loop the file.
+/// @param crossfadeDuration seconds both tracks overlap.
+void AudioManager::SwitchTrack(const std::string &filename, bool loop, float crossfadeDuration)
+{
+    CT_WARN_IF_UNINITIALIZED("AudioManager", "SwitchTrack");
+
+    m_currentTrack = filename;
+
+    Command command;
+    command.type = CommandType::SwitchTrack;
+    command.filename = filename;
+    command.loop = loop;
+    command.duration = crossfadeDuration;
+    RequestMusic(command, {true, false, false, true});
+    Submit(std::move(command));
+}
+
+/// @brief Returns the name of the track last requested through PlayMusic or SwitchTrack.
+/// @return m_currentTrack.
+const std::string &AudioManager::GetCurrentMusicName() const
+{
+    return m_currentTrack;
+}
+
+/// @brief Hands a command to the audio thread, or runs it right away when no audio thread is running. Never waits for
+/// the audio thread: a command that finds the queue full is held back by Overflow. Game thread only: the queue has a
+/// single producer.
+/// @param command request to run.
+void AudioManager::Submit(Command &&command)
+{
+    if (!IsAudioThreadRunning())
+    {
+        // This thread owns the audio state, so it may as well wait for the idle deck itself.
+        if (IsMusicCommand(command.type))
+        {
+            WaitForMusicLoader();
+        }
+
+        RunCommand(command);
+
+        return;
+    }
+
+    // Anything already held back goes first, so commands still reach the audio thread in the order they were made.
+    if (PushOverflow() && m_commands.Push(std::move(command)))
+    {
+        ++m_submittedCount;
+
+        return;
+    }
+
+    Overflow(std::move(command));
+}
+
+/// @brief Holds back a command the full queue has no room for. The audio thread drains the queue every tick, so this
+/// only happens after a burst of a few hundred requests: sound effects in it are dropped and counted, a volume or
+/// listener change replaces the one already waiting, and everything else waits its turn in order.
+/// @param command request that did not fit.
+void AudioManager::Overflow(Command &&command)
+{
+    if (command.type == CommandType::PlaySFX || command.type == CommandType::PlayEvent)
+    {
+        ++m_droppedSfxCount;
+
+        CT_LOG_DEBUG("AudioManager: audio queue full, dropped a sound effect request.");
+
+        return;
+    }
+
+    if (command.type == CommandType::SetBusGains || command.type == CommandType::SetListener)
+    {
+        auto it = std::find_if(m_overflowCommands.begin(), m_overflowCommands.end(),
+                               [&command](const Command &waiting) { return waiting.type == command.type; });
+
+        if (it != m_overflowCommands.end())
+        {
+            *it = std::move(command);
+
+            return;
+        }
+    }
+
+    m_overflowCommands.push_back(std::move(command));
+}
+
+/// @brief Moves held back commands into the queue, oldest first, while there is room.
+/// @return true once none are held back.
+bool AudioManager::PushOverflow()
+{
+    while (!m_overflowCommands.empty() && m_commands.Push(std::move(m_overflowCommands.front())))
+    {
+        m_overflowCommands.pop_front();
+        ++m_submittedCount;
+    }
+
+    return m_overflowCommands.empty();
+}
+
+/// @brief Marks a command as a music request and records the state it asks for, which the music queries answer with
+/// until the audio thread has run it.
+/// @param command command about to be submitted.
+/// @param requested music status once it has run.
+void AudioManager::RequestMusic(Command &command, const RequestedMusic &requested)
+{
+    command.isMusicRequest = true;
+    m_requestedMusic = requested;
+    ++m_musicRequestCount;
+}
+
+/// @brief Returns whether the last music request is still waiting for the audio thread. Music requests run in the
+/// order they were made, so a count is enough to tell.
+/// @return true / false
+bool AudioManager::IsMusicRequestPending() const
+{
+    return m_executedMusicRequestCount.load(std::memory_order_acquire) < m_musicRequestCount;
+}
+
+/// @brief Sends the current volume settings to the buses.
+void AudioManager::SubmitBusGains()
+{
+    Command command;
+    command.type = CommandType::SetBusGains;
+    command.masterVolume = m_masterVolume;
+    command.musicVolume = m_musicVolume;
+    command.sfxVolume = m_sfxVolume;
+    command.isMuted = m_isMuted;
+    Submit(std::move(command));
+}
+
+/// @brief Body of the audio thread: runs queued commands, then finishes completed fades and starts sound effects every
+/// tick, so neither waits for a slow game frame. Music commands that arrive while the loader owns the idle deck are
+/// held back to a later tick rather than waited for. m_tickMutex is held for one command or one sound effect flush at
+/// a time, and not at all for music, which only touches the decks, so an AudioStateAccess on the game thread never
+/// sees that work half done and never waits for a whole tick.
+void AudioManager::AudioThreadLoop()
+{
+    while (true)
+    {
+        const bool isRunning = m_isThreadRunning;
+        const auto now = std::chrono::steady_clock::now();
+        Command command;
+
+        RunDeferredMusic();
+
+        while (m_commands.Pop(command))
+        {
+            if (IsMusicCommand(command.type))
+            {
+                if (m_isLoadingIdleDeck || !m_deferredMusic.empty())
+                {
+                    m_deferredMusic.push_back(std::move(command));
+
+                    continue;
+                }
+
+                RunCommand(command);
+            }
+            else
+            {
+                std::lock_guard<std::mutex> lock(m_tickMutex);
+                RunCommand(command);
+            }
+
+            m_executedCount.fetch_add(1, std::memory_order_release);
+        }
+
+        if (!isRunning)
+        {
+            // Stopping may block: every command submitted so far runs before the thread exits.
+            while (!m_deferredMusic.empty())
+            {
+                WaitForMusicLoader();
+                RunDeferredMusic();
+            }
+
+            break;
+        }
+
+        UpdateFades();
+        PublishStatus();
+
+        {
+            std::lock_guard<std::mutex> lock(m_tickMutex);
+            FlushPendingSFX();
+        }
+
+        std::this_thread::sleep_until(now + AUDIO_TICK);
+    }
+}
+
+/// @brief Returns whether a command reads or changes the music decks, and so has to wait while the loader holds the
+/// idle deck.
+/// @param type command to check.
+/// @return true / false
+bool AudioManager::IsMusicCommand(CommandType type)
+{
+    switch (type)
+    {
+        case CommandType::PlayMusic:
+        case CommandType::StopMusic:
+        case CommandType::PauseMusic:
+        case CommandType::ResumeMusic:
+        case CommandType::SwitchTrack:
+        case CommandType::PrepareMusic:
+        case CommandType::SetLoopPoints:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/// @brief Runs the held back music commands in order, once the loader has let go of the idle deck. Stops again if one
+/// of them starts another prepare.
+void AudioManager::RunDeferredMusic()
+{
+    while (!m_deferredMusic.empty() && !m_isLoadingIdleDeck)
+    {
+        Command command = std::move(m_deferredMusic.front());
+        m_deferredMusic.pop_front();
+
+        RunCommand(command);
+        m_executedCount.fetch_add(1, std::memory_order_release);
+    }
+}
+
+/// @brief Runs a command and publishes the music status it leaves, before marking a music request as run.
+/// @param command request to run.
+void AudioManager::RunCommand(Command &command)
+{
+    ExecuteCommand(command);
+    PublishStatus();
+
+    if (command.isMusicRequest)
+    {
+        m_executedMusicRequestCount.fetch_add(1, std::memory_order_release);
+    }
+}
+
+/// @brief Runs one command on the thread that owns the audio state.
+/// @param command request to run; its strings may be moved from.
+void AudioManager::ExecuteCommand(Command &command)
+{
+    switch (command.type)
+    {
+        case CommandType::PlayMusic:
+            ExecutePlayMusic(command.filename, command.loop, command.fade, command.duration, command.curve);
+            break;
+
+        case CommandType::StopMusic:
+            ExecuteStopMusic(command.fade, command.duration, command.curve);
+            break;
+
+        case CommandType::PauseMusic:
+            ExecutePauseMusic();
+            break;
+
+        case CommandType::ResumeMusic:
+            ExecuteResumeMusic();
+            break;
+
+        case CommandType::SwitchTrack:
+            ExecuteSwitchTrack(command.filename, command.loop, command.duration);
+            break;
+
+        case CommandType::PrepareMusic:
+            ExecutePrepareMusic(command.filename);
+            break;
+
+        case CommandType::SetLoopPoints:
+            ExecuteSetLoopPoints(command.filename, command.loopPoints);
+            break;
+
+        case CommandType::PlaySFX:
+            if (command.isPositional)
+            {
+                const SfxParams params = FindSfxParams(command.id);
+                m_spatialRequests.push_back({command.buffer, command.position, params, BusFor(params)});
+            }
+            else
+            {
+                m_sfxRequests.Queue(command.id, *command.buffer);
+            }
+            break;
+
+        case CommandType::PlayEvent:
+            ExecutePlayEvent(command);
+            break;
+
+        case CommandType::SetSFXParams:
+            m_sfxParams[command.id] = command.sfxParams;
+            break;
+
+        case CommandType::StopAllSFX:
+            ExecuteStopAllSFX();
+            break;
+
+        case CommandType::SetBusGains:
+            ApplyBusGains(command.masterVolume, command.musicVolume, command.sfxVolume, command.isMuted);
+            break;
+
+        case CommandType::SetSoftwareMixing:
+            ExecuteSetSoftwareMixing(command.isEnabled);
+            break;
+
+        case CommandType::SetListener:
+            m_listener.position = command.position;
+            m_listener.halfExtents = command.size / 2.f;
+            break;
+    }
+}
+
+/// @brief Starts a track on the active deck, swapping decks first when the idle one already holds it.
+/// @param filename Music file to play.
+/// @param loop Whether or not to loop.
+/// @param fadeIn IsFadingIn?
+/// @param fadeDuration How long to fade.
+/// @param curve Shape of the fade.
+void AudioManager::ExecutePlayMusic(const std::string &filename, bool loop, bool fadeIn, float fadeDuration,
+                                    EnvelopeCurve curve)
+{
+    m_isCrossfading = false;
+    m_isFadingOut = false;
+
+    if (IdleDeck().GetTrack() == filename)
+    {
+        ActiveDeck().Stop();
+        m_activeDeck = 1 - m_activeDeck;
+    }
+
+    IdleDeck().Stop();
+
+    if (!LoadOnDeck(ActiveDeck(), filename, loop))
+    {
+        return;
+    }
+
+    m_playingTrack = filename;
+    m_isFadingIn = fadeIn;
+
+    ActiveDeck().SetGain(fadeIn ? 0.f : 1.f);
+
+    if (fadeIn)
+    {
+        ActiveDeck().FadeTo(1.f, fadeDuration, curve);
+    }
+
+    ActiveDeck().Play();
+
+    CT_LOG_INFO("Playing music: '{}' | Loop: {} | FadeIn: {}", filename, loop, fadeIn);
+}
+
+/// @brief Stops the music at once, or starts fading it out.
+/// @param fadeOut Opt to slowly diminish volume on stop.
+/// @param fadeDuration Duration to fade if fadeOut true.
+/// @param curve Shape of the fade.
+void AudioManager::ExecuteStopMusic(bool fadeOut, float fadeDuration, EnvelopeCurve curve)
+{
+    m_isFadingIn = false;
+
+    if (fadeOut)
+    {
+        m_isFadingOut = true;
+        ActiveDeck().FadeTo(0.f, fadeDuration, curve);
+    }
+    else
+    {
+        m_isFadingOut = false;
+        m_isCrossfading = false;
+        ActiveDeck().Stop();
+        IdleDeck().Stop();
+    }
+
+    CT_LOG_INFO("Stopping music. FadeOut: {}", fadeOut);
+}
+
+/// @brief Pauses both decks if music is playing.
+void AudioManager::ExecutePauseMusic()
+{
+    if (ActiveDeck().IsPlaying())
+    {
+        ActiveDeck().Pause();
+        IdleDeck().Pause();
+        CT_LOG_INFO("Music paused");
+    }
+}
+
+/// @brief Resumes both decks if music is paused.
+void AudioManager::ExecuteResumeMusic()
+{
+    if (ActiveDeck().IsPaused())
+    {
+        ActiveDeck().Resume();
+        IdleDeck().Resume();
+        CT_LOG_INFO("Music resumed");
+    }
+}
+
+/// @brief Starts the crossfade to a track on the idle deck.
+/// @param filename new File track to attempt to play.
+/// @param loop whether or not to loop the file.
+/// @param crossfadeDuration seconds both tracks overlap.
+void AudioManager::ExecuteSwitchTrack(const std::string &filename, bool loop, float crossfadeDuration)
+{
+    if (m_playingTrack == filename && ActiveDeck().IsPlaying() && !m_isFadingOut)
+    {
+        CT_LOG_INFO("Requested track '{}' is already playing", filename);
+
+        return;
+    }
+
+    if (m_isCrossfading)
+    {
+        // The deck still fading out is the one about to be reused; cut it rather than restart it.
+        IdleDeck().Stop();
+    }
+
+    if (!LoadOnDeck(IdleDeck(), filename, loop))
+    {
+        return;
+    }
+
+    m_activeDeck = 1 - m_activeDeck;
+    m_playingTrack = filename;
+
+    m_isFadingIn = false;
+    m_isFadingOut = false;
+    m_isCrossfading = true;
+
+    // Equal power: the summed loudness of both decks stays level through the whole crossfade. The outgoing deck
+    // fades from wherever an interrupted fade left it.
+    IdleDeck().FadeTo(0.f, crossfadeDuration, EnvelopeCurve::EqualPower);
+    ActiveDeck().SetGain(0.f);
+    ActiveDeck().FadeTo(1.f, crossfadeDuration, EnvelopeCurve::EqualPower);
+    ActiveDeck().Play();
+
+    CT_LOG_INFO("Crossfading music to '{}' over {:.2f} s.", filename, crossfadeDuration);
+}
+
+/// @brief Hands the idle deck to the music loader to open and prime a track.
+/// @param filename Music file to open.
+void AudioManager::ExecutePrepareMusic(const std::string &filename)
+{
+    if (ActiveDeck().GetTrack() == filename || IdleDeck().GetTrack() == filename)
+    {
+        m_isPreparingMusic = false;
+
+        return;
+    }
+
+    if (m_isCrossfading)
+    {
+        CT_LOG_WARN("AudioManager: cannot prepare '{}' during a crossfade.", filename);
+        m_isPreparingMusic = false;
+
+        return;
+    }
+
+    MusicDeck *deck = &IdleDeck();
+    m_isLoadingIdleDeck = true;
+
+    m_musicLoader->Submit(
+        [this, deck, filename]()
+        {
+            if (deck->Open(filename))
+            {
+                deck->Prime();
+
+                CT_LOG_INFO("Prepared music: '{}'", filename);
+            }
+
+            // Publishes the deck to the audio thread, which polls this every tick.
+            m_isPreparingMusic = false;
+            m_isLoadingIdleDeck = false;
+        });
+}
+
+/// @brief Records loop points and applies them to any deck already holding the track.
+/// @param filename Music file, as passed to PlayMusic.
+/// @param points loop region in sample frames.
+void AudioManager::ExecuteSetLoopPoints(const std::string &filename, const MusicLoopPoints &points)
+{
+    m_loopPoints[filename] = points;
+
+    if (!m_isInitialized)
+    {
+        return;
+    }
+
+    for (MusicDeck *deck : {&ActiveDeck(), &IdleDeck()})
+    {
+        if (deck->GetTrack() == filename)
+        {
+            deck->SetLoopPoints(points);
+        }
+    }
+}
+
+/// @brief Stops every sound effect voice and drops pending requests.
+void AudioManager::ExecuteStopAllSFX()
+{
+    m_sfxRequests.Clear();
+    m_liveSfx.clear();
+    m_spatialRequests.clear();
+    m_sfxInstances.clear();
+    m_instanceEmitters.Clear();
+    m_virtualSfxCount = 0;
+    m_sfxVoices.StopAll();
+
+    if (m_mixer)
+    {
+        m_mixer->StopAll();
+    }
+}
+
+/// @brief Creates or destroys the software mixer.
+/// @param isEnabled true to mix in software.
+void AudioManager::ExecuteSetSoftwareMixing(bool isEnabled)
+{
+    // Offline rendering keeps its own mixer; the choice applies once it stops.
+    if (m_isOfflineRendering || isEnabled == (m_mixer != nullptr))
+    {
+        return;
+    }
+
+    // Voices already playing finish where they are, unmanaged.
+    m_liveSfx.clear();
+    m_sfxInstances.clear();
+    m_instanceEmitters.Clear();
+    m_virtualSfxCount = 0;
+
+    if (isEnabled)
+    {
+        m_mixer = std::make_unique<SoftwareMixer>(m_buses);
+        m_mixer->play();
+    }
+    else
+    {
+        m_mixer.reset();
+    }
+
+    CT_LOG_INFO("AudioManager: software mixing {}.", isEnabled ? "enabled" : "disabled");
+}
+
+/// @brief Finishes the crossfade and the fades in and out once the decks have played them to the end.
+void AudioManager::UpdateFades()
+{
+    if (m_isCrossfading && !ActiveDeck().IsFading() && !IdleDeck().IsFading())
+    {
+        m_isCrossfading = false;
+        IdleDeck().Stop();
+
+        CT_LOG_INFO("Music crossfade complete.");
+    }
+
+    if (m_isFadingOut && !ActiveDeck().IsFading())
+    {
+        m_isFadingOut = false;
+        ActiveDeck().Stop();
+
+        CT_LOG_INFO("Music fade-out complete.");
+    }
+
+    if (m_isFadingIn && !ActiveDeck().IsFading())
+    {
+        m_isFadingIn = false;
+
+        CT_LOG_INFO("Music fade-in complete.");
+    }
+}
+
+/// @brief Starts the sound effects queued since the previous flush.
+void AudioManager::FlushPendingSFX()
+{
+    const double nowMs = GetClockMs(m_sfxClock);
+
+    for (const SfxRequest &request : m_sfxRequests.Flush(nowMs, m_sfxParams))
+    {
+        StartRequest(request);
+    }
+
+    StartSpatialRequests();
+    UpdateSfxInstances();
+}
+
+/// @brief Copies the music state the game thread may query into m_status.
+void AudioManager::PublishStatus()
+{
+    m_status.isMusicPlaying = m_decks[m_activeDeck] && m_decks[m_activeDeck]->IsPlaying();
+    m_status.isFadingIn = m_isFadingIn;
+    m_status.isFadingOut = m_isFadingOut;
+    m_status.isCrossfading = m_isCrossfading;
+}
+
+/// @brief Returns the time on a clock, or on the virtual clock while rendering offline.
+/// @param clock real time clock to read when not rendering offline.
+/// @return milliseconds.
+double AudioManager::GetClockMs(const sf::Clock &clock) const
+{
+    if (m_isOfflineRendering)
+    {
+        return static_cast<double>(m_renderedFrames) * 1000.0 / m_renderSampleRate;
+    }
+
+    return static_cast<double>(clock.getElapsedTime().asMicroseconds()) / 1000.0;
+}
+
+/// @brief Returns the params the audio side holds for a sound effect.
+/// @param id AssetId of the sound.
+/// @return configured params, or the defaults when none were set.
+SfxParams AudioManager::FindSfxParams(AssetId id) const
+{
+    auto it = m_sfxParams.find(id);
+
+    return it == m_sfxParams.end() ? SfxParams{} : it->second;
+}
+
+/// @brief Starts one merged request as a new sound effect instance, or folds it into the instance the sound started
+/// moments ago, raising that instance's gain.
+/// @param request merged requests for one sound.
+void AudioManager::StartRequest(const SfxRequest &request)
+{
+    LiveSfx &live = m_liveSfx[request.id];
+    SfxInstance *previous = FindInstance(live.instance);
+
+    if (request.isRetrigger && previous && previous->buffer == request.buffer)
+    {
+        live.count += request.count;
+        previous->gain = SfxCoalescer::GainFor(live.count);
+
+        return;
+    }
+
+    SfxInstance instance;
+    instance.buffer = request.buffer;
+    instance.params = FindSfxParams(request.id);
+    instance.bus = BusFor(instance.params);
+    instance.gain = SfxCoalescer::GainFor(request.count);
+
+    live.instance = StartInstance(instance, {}, 1.f, 0.f, true);
+    live.count = request.count;
+}
+
+/// @brief Starts a rolled audio event. Events skip same-frame merging, their cooldown already limits them; a positional
+/// one waits for the next flush to be batched with the others. The software mixer ignores pitch.
+/// @param command PlayEvent command.
+void AudioManager::ExecutePlayEvent(const Command &command)
+{
+    if (command.isPositional)
+    {
+        m_spatialRequests.push_back(
+            {command.buffer, command.position, command.sfxParams, command.bus, command.gain, command.pitch});
+
+        return;
+    }
+
+    SfxInstance instance;
+    instance.buffer = command.buffer;
+    instance.params = command.sfxParams;
+    instance.bus = command.bus;
+    instance.gain = command.gain;
+    instance.pitch = command.pitch;
+
+    StartInstance(instance, {}, 1.f, 0.f, true);
+}
+
+/// @brief Starts the positional requests queued since the previous flush. Gain, pan and audibility of the whole batch
+/// are computed in one pass; requests that cannot be heard start virtual, without taking a voice.
+void AudioManager::StartSpatialRequests()
+{
+    if (m_spatialRequests.empty())
+    {
+        return;
+    }
+
+    m_requestEmitters.Clear();
+
+    for (const SpatialRequest &request : m_spatialRequests)
+    {
+        m_requestEmitters.Add(request.position, request.params.attenuation);
+    }
+
+    m_requestEmitters.Compute(m_listener);
+
+    for (std::size_t i = 0; i < m_spatialRequests.size(); ++i)
+    {
+        const SpatialRequest &request = m_spatialRequests[i];
+
+        SfxInstance instance;
+        instance.buffer = request.buffer;
+        instance.params = request.params;
+        instance.bus = request.bus;
+        instance.gain = request.gain;
+        instance.pitch = request.pitch;
+        instance.isPositional = true;
+
+        StartInstance(instance, request.position, m_requestEmitters.GetGain(i), m_requestEmitters.GetPan(i),
+                      m_requestEmitters.IsAudible(i));
+    }
+
+    m_spatialRequests.clear();
+}
+
+/// @brief Starts tracking a sound effect. An audible one takes a voice the usual way, stealing if the pool says so;
+/// one that cannot be heard, or that every voice outranks, starts virtual and keeps time until it can be heard.
+/// @param instance sound to start; its id, start time and length are filled in here.
+/// @param position emitter position, for a positional instance.
+/// @param distanceGain gain from distance, 0 to 1.
+/// @param pan -1 left to 1 right.
+/// @param isInRange false if the emitter is off screen or beyond its attenuation range.
+/// @return id of the instance, or 0 if it was dropped.
+std::uint32_t AudioManager::StartInstance(SfxInstance instance, const sf::Vector2f &position, float distanceGain,
+                                          float pan, bool isInRange)
+{
+    if (m_mixer && !m_mixer->CanMix(*instance.buffer))
+    {
+        CT_LOG_WARN("AudioManager: the software mixer cannot play a {} channel sound at {} Hz, dropped it.",
+                    instance.buffer->getChannelCount(), instance.buffer->getSampleRate());
+
+        return 0;
+    }
+
+    // The mixer ignores pitch, so the instance must keep time at normal speed too.
+    if (m_mixer)
+    {
+        instance.pitch = 1.f;
+    }
+
+    instance.startMs = GetClockMs(m_sfxClock);
+    instance.lengthMs = instance.buffer->getDuration().asSeconds() * 1000.0 / std::max(instance.pitch, MIN_PITCH);
+
+    const bool isAudible = isInRange && IsAudible(instance, distanceGain);
+
+    if (!isAudible && instance.isPositional)
+    {
+        ++m_culledSfxCount;
+    }
+
+    if ((!isAudible || !AcquireVoice(instance, distanceGain, pan, true)) && CountVirtualSfx() >= MAX_VIRTUAL_SFX)
+    {
+        CT_LOG_DEBUG("AudioManager: {} virtual sound effects already, dropped one that has no voice.", MAX_VIRTUAL_SFX);
+
+        return 0;
+    }
+
+    instance.id = m_nextInstanceId++;
+
+    if (m_nextInstanceId == 0)
+    {
+        ++m_nextInstanceId;
+    }
+
+    m_sfxInstances.push_back(instance);
+    m_instanceEmitters.Add(position, instance.params.attenuation);
+
+    return instance.id;
+}
+
+/// @brief Advances every sound effect instance against the current listener and buses in one pass. Instances whose
+/// voice ended are forgotten, voices that can no longer be heard are released and go virtual, and virtual instances
+/// that can be heard again resume on a free voice at the point they would have reached.
+void AudioManager::UpdateSfxInstances()
+{
+    const double nowMs = GetClockMs(m_sfxClock);
+
+    for (std::size_t i = m_sfxInstances.size(); i-- > 0;)
+    {
+        const SfxInstance &instance = m_sfxInstances[i];
+
+        if (instance.IsVirtual() ? nowMs - instance.startMs >= instance.lengthMs : !IsVoiceLive(instance))
+        {
+            RemoveInstance(i);
+        }
+    }
+
+    if (m_sfxInstances.empty())
+    {
+        m_virtualSfxCount = 0;
+
+        return;
+    }
+
+    m_instanceEmitters.Compute(m_listener);
+
+    // Backwards, so the instance swapped into a removed slot has already been visited.
+    for (std::size_t i = m_sfxInstances.size(); i-- > 0;)
+    {
+        SfxInstance &instance = m_sfxInstances[i];
+        const float distanceGain = instance.isPositional ? m_instanceEmitters.GetGain(i) : 1.f;
+        const float pan = instance.isPositional ? m_instanceEmitters.GetPan(i) : 0.f;
+        const bool isInRange = !instance.isPositional || m_instanceEmitters.IsAudible(i);
+
+        if (!isInRange || !IsAudible(instance, distanceGain))
+        {
+            if (!instance.IsVirtual())
+            {
+                m_culledSfxCount += instance.isPositional ? 1 : 0;
+                ReleaseVoice(instance);
+            }
+
+            continue;
+        }
+
+        if (instance.IsVirtual())
+        {
+            AcquireVoice(instance, distanceGain, pan, false);
+        }
+        else
+        {
+            ApplyVoiceGain(instance, distanceGain, pan);
+        }
+    }
+
+    m_virtualSfxCount = CountVirtualSfx();
+}
+
+/// @brief Counts the instances that hold no voice. Audio thread only; the game thread reads m_virtualSfxCount.
+/// @return virtual instance count.
+std::size_t AudioManager::CountVirtualSfx() const
+{
+    return static_cast<std::size_t>(std::count_if(m_sfxInstances.begin(), m_sfxInstances.end(),
+                                                  [](const SfxInstance &instance) { return instance.IsVirtual(); }));
+}
+
+/// @brief Returns whether an instance is loud enough to be worth a voice, counting its bus, its own gain and its
+/// distance gain. Muted buses and finished fades fall below it.
+/// @param instance instance to check.
+/// @param distanceGain gain from distance, 0 to 1.
+/// @return true / false
+bool AudioManager::IsAudible(const SfxInstance &instance, float distanceGain) const
+{
+    return m_buses.GetEffectiveGain(instance.bus) * instance.gain * distanceGain >= INAUDIBLE_GAIN;
+}
+
+/// @brief Gives an instance a voice, starting it where it would be now had it played all along.
+/// @param instance instance to back; must be virtual.
+/// @param distanceGain gain from distance, 0 to 1.
+/// @param pan -1 left to 1 right.
+/// @param canSteal true for a new sound, which may take a voice from a lesser one; false to wait for a free voice.
+/// @return false if no voice was available.
+bool AudioManager::AcquireVoice(SfxInstance &instance, float distanceGain, float pan, bool canSteal)
+{
+    const double elapsedMs = std::max(0.0, GetClockMs(m_sfxClock) - instance.startMs);
+    const double offsetMs = elapsedMs * instance.pitch;
+    const float gain = instance.gain * distanceGain;
+
+    if (m_mixer)
+    {
+        const auto frame = static_cast<std::size_t>(offsetMs * instance.buffer->getSampleRate() / 1000.0);
+        instance.voice = m_mixer->Play(*instance.buffer, instance.bus, gain, pan, frame);
+
+        return instance.voice != SoftwareMixer::INVALID_VOICE;
+    }
+
+    const float volume = std::min(100.f, m_buses.GetEffectiveGain(instance.bus) * 100.f * gain);
+    const SfxVoicePool::VoiceId poolVoice = canSteal
+                                                ? m_sfxVoices.Play(*instance.buffer, instance.params, volume)
+                                                : m_sfxVoices.PlayFree(*instance.buffer, instance.params, volume);
+
+    if (poolVoice == SfxVoicePool::INVALID_VOICE)
+    {
+        return false;
+    }
+
+    // Whoever held this voice lost it: it goes virtual, and comes back once a voice frees up.
+    for (SfxInstance &other : m_sfxInstances)
+    {
+        if (other.poolVoice == poolVoice)
+        {
+            other.poolVoice = SfxVoicePool::INVALID_VOICE;
+        }
+    }
+
+    sf::Sound &sound = *m_sfxVoices.GetVoice(poolVoice);
+    sound.setPitch(instance.pitch);
+
+    if (instance.isPositional)
+    {
+        PanSound(sound, pan);
+    }
+
+    if (offsetMs > 0.0)
+    {
+        sound.setPlayingOffset(sf::microseconds(static_cast<sf::Int64>(offsetMs * 1000.0)));
+    }
+
+    instance.poolVoice = poolVoice;
+
+    return true;
+}
+
+/// @brief Stops the voice of an instance, leaving it virtual. It cannot be heard, so cutting it off does not pop.
+/// @param instance instance to release.
+void AudioManager::ReleaseVoice(SfxInstance &instance)
+{
+    if (IsVoiceLive(instance))
+    {
+        if (sf::Sound *sound = m_sfxVoices.GetVoice(instance.poolVoice))
+        {
+            sound->stop();
+        }
+        else
+        {
+            m_mixer->Stop(instance.voice);
+        }
+    }
+
+    instance.poolVoice = SfxVoicePool::INVALID_VOICE;
+    instance.voice = SoftwareMixer::INVALID_VOICE;
+}
+
+/// @brief Returns whether an instance's voice is still playing its sound.
+/// @param instance instance to check.
+/// @return true / false
+bool AudioManager::IsVoiceLive(const SfxInstance &instance) const
+{
+    if (instance.poolVoice != SfxVoicePool::INVALID_VOICE)
+    {
+        // A voice the pool shrank away is gone; the instance ends as if its sound had finished.
+        const sf::Sound *sound = m_sfxVoices.GetVoice(instance.poolVoice);
+
+        return sound && sound->getBuffer() == instance.buffer && sound->getStatus() != sf::Sound::Stopped;
+    }
+
+    return m_mixer && m_mixer->IsVoicePlaying(instance.voice);
+}
+
+/// @brief Pushes a freshly computed gain and pan to an instance's voice.
+/// @param instance instance to update; must hold a voice.
+/// @param distanceGain gain from distance, 0 to 1; scales the instance's own gain.
+/// @param pan -1 left to 1 right.
+void AudioManager::ApplyVoiceGain(const SfxInstance &instance, float distanceGain, float pan)
+{
+    if (sf::Sound *sound = m_sfxVoices.GetVoice(instance.poolVoice))
+    {
+        sound->setVolume(
+            std::min(100.f, m_buses.GetEffectiveGain(instance.bus) * 100.f * instance.gain * distanceGain));
+
+        if (instance.isPositional)
+        {
+            PanSound(*sound, pan);
+        }
+    }
+    else if (m_mixer)
+    {
+        m_mixer->SetVoiceGain(instance.voice, instance.gain * distanceGain);
+        m_mixer->SetVoicePan(instance.voice, pan);
+    }
+}
+
+/// @brief Stops an instance's voice, if it has one, and forgets the instance.
+/// @param index instance to remove; the last instance takes its index.
+void AudioManager::RemoveInstance(std::size_t index)
+{
+    ReleaseVoice(m_sfxInstances[index]);
+
+    m_sfxInstances[index] = m_sfxInstances.back();
+    m_sfxInstances.pop_back();
+    m_instanceEmitters.Remove(index);
+}
+
+/// @brief Looks up a tracked instance.
+/// @param id id returned by StartInstance.
+/// @return the instance, or nullptr once it ended.
+AudioManager::SfxInstance *AudioManager::FindInstance(std::uint32_t id)
+{
+    if (id == 0)
+    {
+        return nullptr;
+    }
+
+    auto it = std::find_if(m_sfxInstances.begin(), m_sfxInstances.end(),
+                           [id](const SfxInstance &instance) { return instance.id == id; });
+
+    return it == m_sfxInstances.end() ? nullptr : &*it;
+}
+
+/// @brief Returns the deck playing the current track.
+/// @return active deck.
+MusicDeck &AudioManager::ActiveDeck()
+{
+    return *m_decks[m_activeDeck];
+}
+
+/// @brief Returns the deck that is free, prepared, or fading out during a crossfade. Not to be touched while
+/// m_isLoadingIdleDeck is set: music commands wait for the loader before they run, and the rest skip this deck.
+/// @return idle deck.
+MusicDeck &AudioManager::IdleDeck()
+{
+    return *m_decks[1 - m_activeDeck];
+}
+
+/// @brief Blocks until the music loader has finished any prepare. For the thread that owns the audio state while it
+/// has nothing better to do; the audio thread defers music commands instead of calling it mid tick.
+void AudioManager::WaitForMusicLoader()
+{
+    if (m_musicLoader && m_isLoadingIdleDeck)
+    {
+        m_musicLoader->WaitIdle();
+    }
+}
+
+/// @brief Makes sure a deck holds filename, opening it unless it was prepared, and applies loop settings.
+/// @param deck deck to load.
+/// @param filename Music file to play.
+/// @param loop whether or not to loop the file.
+/// @return true / false
+bool AudioManager::LoadOnDeck(MusicDeck &deck, const std::string &filename, bool loop)
+{
+    if (deck.GetTrack() != filename && !deck.Open(filename))
+    {
+        return false;
+    }
+
+    deck.SetLoop(loop);
+
+    if (auto it = m_loopPoints.find(filename); it != m_loopPoints.end() && !deck.SetLoopPoints(it->second))
+    {
+        CT_LOG_WARN("AudioManager: loop points of '{}' are outside the track, looping the whole track.", filename);
+    }
+
+    deck.ApplyVolume(m_deckVolume);
+
+    return true;
+}
+
+/// @brief Returns the music bus volume: music times master, or silence when muted.
+/// @return volume 0 to 100.
+float AudioManager::GetEffectiveMusicVolume() const
+{
+    return m_buses.GetEffectiveGain(AudioBusId::Music) * 100.f;
+}
+
+/// @brief Copies volume settings onto the buses and pushes the result to the music decks. Sound effects pick the new
+/// gains up as they start, or on the next mixed chunk when mixing in software.
+/// @param masterVolume master volume, 0 to 100.
+/// @param musicVolume music volume, 0 to 100.
+/// @param sfxVolume sound effect volume, 0 to 100.
+/// @param isMuted whether the master bus is muted.
+void AudioManager::ApplyBusGains(float masterVolume, float musicVolume, float sfxVolume, bool isMuted)
+{
+    m_buses.SetGain(AudioBusId::Master, masterVolume / 100.f);
+    m_buses.SetGain(AudioBusId::Music, musicVolume / 100.f);
+    m_buses.SetGain(AudioBusId::Sfx, sfxVolume / 100.f);
+    m_buses.SetMuted(AudioBusId::Master, isMuted);
+
+    ApplyMusicVolume();
+}
+
+/// @brief Pushes the music bus volume to both decks; each keeps its own crossfade gain.
+void AudioManager::ApplyMusicVolume()
+{
+    m_deckVolume = GetEffectiveMusicVolume();
+
+    if (!m_decks[0] || !m_decks[1])
+    {
+        return;
+    }
+
+    ActiveDeck().ApplyVolume(m_deckVolume);
+
+    // A deck still being prepared is silent; LoadOnDeck sets its volume once it is played.
+    if (!m_isLoadingIdleDeck)
+    {
+        IdleDeck().ApplyVolume(m_deckVolume);
+    }
 }
@@ -12,10 +12,65 @@
 
 #pragma once
 
+#include "AssetId.h"
+#include "AudioBus.h"
+#include "AudioEventBank.h"
+#include "MusicDeck.h"
 #include "Settings.h"
+#include "SfxCoalescer.h"
+#include "SfxVoicePool.h"
+#include "SoftwareMixer.h"
+#include "SpatialAudio.h"
+#include "SpscQueue.h"
+#include "ThreadPool.h"
 #include <SFML/Audio.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/// @brief Game thread access to state the audio thread owns. While one is alive the audio thread waits before it runs
+/// the next command or sound effect flush, so the state can be read and changed without racing it. Keep it to a
+/// statement or a short scope, and do not call SyncAudioThread while holding it: the commands it would wait for are the
+/// ones being held back.
+template <typename T> class AudioStateAccess
+{
+  public:
+    AudioStateAccess(std::unique_lock<std::mutex> lock, T *state) : m_lock(std::move(lock)), m_state(state)
+    {
+    }
+
+    T *operator->() const
+    {
+        return m_state;
+    }
+
+    T &operator*() const
+    {
+        return *m_state;
+    }
+
+    T *Get() const
+    {
+        return m_state;
+    }
+
+    explicit operator bool() const
+    {
+        return m_state != nullptr;
+    }
+
+  private:
+    std::unique_lock<std::mutex> m_lock;
+    T *m_state = nullptr;
+};
 
 // ============================================================================
 //  Class       : AudioManager
@@ -23,7 +78,20 @@
 //
 //  Responsibilities:
 //      - Initializes and shuts down
+//      - Runs requests on a dedicated audio thread, fed by a lock free queue
 //      - Returns Music, volumes, and mute states.
+//      - Crossfades between two music decks, opening the next track early
+//        on a background thread
+//      - Plays sound effects through a prioritized voice pool
+//      - Merges identical sound effects requested in the same frame
+//      - Pans, attenuates and culls positional sound effects in one batch
+//      - Keeps inaudible sound effects as virtual voices that hold no
+//        source, resuming them in place once they can be heard
+//      - Plays named audio events defined in a data file
+//      - Routes volumes through master, music, sfx and ui buses, optionally
+//        mixing sound effects in software on a single output stream
+//      - Renders its mix offline, to memory or a WAV file, on a virtual
+//        clock instead of the audio device
 //
 // ============================================================================
 class AudioManager
@@ -38,15 +106,61 @@ class AudioManager
     bool IsInitialized() const;
     void Update(float dt);
 
-    void PlayMusic(const std::string &filename, bool loop = true, bool fadeIn = false, float fadeDuration = 1.0f);
-    void StopMusic(bool fadeOut = false, float fadeDuration = 2.0f);
+    void StartAudioThread();
+    void StopAudioThread();
+    bool IsAudioThreadRunning() const;
+    void SyncAudioThread();
+
+    void PlayMusic(const std::string &filename, bool loop = true, bool fadeIn = false, float fadeDuration = 1.0f,
+                   EnvelopeCurve curve = EnvelopeCurve::Linear);
+    void StopMusic(bool fadeOut = false, float fadeDuration = 2.0f, EnvelopeCurve curve = EnvelopeCurve::Linear);
     void PauseMusic();
     void ResumeMusic();
     bool IsMusicPlaying() const;
     bool IsFadingOut() const;
     bool IsFadingIn() const;
+    bool IsCrossfading() const;
+
+    bool PrepareMusic(const std::string &filename);
+    bool IsPreparingMusic() const;
+    void WaitForPreparedMusic();
+    void SetMusicLoopPoints(const std::string &filename, const MusicLoopPoints &points);
 
     void PlaySFX(const std::string &filename);
+    void PlaySFX(AssetId id);
+    void PlaySFX(const std::string &filename, const sf::Vector2f &position);
+    void PlaySFX(AssetId id, const sf::Vector2f &position);
+    void FlushSFX();
+
+    bool LoadEvents(const std::string &filepath);
+    AudioEventHandle GetEventHandle(AssetId id) const;
+    const std::string &GetEventTrack(AssetId id) const;
+    void PlayEvent(AudioEventHandle handle);
+    void PlayEvent(AudioEventHandle handle, const sf::Vector2f &position);
+    AudioEventBank &GetEvents();
+
+    void SetListener(const sf::Vector2f &position, const sf::Vector2f &audibleSize);
+    std::size_t GetCulledSFXCount() const;
+    std::size_t GetVirtualSFXCount() const;
+    std::size_t GetDroppedSFXCount() const;
+    void StopAllSFX();
+
+    void SetSoftwareMixing(bool isEnabled);
+    bool IsSoftwareMixing() const;
+    AudioStateAccess<SoftwareMixer> GetSoftwareMixer();
+    AudioStateAccess<AudioBuses> GetBuses();
+
+    bool StartOfflineRender(unsigned int sampleRate = 44100);
+    void StopOfflineRender();
+    bool IsOfflineRendering() const;
+    void Render(sf::Int16 *output, std::size_t frames);
+    bool RenderToFile(const std::string &filepath, float seconds);
+    std::uint64_t GetRenderedFrames() const;
+
+    void SetSFXParams(AssetId id, const SfxParams &params);
+    SfxParams GetSFXParams(AssetId id) const;
+    AudioStateAccess<SfxVoicePool> GetSFXVoicePool();
+    AudioStateAccess<SfxCoalescer> GetSFXCoalescer();
 
     void SetMasterVolume(float volume);
     float GetMasterVolume() const;
@@ -61,7 +175,7 @@ class AudioManager
     void Unmute();
     bool IsMuted() const;
 
-    void SwitchTrack(const std::string &filename, bool loop = true);
+    void SwitchTrack(const std::string &filename, bool loop = true, float crossfadeDuration = 2.0f);
     const std::string &GetCurrentMusicName() const;
 
   private:
@@ -71,27 +185,247 @@ class AudioManager
     AudioManager(const AudioManager &) = delete;
     AudioManager &operator=(const AudioManager &) = delete;
 
+    /// @brief What the game thread asks the audio thread to do.
+    enum class CommandType : std::uint8_t
+    {
+        PlayMusic,
+        StopMusic,
+        PauseMusic,
+        ResumeMusic,
+        SwitchTrack,
+        PrepareMusic,
+        SetLoopPoints,
+        PlaySFX,
+        PlayEvent,
+        SetSFXParams,
+        StopAllSFX,
+        SetBusGains,
+        SetSoftwareMixing,
+        SetListener
+    };
+
+    /// @brief One request for the audio thread. Only the fields its type uses are set.
+    struct Command
+    {
+        CommandType type = CommandType::PlayMusic;
+        std::string filename;
+        AssetId id;
+        const sf::SoundBuffer *buffer = nullptr;
+        bool isPositional = false;
+        sf::Vector2f position;
+        sf::Vector2f size;
+        float gain = 1.f;
+        float pitch = 1.f;
+        AudioBusId bus = AudioBusId::Sfx;
+        bool loop = true;
+        bool fade = false;
+        bool isEnabled = false;
+        float duration = 0.f;
+        EnvelopeCurve curve = EnvelopeCurve::Linear;
+        float masterVolume = 0.f;
+        float musicVolume = 0.f;
+        float sfxVolume = 0.f;
+        bool isMuted = false;
+        SfxParams sfxParams;
+        MusicLoopPoints loopPoints;
+
+        /// @brief Set on requests that change the music status, so the game thread knows when they have run.
+        bool isMusicRequest = false;
+    };
+
+    /// @brief Music state published by whichever thread runs the commands, read by the game thread.
+    struct MusicStatus
+    {
+        std::atomic<bool> isMusicPlaying = false;
+        std::atomic<bool> isFadingIn = false;
+        std::atomic<bool> isFadingOut = false;
+        std::atomic<bool> isCrossfading = false;
+    };
+
+    /// @brief Music state the game thread last asked for, answered while that request has not run yet.
+    struct RequestedMusic
+    {
+        bool isMusicPlaying = false;
+        bool isFadingIn = false;
+        bool isFadingOut = false;
+        bool isCrossfading = false;
+    };
+
+    /// @brief Requests that may be waiting for the audio thread at once.
+    static constexpr std::size_t COMMAND_QUEUE_CAPACITY = 256;
+
+    void Submit(Command &&command);
+    void Overflow(Command &&command);
+    bool PushOverflow();
+    void SubmitBusGains();
+    void RequestMusic(Command &command, const RequestedMusic &requested);
+    bool IsMusicRequestPending() const;
+
+    void AudioThreadLoop();
+    static bool IsMusicCommand(CommandType type);
+    void RunDeferredMusic();
+    void RunCommand(Command &command);
+    void ExecuteCommand(Command &command);
+    void ExecutePlayMusic(const std::string &filename, bool loop, bool fadeIn, float fadeDuration, EnvelopeCurve curve);
+    void ExecuteStopMusic(bool fadeOut, float fadeDuration, EnvelopeCurve curve);
+    void ExecutePauseMusic();
+    void ExecuteResumeMusic();
+    void ExecuteSwitchTrack(const std::string &filename, bool loop, float crossfadeDuration);
+    void ExecutePrepareMusic(const std::string &filename);
+    void ExecuteSetLoopPoints(const std::string &filename, const MusicLoopPoints &points);
+    void ExecuteStopAllSFX();
+    void ExecuteSetSoftwareMixing(bool isEnabled);
+
+    void UpdateFades();
+    void FlushPendingSFX();
+    void PublishStatus();
+    double GetClockMs(const sf::Clock &clock) const;
+
+    /// @brief A positional sound effect waiting for the next flush.
+    struct SpatialRequest
+    {
+        const sf::SoundBuffer *buffer = nullptr;
+        sf::Vector2f position;
+        SfxParams params;
+        AudioBusId bus = AudioBusId::Sfx;
+        float gain = 1.f;
+        float pitch = 1.f;
+    };
+
+    /// @brief One playing sound effect. It holds a pool voice or a mixer voice while it can be heard, and is virtual
+    /// otherwise: no voice, only the time it started, so it can resume in place. Shares its index with its emitter in
+    /// m_instanceEmitters; the emitter of a non positional instance is unused.
+    struct SfxInstance
+    {
+        std::uint32_t id = 0;
+        const sf::SoundBuffer *buffer = nullptr;
+        SfxVoicePool::VoiceId poolVoice = SfxVoicePool::INVALID_VOICE;
+        SoftwareMixer::VoiceId voice = SoftwareMixer::INVALID_VOICE;
+        SfxParams params;
+        AudioBusId bus = AudioBusId::Sfx;
+        float gain = 1.f;
+        float pitch = 1.f;
+        bool isPositional = false;
+
+        /// @brief Sound effect clock time the sound started at, and how long it plays at its pitch.
+        double startMs = 0.0;
+        double lengthMs = 0.0;
+
+        bool IsVirtual() const
+        {
+            return poolVoice == SfxVoicePool::INVALID_VOICE && voice == SoftwareMixer::INVALID_VOICE;
+        }
+    };
+
+    SfxParams FindSfxParams(AssetId id) const;
+    void StartRequest(const SfxRequest &request);
+    void SubmitEvent(AudioEventHandle handle, bool isPositional, const sf::Vector2f &position);
+    void ExecutePlayEvent(const Command &command);
+
+    void StartSpatialRequests();
+    std::uint32_t StartInstance(SfxInstance instance, const sf::Vector2f &position, float distanceGain, float pan,
+                                bool isInRange);
+    void UpdateSfxInstances();
+    std::size_t CountVirtualSfx() const;
+    bool IsAudible(const SfxInstance &instance, float distanceGain) const;
+    bool AcquireVoice(SfxInstance &instance, float distanceGain, float pan, bool canSteal);
+    void ReleaseVoice(SfxInstance &instance);
+    bool IsVoiceLive(const SfxInstance &instance) const;
+    void ApplyVoiceGain(const SfxInstance &instance, float distanceGain, float pan);
+    void RemoveInstance(std::size_t index);
+    SfxInstance *FindInstance(std::uint32_t id);
+
+    MusicDeck &ActiveDeck();
+    MusicDeck &IdleDeck();
+    void WaitForMusicLoader();
+    bool LoadOnDeck(MusicDeck &deck, const std::string &filename, bool loop);
+    float GetEffectiveMusicVolume() const;
+    void ApplyBusGains(float masterVolume, float musicVolume, float sfxVolume, bool isMuted);
+    void ApplyMusicVolume();
+
   private:
-    std::unique_ptr<sf::Music> m_music;
+    // Game thread: what was last requested, answered without waiting for the audio thread.
     std::shared_ptr<Settings> m_settings;
     std::string m_currentTrack;
-
     float m_masterVolume;
     float m_musicVolume;
     float m_sfxVolume;
+    bool m_isMuted = false;
+    bool m_isSoftwareMixing = false;
+    std::unordered_map<AssetId, SfxParams> m_requestedSfxParams;
+    AudioEventBank m_events;
+    sf::Clock m_eventClock;
 
-    std::vector<sf::Sound> m_activeSounds;
-    size_t m_nextSoundIndex = 0;
+    // Hand off between the threads.
+    SpscQueue<Command, COMMAND_QUEUE_CAPACITY> m_commands;
+    std::thread m_audioThread;
+    std::atomic<bool> m_isThreadRunning = false;
+    std::uint64_t m_submittedCount = 0;
+    std::deque<Command> m_overflowCommands;
+    std::size_t m_droppedSfxCount = 0;
+    std::atomic<std::uint64_t> m_executedCount = 0;
+    MusicStatus m_status;
+    RequestedMusic m_requestedMusic;
+    std::uint64_t m_musicRequestCount = 0;
+    std::atomic<std::uint64_t> m_executedMusicRequestCount = 0;
 
-    bool m_isMuted = false;
+    /// @brief Held by an AudioStateAccess for as long as it lives, and by the audio thread for each command that is
+    /// not about music and for each sound effect flush; music work and fades run outside it.
+    std::mutex m_tickMutex;
 
-    bool m_isFadingOut = false;
-    float m_fadeOutTimer = 0.0f;
-    float m_fadeOutDuration = 0.0f;
+    // Audio thread, or the game thread while no audio thread runs.
+    std::array<std::unique_ptr<MusicDeck>, 2> m_decks;
+    std::size_t m_activeDeck = 0;
+    std::unordered_map<std::string, MusicLoopPoints> m_loopPoints;
+
+    /// @brief Music bus volume last pushed to the decks, so music commands need not read m_buses.
+    float m_deckVolume = 0.f;
+
+    /// @brief Opens prepared tracks; the idle deck belongs to it while m_isLoadingIdleDeck is set. m_isPreparingMusic
+    /// is what the game thread asked for, set before the prepare even reaches the audio thread.
+    std::unique_ptr<ThreadPool> m_musicLoader;
+    std::atomic<bool> m_isLoadingIdleDeck = false;
+    std::atomic<bool> m_isPreparingMusic = false;
+
+    /// @brief Music commands held back while the loader owns the idle deck, in the order they were submitted.
+    std::deque<Command> m_deferredMusic;
+    std::string m_playingTrack;
+
+    AudioBuses m_buses;
+    std::unique_ptr<SoftwareMixer> m_mixer;
 
+    /// @brief Instance a sound last started as, and how many requests it stands for.
+    struct LiveSfx
+    {
+        std::uint32_t instance = 0;
+        std::size_t count = 0;
+    };
+
+    SfxVoicePool m_sfxVoices;
+    SfxCoalescer m_sfxRequests;
+    std::unordered_map<AssetId, SfxParams> m_sfxParams;
+    std::unordered_map<AssetId, LiveSfx> m_liveSfx;
+    sf::Clock m_sfxClock;
+
+    SpatialListener m_listener;
+    std::vector<SpatialRequest> m_spatialRequests;
+    SpatialBatch m_requestEmitters;
+    std::vector<SfxInstance> m_sfxInstances;
+    SpatialBatch m_instanceEmitters;
+    std::uint32_t m_nextInstanceId = 1;
+    std::atomic<std::size_t> m_culledSfxCount = 0;
+    std::atomic<std::size_t> m_virtualSfxCount = 0;
+
+    // Offline rendering: the calling thread owns the audio state, and time is the frames rendered so far.
+    bool m_isOfflineRendering = false;
+    unsigned int m_renderSampleRate = 0;
+    std::uint64_t m_renderedFrames = 0;
+    std::vector<float> m_renderMix;
+
+    // The fades themselves run on the decks; these only mark which one is in progress.
+    bool m_isFadingOut = false;
     bool m_isFadingIn = false;
-    float m_fadeInTimer = 0.0f;
-    float m_fadeInDuration = 0.0f;
+    bool m_isCrossfading = false;
 
     bool m_isInitialized = false;
 };
@@ -137,6 +137,9 @@ void Background::Draw(sf::RenderWindow &window)
     const float scaleX = static_cast<float>(winSize.x) / static_cast<float>(scaleMgr.ReferenceResolutionX());
     const float scaleY = static_cast<float>(winSize.y) / static_cast<float>(scaleMgr.ReferenceResolutionY());
 
+    const TextureStreamer &streamer = AssetManager::Instance().GetTextureStreamer();
+    sf::Sprite proxy;
+
     for (auto &layer : m_layers)
     {
         const sf::Texture *texture = layer.sprite.getTexture();
@@ -164,7 +167,15 @@ void Background::Draw(sf::RenderWindow &window)
             {
                 layer.sprite.setPosition(xPos, yPos);
                 layer.sprite.setScale(scaleX, scaleY);
-                window.draw(layer.sprite);
+
+                if (streamer.MakeProxySprite(layer.sprite, proxy))
+                {
+                    window.draw(proxy);
+                }
+                else
+                {
+                    window.draw(layer.sprite);
+                }
             }
         }
     }
@@ -0,0 +1,220 @@
+// ============================================================================
+//  File        : CookedEntryCache.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-24
+//  Description : Shared plumbing of the on disk caches of decoded assets:
+//                entry naming, source stamping, validation and atomic
+//                writes, for any fixed size entry header.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "CookedEntryCache.h"
+#include "Hash.h"
+#include "Macros.h"
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+
+namespace
+{
+/// @brief Reads the size and last write time that an entry must match to still be valid.
+/// @param sourcePath source file.
+/// @param size receives the file size.
+/// @param stamp receives the last write time, in file clock ticks.
+/// @return false if the source cannot be inspected.
+bool ReadSourceStamp(const std::string &sourcePath, std::uint64_t &size, std::int64_t &stamp)
+{
+    std::error_code ec;
+    const auto fileSize = std::filesystem::file_size(sourcePath, ec);
+
+    if (ec)
+    {
+        return false;
+    }
+
+    const auto writeTime = std::filesystem::last_write_time(sourcePath, ec);
+
+    if (ec)
+    {
+        return false;
+    }
+
+    size = static_cast<std::uint64_t>(fileSize);
+    stamp = static_cast<std::int64_t>(writeTime.time_since_epoch().count());
+
+    return true;
+}
+} // namespace
+
+/// @brief Constructor for the CookedEntryCache.
+/// @param name cache name, used in log lines.
+/// @param directory default cache directory.
+/// @param extension extension of entry files, with its dot.
+CookedEntryCache::CookedEntryCache(std::string name, std::string directory, std::string extension)
+    : m_name(std::move(name)), m_directory(std::move(directory)), m_extension(std::move(extension))
+{
+}
+
+/// @brief Sets where entries are read and written. Not synchronized; set it before any load.
+/// @param directory cache directory, created on the first store.
+void CookedEntryCache::SetDirectory(const std::string &directory)
+{
+    m_directory = directory;
+}
+
+/// @brief Returns where entries are read and written.
+/// @return m_directory.
+const std::string &CookedEntryCache::GetDirectory() const
+{
+    return m_directory;
+}
+
+/// @brief Turns the cache on or off. Not synchronized; set it before any load.
+/// @param isEnabled false makes loads miss and stores do nothing.
+void CookedEntryCache::SetEnabled(bool isEnabled)
+{
+    m_isEnabled = isEnabled;
+}
+
+/// @brief Returns whether the cache is in use.
+/// @return m_isEnabled.
+bool CookedEntryCache::IsEnabled() const
+{
+    return m_isEnabled;
+}
+
+/// @brief Returns where the entry for a source file lives: one file per source path, named by its hash.
+/// @param sourcePath source file.
+/// @return entry path inside the cache directory.
+std::string CookedEntryCache::EntryPath(const std::string &sourcePath) const
+{
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << Fnv1a64(std::string_view(sourcePath)) << m_extension;
+
+    return (std::filesystem::path(m_directory) / name.str()).generic_string();
+}
+
+/// @brief Maps the entry for a source file if it was written from the file as it is now. Safe to call from any thread.
+/// @param sourcePath source file.
+/// @param expected magic and version the entry must carry.
+/// @param headerSize size of the full entry header.
+/// @param file receives the mapped entry.
+/// @return false when disabled, missing, stale, of another kind or version, or shorter than a header.
+bool CookedEntryCache::OpenEntry(const std::string &sourcePath, const CookedEntryPrefix &expected,
+                                 std::size_t headerSize, MappedFile &file) const
+{
+    std::uint64_t sourceSize = 0;
+    std::int64_t sourceStamp = 0;
+
+    if (!m_isEnabled || !ReadSourceStamp(sourcePath, sourceSize, sourceStamp))
+    {
+        return false;
+    }
+
+    if (!file.Open(EntryPath(sourcePath)) || file.Size() < headerSize)
+    {
+        return false;
+    }
+
+    CookedEntryPrefix prefix;
+    std::memcpy(&prefix, file.Data(), sizeof(prefix));
+
+    if (prefix.magic != expected.magic || prefix.version != expected.version)
+    {
+        return false;
+    }
+
+    if (prefix.sourceSize != sourceSize || prefix.sourceStamp != sourceStamp)
+    {
+        CT_LOG_DEBUG("{}: '{}' changed since it was cached.", m_name, sourcePath);
+
+        return false;
+    }
+
+    return true;
+}
+
+/// @brief Fills in the source size and mtime an entry is valid for.
+/// @param sourcePath source file.
+/// @param sourceSize size of the source bytes that were decoded.
+/// @param prefix receives the stamp.
+/// @return false when disabled, or if the source is gone or changed since its bytes were read.
+bool CookedEntryCache::StampEntry(const std::string &sourcePath, std::size_t sourceSize,
+                                  CookedEntryPrefix &prefix) const
+{
+    std::uint64_t stampSize = 0;
+    std::int64_t sourceStamp = 0;
+
+    if (!m_isEnabled || !ReadSourceStamp(sourcePath, stampSize, sourceStamp))
+    {
+        return false;
+    }
+
+    // The bytes were read before the stamp; if the file changed in between, caching them would pin stale data.
+    if (stampSize != sourceSize)
+    {
+        return false;
+    }
+
+    prefix.sourceSize = stampSize;
+    prefix.sourceStamp = sourceStamp;
+
+    return true;
+}
+
+/// @brief Writes an entry, replacing any older one. The entry is written to a temporary file and renamed into place,
+/// so a concurrent load never sees it half written. Safe to call from any thread for different sources.
+/// @param sourcePath source file.
+/// @param header stamped entry header.
+/// @param headerSize size of header.
+/// @param payload bytes that follow the header.
+/// @param payloadBytes size of payload.
+/// @return true / false
+bool CookedEntryCache::WriteEntry(const std::string &sourcePath, const void *header, std::size_t headerSize,
+                                  const void *payload, std::size_t payloadBytes) const
+{
+    std::error_code ec;
+    std::filesystem::create_directories(m_directory, ec);
+
+    const std::string entryPath = EntryPath(sourcePath);
+    const std::string tempPath = entryPath + ".tmp";
+
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+
+        if (!out.is_open())
+        {
+            CT_LOG_WARN("{}: could not write '{}'.", m_name, tempPath);
+
+            return false;
+        }
+
+        out.write(static_cast<const char *>(header), static_cast<std::streamsize>(headerSize));
+        out.write(static_cast<const char *>(payload), static_cast<std::streamsize>(payloadBytes));
+
+        if (!out)
+        {
+            out.close();
+            std::filesystem::remove(tempPath, ec);
+
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempPath, entryPath, ec);
+
+    if (ec)
+    {
+        CT_LOG_WARN("{}: could not replace '{}': {}", m_name, entryPath, ec.message());
+        std::filesystem::remove(tempPath, ec);
+
+        return false;
+    }
+
+    return true;
+}
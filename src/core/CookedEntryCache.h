@@ -0,0 +1,111 @@
+// ============================================================================
+//  File        : CookedEntryCache.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-24
+//  Description : Shared plumbing of the on disk caches of decoded assets:
+//                entry naming, source stamping, validation and atomic
+//                writes, for any fixed size entry header.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include "MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+/// @brief Leading fields of every entry header: what the entry is, and the source file it was cooked from.
+struct CookedEntryPrefix
+{
+    std::uint32_t magic = 0;
+    std::uint32_t version = 0;
+    std::uint64_t sourceSize = 0;
+    std::int64_t sourceStamp = 0;
+    std::uint64_t contentHash = 0;
+};
+
+static_assert(sizeof(CookedEntryPrefix) == 32, "CookedEntryPrefix must not contain padding.");
+
+// ============================================================================
+//  Class       : CookedEntryCache
+//  Purpose     : Stores one entry per source file, a fixed size header
+//                followed by a payload, and maps it back while the source
+//                is unchanged.
+//
+//  Responsibilities:
+//      - Names entries by the hash of their source path
+//      - Stamps each entry with the source size, mtime and content hash
+//      - Rejects entries of another kind or version, or whose source changed
+//      - Writes entries to a temporary file and renames them into place
+//      - Can be disabled, or pointed at another directory
+//
+// ============================================================================
+class CookedEntryCache
+{
+  public:
+    CookedEntryCache(std::string name, std::string directory, std::string extension);
+
+    void SetDirectory(const std::string &directory);
+    const std::string &GetDirectory() const;
+
+    void SetEnabled(bool isEnabled);
+    bool IsEnabled() const;
+
+    std::string EntryPath(const std::string &sourcePath) const;
+
+  protected:
+    /// @brief Maps the entry of a source file and reads its header. Header must start with a CookedEntryPrefix named
+    /// prefix, whose default magic and version are the ones the entry must carry.
+    /// @param sourcePath source file, as passed to StoreEntry.
+    /// @param file receives the mapped entry; the payload follows the header.
+    /// @param header receives the header.
+    /// @return false when disabled, missing, stale, of another kind or version, or shorter than a header.
+    template <typename Header> bool LoadEntry(const std::string &sourcePath, MappedFile &file, Header &header) const
+    {
+        if (!OpenEntry(sourcePath, Header{}.prefix, sizeof(Header), file))
+        {
+            return false;
+        }
+
+        std::memcpy(&header, file.Data(), sizeof(Header));
+
+        return true;
+    }
+
+    /// @brief Writes the entry of a source file: header, stamped here with the source's size and mtime, then payload.
+    /// @param sourcePath source file the payload was decoded from.
+    /// @param sourceSize size of the source bytes that were decoded.
+    /// @param header entry header; its prefix's magic, version and content hash must already be set.
+    /// @param payload bytes that follow the header.
+    /// @param payloadBytes size of payload.
+    /// @return true / false
+    template <typename Header>
+    bool StoreEntry(const std::string &sourcePath, std::size_t sourceSize, Header header, const void *payload,
+                    std::size_t payloadBytes) const
+    {
+        if (!StampEntry(sourcePath, sourceSize, header.prefix))
+        {
+            return false;
+        }
+
+        return WriteEntry(sourcePath, &header, sizeof(Header), payload, payloadBytes);
+    }
+
+  private:
+    bool OpenEntry(const std::string &sourcePath, const CookedEntryPrefix &expected, std::size_t headerSize,
+                   MappedFile &file) const;
+    bool StampEntry(const std::string &sourcePath, std::size_t sourceSize, CookedEntryPrefix &prefix) const;
+    bool WriteEntry(const std::string &sourcePath, const void *header, std::size_t headerSize, const void *payload,
+                    std::size_t payloadBytes) const;
+
+  private:
+    std::string m_name;
+    std::string m_directory;
+    std::string m_extension;
+    bool m_isEnabled = true;
+};
@@ -0,0 +1,135 @@
+// ============================================================================
+//  File        : InputEventBuffer.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-22
+//  Description : Fixed capacity ring of input events stamped with the time
+//                they were polled, so gameplay sees their order and timing
+//                inside a frame.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "InputEventBuffer.h"
+
+namespace
+{
+/// @brief Returns whether an event only reports a new position, which a later event of the same source supersedes.
+/// @param event polled event.
+/// @return true / false
+bool IsMotion(const sf::Event &event)
+{
+    return event.type == sf::Event::MouseMoved || event.type == sf::Event::JoystickMoved;
+}
+
+/// @brief Returns whether a motion event supersedes an earlier one: the mouse again, or the same joystick axis.
+/// @param earlier buffered event.
+/// @param later polled event.
+/// @return true / false
+bool Supersedes(const sf::Event &earlier, const sf::Event &later)
+{
+    if (earlier.type != later.type)
+    {
+        return false;
+    }
+
+    if (later.type == sf::Event::MouseMoved)
+    {
+        return true;
+    }
+
+    return later.type == sf::Event::JoystickMoved && earlier.joystickMove.joystickId == later.joystickMove.joystickId &&
+           earlier.joystickMove.axis == later.joystickMove.axis;
+}
+} // namespace
+
+/// @brief Appends an event. A motion event that follows one of the same mouse or joystick axis replaces it instead,
+/// so a moving stick cannot fill the buffer. When the buffer is full the oldest motion event makes room, or the
+/// oldest event if none moves, since presses and releases are the ones gameplay cannot recover.
+/// @param event polled event.
+/// @param timeMs when it was polled.
+void InputEventBuffer::Push(const sf::Event &event, double timeMs)
+{
+    if (m_size > 0)
+    {
+        TimedInputEvent &newest = m_events[(m_head + m_size - 1) % Capacity];
+
+        if (Supersedes(newest.event, event))
+        {
+            newest = TimedInputEvent{event, timeMs};
+
+            return;
+        }
+    }
+
+    if (m_size == Capacity)
+    {
+        DropOldest();
+    }
+
+    m_events[(m_head + m_size) % Capacity] = TimedInputEvent{event, timeMs};
+    ++m_size;
+}
+
+/// @brief Forgets every event. The drop count is kept, as a running total.
+void InputEventBuffer::Clear()
+{
+    m_head = 0;
+    m_size = 0;
+}
+
+/// @brief Returns how many events the buffer holds.
+/// @return m_size.
+std::size_t InputEventBuffer::Size() const
+{
+    return m_size;
+}
+
+/// @brief Returns whether the buffer holds no event.
+/// @return true / false
+bool InputEventBuffer::IsEmpty() const
+{
+    return m_size == 0;
+}
+
+/// @brief Returns an event by age.
+/// @param index 0 for the oldest, up to Size() - 1 for the newest.
+/// @return the event and its timestamp.
+const TimedInputEvent &InputEventBuffer::operator[](std::size_t index) const
+{
+    return m_events[(m_head + index) % Capacity];
+}
+
+/// @brief Returns how many events were dropped to make room before they were read. Merged motion is not counted.
+/// @return m_droppedCount.
+std::size_t InputEventBuffer::GetDroppedCount() const
+{
+    return m_droppedCount;
+}
+
+/// @brief Removes the oldest motion event, closing the gap so order is kept, or the oldest event if none moves.
+void InputEventBuffer::DropOldest()
+{
+    ++m_droppedCount;
+
+    for (std::size_t index = 0; index < m_size; ++index)
+    {
+        if (!IsMotion((*this)[index].event))
+        {
+            continue;
+        }
+
+        for (std::size_t next = index + 1; next < m_size; ++next)
+        {
+            m_events[(m_head + next - 1) % Capacity] = m_events[(m_head + next) % Capacity];
+        }
+
+        --m_size;
+
+        return;
+    }
+
+    m_head = (m_head + 1) % Capacity;
+    --m_size;
+}
@@ -0,0 +1,67 @@
+// ============================================================================
+//  File        : InputEventBuffer.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-22
+//  Description : Fixed capacity ring of input events stamped with the time
+//                they were polled, so gameplay sees their order and timing
+//                inside a frame.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include <SFML/Window/Event.hpp>
+#include <array>
+#include <cstddef>
+
+/// @brief An input event and the moment it was polled.
+struct TimedInputEvent
+{
+    sf::Event event;
+
+    /// @brief Milliseconds on the InputManager's monotonic clock.
+    double timeMs = 0.0;
+};
+
+// ============================================================================
+//  Class       : InputEventBuffer
+//  Purpose     : Holds the input events of one frame, oldest first, without
+//                allocating.
+//
+//  Responsibilities:
+//      - Appends events in the order they were polled
+//      - Merges a motion event into the newest one when it moves the same
+//        mouse or joystick axis, since only the latest position matters
+//      - Once full, drops the oldest motion event before any discrete one,
+//        and counts the drops
+//      - Hands events out by index, oldest first
+//
+// ============================================================================
+class InputEventBuffer
+{
+  public:
+    /// @brief Events one frame can hold. Motion is merged, so the buffer fills only with presses, releases, text and
+    /// wheel steps, and when full it drops motion before any of those.
+    static constexpr std::size_t Capacity = 256;
+
+    void Push(const sf::Event &event, double timeMs);
+    void Clear();
+
+    std::size_t Size() const;
+    bool IsEmpty() const;
+    const TimedInputEvent &operator[](std::size_t index) const;
+
+    std::size_t GetDroppedCount() const;
+
+  private:
+    void DropOldest();
+
+  private:
+    std::array<TimedInputEvent, Capacity> m_events{};
+    std::size_t m_head = 0;
+    std::size_t m_size = 0;
+    std::size_t m_droppedCount = 0;
+};
@@ -30,21 +30,47 @@ void InputManager::Init(std::shared_ptr<Settings> settings)
     m_settings = settings;
     LoadBindings();
 
+    m_clockStart = std::chrono::steady_clock::now();
+    m_frameStartMs = 0.0;
+    m_isManualClock = false;
+    m_manualNowMs = 0.0;
+
     m_isInitialized = true;
 
     CT_LOG_INFO("InputManager initialized.");
 }
 
+/// @brief Provides interface to reload settings: rebinds every action the settings name. Action ids are kept, so
+/// ids resolved before the reload follow the new keys.
+/// @param settings Settings to reload with.
+void InputManager::HotReload(std::shared_ptr<Settings> settings)
+{
+    CT_WARN_IF_UNINITIALIZED("InputManager", "HotReload");
+
+    m_settings = settings;
+
+    for (const auto &[action, key] : m_settings->m_keyBindings)
+    {
+        AssignKey(action, key);
+    }
+
+    CT_LOG_INFO("InputManager hot reloaded {} key bindings.", m_settings->m_keyBindings.size());
+}
+
 /// @brief Shuts down the InputManager and resets internal state.
 void InputManager::Shutdown()
 {
     CT_WARN_IF_UNINITIALIZED("InputManager", "Shutdown");
 
-    m_keyBindings.clear();
-    m_currentState.clear();
-    m_previousState.clear();
-    m_mouseCurrent.clear();
-    m_mousePrevious.clear();
+    m_actionIds.clear();
+    m_actionKeys.clear();
+    m_currentKeys.reset();
+    m_previousKeys.reset();
+    m_seenKeys.reset();
+    m_mouseCurrent.reset();
+    m_mousePrevious.reset();
+    m_seenButtons.reset();
+    m_frameEvents.Clear();
 
     m_settings.reset();
     m_isInitialized = false;
@@ -59,24 +85,48 @@ bool InputManager::IsInitialized() const
     return m_isInitialized;
 }
 
-/// @brief Performs internal state management during a single frame.
+/// @brief Performs internal state management during a single frame, stamping the event with the current time. Call it
+/// right after the event is polled, so the stamp is as close to the input as the window allows.
 /// @param event event to enact on.
 void InputManager::Update(const sf::Event &event)
+{
+    Update(event, NowMs());
+}
+
+/// @brief Performs internal state management during a single frame, with a timestamp supplied by the caller, such as
+/// one recorded earlier.
+/// @param event event to enact on.
+/// @param timeMs when the event happened, on the NowMs clock.
+void InputManager::Update(const sf::Event &event, double timeMs)
 {
     CT_WARN_IF_UNINITIALIZED("InputManager", "Update");
 
+    if (IsInputEvent(event))
+    {
+        m_frameEvents.Push(event, timeMs);
+    }
+
     switch (event.type)
     {
         case sf::Event::KeyPressed:
         case sf::Event::KeyReleased:
         {
-            bool isDown = (event.type == sf::Event::KeyPressed);
-            m_currentState[event.key.code] = isDown;
+            const bool isDown = (event.type == sf::Event::KeyPressed);
+            const sf::Keyboard::Key key = event.key.code;
 
-            // Ensure the key has a previous state entry too
-            if (!m_previousState.contains(event.key.code))
+            // Keys SFML cannot identify have no slot.
+            if (key < 0 || key >= sf::Keyboard::KeyCount)
             {
-                m_previousState[event.key.code] = !isDown;
+                break;
+            }
+
+            m_currentKeys[key] = isDown;
+
+            // The first event for a key implies its state before it
+            if (!m_seenKeys[key])
+            {
+                m_previousKeys[key] = !isDown;
+                m_seenKeys[key] = true;
             }
         }
 
@@ -90,17 +140,18 @@ void InputManager::Update(const sf::Event &event)
         case sf::Event::MouseButtonPressed:
         case sf::Event::MouseButtonReleased:
         {
-            bool isDown = event.type == sf::Event::MouseButtonPressed;
-            auto button = event.mouseButton.button;
+            const bool isDown = event.type == sf::Event::MouseButtonPressed;
+            const sf::Mouse::Button button = event.mouseButton.button;
 
-            if (!m_mouseCurrent.contains(button))
+            if (button < 0 || button >= sf::Mouse::ButtonCount)
             {
-                m_mouseCurrent[button] = isDown;
+                break;
             }
 
-            if (!m_mousePrevious.contains(button))
+            if (!m_seenButtons[button])
             {
                 m_mousePrevious[button] = !isDown;
+                m_seenButtons[button] = true;
             }
 
             m_mouseCurrent[button] = isDown;
@@ -113,70 +164,150 @@ void InputManager::Update(const sf::Event &event)
     }
 }
 
-/// @brief Completes state management during the end of a frame.
+/// @brief Completes state management during the end of a frame. Held keys stay held, so the current state carries
+/// over; with bitsets that is a copy of a few machine words, no allocation. The frame's events are dropped and the
+/// next frame starts now.
 void InputManager::PostUpdate()
 {
     CT_WARN_IF_UNINITIALIZED("InputManager", "PostUpdate");
 
-    m_previousState = m_currentState;
+    m_previousKeys = m_currentKeys;
     m_mousePrevious = m_mouseCurrent;
+
+    m_frameEvents.Clear();
+    m_frameStartMs = NowMs();
 }
 
-/// @brief Returns the state of whether a key is still being pressed based on the input action.
-/// @param action determine if the action is bound to key, and if it is being pressed.
-/// @return true / false
-bool InputManager::IsKeyPressed(const std::string &action) const
+/// @brief Returns the time on the monotonic clock input events are stamped with.
+/// @return milliseconds since Init, or the manual clock's time while it is in use.
+double InputManager::NowMs() const
 {
-    CT_WARN_IF_UNINITIALIZED_RET("InputManager", "IsKeyPressed", false);
-
-    if (!m_keyBindings.contains(action))
+    if (m_isManualClock)
     {
-        return false;
+        return m_manualNowMs;
     }
 
-    sf::Keyboard::Key key = m_keyBindings.at(action);
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_clockStart).count();
+}
+
+/// @brief Returns when the current frame's events began to collect, so an event's offset into the frame is its
+/// timeMs minus this.
+/// @return NowMs at the last PostUpdate, or 0 before the first.
+double InputManager::GetFrameStartMs() const
+{
+    return m_frameStartMs;
+}
 
-    return m_currentState.contains(key) ? m_currentState.at(key) : false;
+/// @brief Returns the input events received since the last PostUpdate, in the order they were polled and stamped
+/// with when. Gameplay that cares about order or timing inside a frame, such as a fire rate that should not depend on
+/// the frame rate, reads these instead of the per frame key state.
+/// @return events, oldest first.
+const InputEventBuffer &InputManager::GetFrameEvents() const
+{
+    return m_frameEvents;
 }
 
-/// @brief Returns the state of if a key has just been pressed, based on the input action.
-/// @param action determine if the action is bound to key, and if it is just being pressed now.
-/// @return true / false
-bool InputManager::IsKeyJustPressed(const std::string &action) const
+/// @brief Switches NowMs between the steady clock and a manual clock that only moves through AdvanceManualClock. A
+/// replay drives it with the recorded frame deltas, so frame starts and event stamps repeat from run to run. Either
+/// way the clock picks up where the other left off, so time never goes backwards.
+/// @param isManual true to run the clock by hand.
+void InputManager::SetManualClock(bool isManual)
 {
-    CT_WARN_IF_UNINITIALIZED_RET("InputManager", "IsKeyJustPressed", false);
+    CT_WARN_IF_UNINITIALIZED("InputManager", "SetManualClock");
 
-    if (!m_keyBindings.contains(action))
+    if (isManual == m_isManualClock)
     {
-        return false;
+        return;
     }
 
-    sf::Keyboard::Key key = m_keyBindings.at(action);
+    if (isManual)
+    {
+        m_manualNowMs = NowMs();
+    }
+    else
+    {
+        const auto elapsed = std::chrono::duration<double, std::milli>(m_manualNowMs);
+        m_clockStart =
+            std::chrono::steady_clock::now() - std::chrono::duration_cast<std::chrono::steady_clock::duration>(elapsed);
+    }
 
-    const bool curr = m_currentState.contains(key) ? m_currentState.at(key) : false;
-    const bool prev = m_previousState.contains(key) ? m_previousState.at(key) : false;
+    m_isManualClock = isManual;
+}
 
-    return curr && !prev;
+/// @brief Moves the manual clock forward. Does nothing while the steady clock is in use.
+/// @param ms milliseconds to advance by; negative values are ignored.
+void InputManager::AdvanceManualClock(double ms)
+{
+    if (m_isManualClock && ms > 0.0)
+    {
+        m_manualNowMs += ms;
+    }
 }
 
-/// @brief Returns the state of if a key has just been released, based on the input action.
-/// @param action determine if the action is bound to key, and if it is just being released now.
+/// @brief Returns whether NowMs is running on the manual clock.
+/// @return m_isManualClock.
+bool InputManager::IsManualClock() const
+{
+    return m_isManualClock;
+}
+
+/// @brief Returns whether the key bound to an action is being pressed. Costs an array index and a bit test.
+/// @param action id from BindKey or GetActionId.
 /// @return true / false
-bool InputManager::IsKeyJustReleased(const std::string &action) const
+bool InputManager::IsKeyPressed(InputActionId action) const
+{
+    CT_WARN_IF_UNINITIALIZED_RET("InputManager", "IsKeyPressed", false);
+
+    return IsSet(m_currentKeys, KeyOf(action));
+}
+
+/// @brief Returns whether the key bound to an action went down this frame.
+/// @param action id from BindKey or GetActionId.
+/// @return true / false
+bool InputManager::IsKeyJustPressed(InputActionId action) const
+{
+    CT_WARN_IF_UNINITIALIZED_RET("InputManager", "IsKeyJustPressed", false);
+
+    const sf::Keyboard::Key key = KeyOf(action);
+
+    return IsSet(m_currentKeys, key) && !IsSet(m_previousKeys, key);
+}
+
+/// @brief Returns whether the key bound to an action went up this frame.
+/// @param action id from BindKey or GetActionId.
+/// @return true / false
+bool InputManager::IsKeyJustReleased(InputActionId action) const
 {
     CT_WARN_IF_UNINITIALIZED_RET("InputManager", "IsKeyJustReleased", false);
 
-    if (!m_keyBindings.contains(action))
-    {
-        return false;
-    }
+    const sf::Keyboard::Key key = KeyOf(action);
 
-    sf::Keyboard::Key key = m_keyBindings.at(action);
+    return !IsSet(m_currentKeys, key) && IsSet(m_previousKeys, key);
+}
+
+/// @brief Returns the state of whether a key is still being pressed based on the input action. Hashes the name on
+/// every call; per frame code should keep the InputActionId instead.
+/// @param action determine if the action is bound to key, and if it is being pressed.
+/// @return true / false
+bool InputManager::IsKeyPressed(const std::string &action) const
+{
+    return IsKeyPressed(FindAction(action));
+}
 
-    const bool curr = m_currentState.contains(key) ? m_currentState.at(key) : false;
-    const bool prev = m_previousState.contains(key) ? m_previousState.at(key) : false;
+/// @brief Returns the state of if a key has just been pressed, based on the input action.
+/// @param action determine if the action is bound to key, and if it is just being pressed now.
+/// @return true / false
+bool InputManager::IsKeyJustPressed(const std::string &action) const
+{
+    return IsKeyJustPressed(FindAction(action));
+}
 
-    return !curr && prev;
+/// @brief Returns the state of if a key has just been released, based on the input action.
+/// @param action determine if the action is bound to key, and if it is just being released now.
+/// @return true / false
+bool InputManager::IsKeyJustReleased(const std::string &action) const
+{
+    return IsKeyJustReleased(FindAction(action));
 }
 
 /// @brief Returns the currently tracked position of the mouse.
@@ -204,7 +335,10 @@ void InputManager::SetMouseButtonState(sf::Mouse::Button button, bool isPressed)
 {
     CT_WARN_IF_UNINITIALIZED("InputManager", "SetMouseButtonState");
 
-    m_mouseCurrent[button] = isPressed;
+    if (button >= 0 && button < sf::Mouse::ButtonCount)
+    {
+        m_mouseCurrent[button] = isPressed;
+    }
 }
 
 /// @brief Returns whether or not the Mouse button identified as 'button' is being pressed.
@@ -214,7 +348,7 @@ bool InputManager::IsMouseButtonPressed(sf::Mouse::Button button) const
 {
     CT_WARN_IF_UNINITIALIZED_RET("InputManager", "IsMouseButtonPressed", false);
 
-    return m_mouseCurrent.contains(button) ? m_mouseCurrent.at(button) : false;
+    return IsSet(m_mouseCurrent, button);
 }
 
 /// @brief Returns whether or not the Mouse button identified as 'button' has just been pressed the first time.
@@ -224,10 +358,7 @@ bool InputManager::IsMouseButtonJustPressed(sf::Mouse::Button button) const
 {
     CT_WARN_IF_UNINITIALIZED_RET("InputManager", "IsMouseButtonJustPressed", false);
 
-    bool curr = m_mouseCurrent.contains(button) ? m_mouseCurrent.at(button) : false;
-    bool prev = m_mousePrevious.contains(button) ? m_mousePrevious.at(button) : false;
-
-    return curr && !prev;
+    return IsSet(m_mouseCurrent, button) && !IsSet(m_mousePrevious, button);
 }
 
 /// @brief Returns whether or not the Mouse button identified as 'button' has just been released.
@@ -237,10 +368,7 @@ bool InputManager::IsMouseButtonJustReleased(sf::Mouse::Button button) const
 {
     CT_WARN_IF_UNINITIALIZED_RET("InputManager", "IsMouseButtonJustReleased", false);
 
-    bool curr = m_mouseCurrent.contains(button) ? m_mouseCurrent.at(button) : false;
-    bool prev = m_mousePrevious.contains(button) ? m_mousePrevious.at(button) : false;
-
-    return !curr && prev;
+    return !IsSet(m_mouseCurrent, button) && IsSet(m_mousePrevious, button);
 }
 
 /// @brief Internally updates the state when SFML events are received
@@ -250,46 +378,66 @@ void InputManager::UpdateMouseButton(sf::Mouse::Button button, bool isDown)
 {
     CT_WARN_IF_UNINITIALIZED("InputManager", "UpdateMouseButton");
 
-    if (!m_mousePrevious.contains(button))
+    if (button < 0 || button >= sf::Mouse::ButtonCount)
     {
-        m_mousePrevious[button] = !isDown;
+        return;
     }
 
+    m_seenButtons[button] = true;
     m_mousePrevious[button] = isDown;
 }
 
-/// @brief Stores an input action and the matching SFML Key to an internal unordered map.
+/// @brief Binds an input action to an SFML Key. The first bind of a name assigns its id; rebinding keeps it, so ids
+/// resolved earlier follow the new key.
 /// @param action The string representation for the action.
 /// @param key Button key to bind action to.
-void InputManager::BindKey(const std::string &action, sf::Keyboard::Key key)
+/// @return id of the action, to query it without the name; invalid if the id space is exhausted.
+InputActionId InputManager::BindKey(const std::string &action, sf::Keyboard::Key key)
 {
-    CT_WARN_IF_UNINITIALIZED("InputManager", "BindKey");
+    CT_WARN_IF_UNINITIALIZED_RET("InputManager", "BindKey", InputActionId{});
 
-    m_keyBindings[action] = key;
+    return AssignKey(action, key);
 }
 
-/// @brief Removes an input action and the matching SFML Key from the internal unordered map.
+/// @brief Removes the key from an input action. The action keeps its id, which reads as unbound until it is bound
+/// again.
 /// @param action The string representation for the action.
 void InputManager::UnbindKey(const std::string &action)
 {
     CT_WARN_IF_UNINITIALIZED("InputManager", "UnbindKey");
 
-    m_keyBindings.erase(action);
+    if (const InputActionId id = FindAction(action); id.IsValid())
+    {
+        m_actionKeys[id.index] = sf::Keyboard::Unknown;
+    }
 }
 
-/// @brief Returns the matching SFML Key if the supplied action maps correctly to the internal unordered map.
+/// @brief Resolves an action name to its id, meant to be done once outside the hot path.
 /// @param action The string representation for the action.
+/// @return id of the action, or an invalid one if it was never bound.
+InputActionId InputManager::GetActionId(const std::string &action) const
+{
+    CT_WARN_IF_UNINITIALIZED_RET("InputManager", "GetActionId", InputActionId{});
+
+    return FindAction(action);
+}
+
+/// @brief Returns the SFML Key an action is bound to.
+/// @param action id from BindKey or GetActionId.
 /// @return The keyboard key which is mapped to the action.
-sf::Keyboard::Key InputManager::GetBoundKey(const std::string &action) const
+sf::Keyboard::Key InputManager::GetBoundKey(InputActionId action) const
 {
     CT_WARN_IF_UNINITIALIZED_RET("InputManager", "GetBoundKey", sf::Keyboard::Unknown);
 
-    if (m_keyBindings.contains(action))
-    {
-        return m_keyBindings.at(action);
-    }
+    return KeyOf(action);
+}
 
-    return sf::Keyboard::Unknown;
+/// @brief Returns the matching SFML Key if the supplied action maps correctly to a bound action.
+/// @param action The string representation for the action.
+/// @return The keyboard key which is mapped to the action.
+sf::Keyboard::Key InputManager::GetBoundKey(const std::string &action) const
+{
+    return GetBoundKey(FindAction(action));
 }
 
 /// @brief Applies synchronization between the manager settings of SFML Key bindings and the Settings object.
@@ -297,8 +445,98 @@ void InputManager::LoadBindings()
 {
     // TODO, provide additional key bindings for various scenes. This merely loads some easy defaults.
     // Initialize key bindings from settings or defaults
-    m_keyBindings["MoveUp"] = sf::Keyboard::W;
-    m_keyBindings["MoveDown"] = sf::Keyboard::S;
-    m_keyBindings["MoveLeft"] = sf::Keyboard::A;
-    m_keyBindings["MoveRight"] = sf::Keyboard::D;
+    AssignKey("MoveUp", sf::Keyboard::W);
+    AssignKey("MoveDown", sf::Keyboard::S);
+    AssignKey("MoveLeft", sf::Keyboard::A);
+    AssignKey("MoveRight", sf::Keyboard::D);
+}
+
+/// @brief Binds a key to an action, assigning the next id to names bound for the first time.
+/// @param action The string representation for the action.
+/// @param key Button key to bind action to.
+/// @return id of the action; invalid if the id space is exhausted.
+InputActionId InputManager::AssignKey(const std::string &action, sf::Keyboard::Key key)
+{
+    InputActionId id = FindAction(action);
+
+    if (!id.IsValid())
+    {
+        if (m_actionKeys.size() >= InputActionId::InvalidIndex)
+        {
+            CT_LOG_ERROR("InputManager: too many input actions, '{}' is not bound.", action);
+
+            return id;
+        }
+
+        id.index = static_cast<std::uint16_t>(m_actionKeys.size());
+        m_actionIds[action] = id;
+        m_actionKeys.push_back(sf::Keyboard::Unknown);
+    }
+
+    m_actionKeys[id.index] = key;
+
+    return id;
+}
+
+/// @brief Looks an action name up without the initialization check, for the string wrappers.
+/// @param action The string representation for the action.
+/// @return id of the action, or an invalid one.
+InputActionId InputManager::FindAction(const std::string &action) const
+{
+    auto it = m_actionIds.find(action);
+
+    return it == m_actionIds.end() ? InputActionId{} : it->second;
+}
+
+/// @brief Returns the key bound to an action id.
+/// @param action any id, valid or not.
+/// @return bound key, or Unknown for unbound and invalid ids.
+sf::Keyboard::Key InputManager::KeyOf(InputActionId action) const
+{
+    return action.index < m_actionKeys.size() ? m_actionKeys[action.index] : sf::Keyboard::Unknown;
+}
+
+/// @brief Tests a key bit, treating keys SFML cannot identify as up.
+/// @param bits key state.
+/// @param key key to test.
+/// @return true / false
+bool InputManager::IsSet(const KeyBits &bits, sf::Keyboard::Key key)
+{
+    return key >= 0 && key < sf::Keyboard::KeyCount && bits[key];
+}
+
+/// @brief Returns whether an event comes from an input device, as opposed to the window.
+/// @param event polled event.
+/// @return true / false
+bool InputManager::IsInputEvent(const sf::Event &event)
+{
+    switch (event.type)
+    {
+        case sf::Event::TextEntered:
+        case sf::Event::KeyPressed:
+        case sf::Event::KeyReleased:
+        case sf::Event::MouseWheelScrolled:
+        case sf::Event::MouseButtonPressed:
+        case sf::Event::MouseButtonReleased:
+        case sf::Event::MouseMoved:
+        case sf::Event::JoystickButtonPressed:
+        case sf::Event::JoystickButtonReleased:
+        case sf::Event::JoystickMoved:
+        case sf::Event::TouchBegan:
+        case sf::Event::TouchMoved:
+        case sf::Event::TouchEnded:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/// @brief Tests a mouse button bit, treating out of range buttons as up.
+/// @param bits button state.
+/// @param button button to test.
+/// @return true / false
+bool InputManager::IsSet(const MouseBits &bits, sf::Mouse::Button button)
+{
+    return button >= 0 && button < sf::Mouse::ButtonCount && bits[button];
 }
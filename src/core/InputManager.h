@@ -12,11 +12,35 @@
 
 #pragma once
 
+#include "InputEventBuffer.h"
 #include "Settings.h"
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <string>
 #include <unordered_map>
+#include <vector>
+
+/// @brief Dense index of an input action. Resolve it once with BindKey or GetActionId; it stays valid through rebinds
+/// and unbinds until the InputManager shuts down.
+struct InputActionId
+{
+    static constexpr std::uint16_t InvalidIndex = std::numeric_limits<std::uint16_t>::max();
+
+    std::uint16_t index = InvalidIndex;
+
+    constexpr bool IsValid() const
+    {
+        return index != InvalidIndex;
+    }
+
+    constexpr bool operator==(const InputActionId &other) const = default;
+};
 
 // ============================================================================
 //  Class       : InputManager
@@ -25,6 +49,10 @@
 //  Responsibilities:
 //      - Initializes and shuts down
 //      - Returns Key Press, Key Held, Key Release.
+//      - Keeps key and mouse button state in bitsets indexed by SFML code
+//      - Resolves action names to integer ids once, at bind time
+//      - Keeps the frame's input events in order, stamped when polled
+//      - Runs its clock by hand when input is replayed
 //
 // ============================================================================
 class InputManager
@@ -33,13 +61,29 @@ class InputManager
     static InputManager &Instance();
 
     void Init(std::shared_ptr<Settings> settings);
+    void HotReload(std::shared_ptr<Settings> settings);
     void Shutdown();
 
     bool IsInitialized() const;
 
     void Update(const sf::Event &event);
+    void Update(const sf::Event &event, double timeMs);
     void PostUpdate();
 
+    double NowMs() const;
+    double GetFrameStartMs() const;
+    const InputEventBuffer &GetFrameEvents() const;
+
+    void SetManualClock(bool isManual);
+    void AdvanceManualClock(double ms);
+    bool IsManualClock() const;
+
+    static bool IsInputEvent(const sf::Event &event);
+
+    bool IsKeyPressed(InputActionId action) const;
+    bool IsKeyJustPressed(InputActionId action) const;
+    bool IsKeyJustReleased(InputActionId action) const;
+
     bool IsKeyPressed(const std::string &action) const;
     bool IsKeyJustPressed(const std::string &action) const;
     bool IsKeyJustReleased(const std::string &action) const;
@@ -53,11 +97,16 @@ class InputManager
     bool IsMouseButtonJustReleased(sf::Mouse::Button button) const;
     void UpdateMouseButton(sf::Mouse::Button button, bool isDown);
 
-    void BindKey(const std::string &action, sf::Keyboard::Key key);
+    InputActionId BindKey(const std::string &action, sf::Keyboard::Key key);
     void UnbindKey(const std::string &action);
+    InputActionId GetActionId(const std::string &action) const;
+    sf::Keyboard::Key GetBoundKey(InputActionId action) const;
     sf::Keyboard::Key GetBoundKey(const std::string &action) const;
 
   private:
+    using KeyBits = std::bitset<sf::Keyboard::KeyCount>;
+    using MouseBits = std::bitset<sf::Mouse::ButtonCount>;
+
     InputManager() = default;
     ~InputManager() = default;
 
@@ -65,15 +114,33 @@ class InputManager
     InputManager &operator=(const InputManager &) = delete;
 
     void LoadBindings();
+    InputActionId AssignKey(const std::string &action, sf::Keyboard::Key key);
+    InputActionId FindAction(const std::string &action) const;
+    sf::Keyboard::Key KeyOf(InputActionId action) const;
+
+    static bool IsSet(const KeyBits &bits, sf::Keyboard::Key key);
+    static bool IsSet(const MouseBits &bits, sf::Mouse::Button button);
 
   private:
-    std::unordered_map<std::string, sf::Keyboard::Key> m_keyBindings;
-    std::unordered_map<sf::Keyboard::Key, bool> m_currentState;
-    std::unordered_map<sf::Keyboard::Key, bool> m_previousState;
+    std::unordered_map<std::string, InputActionId> m_actionIds;
+    std::vector<sf::Keyboard::Key> m_actionKeys;
+
+    KeyBits m_currentKeys;
+    KeyBits m_previousKeys;
+    KeyBits m_seenKeys;
 
     sf::Vector2i m_mousePosition;
-    std::unordered_map<sf::Mouse::Button, bool> m_mouseCurrent;
-    std::unordered_map<sf::Mouse::Button, bool> m_mousePrevious;
+    MouseBits m_mouseCurrent;
+    MouseBits m_mousePrevious;
+    MouseBits m_seenButtons;
+
+    std::chrono::steady_clock::time_point m_clockStart;
+    double m_frameStartMs = 0.0;
+    InputEventBuffer m_frameEvents;
+
+    // Manual clock: NowMs only moves when AdvanceManualClock is called, so a replay sees the recorded timeline.
+    bool m_isManualClock = false;
+    double m_manualNowMs = 0.0;
 
     std::shared_ptr<Settings> m_settings;
     bool m_isInitialized = false;
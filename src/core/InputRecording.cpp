@@ -0,0 +1,641 @@
+// ============================================================================
+//  File        : InputRecording.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-23
+//  Description : Per frame input stream, frame delta plus the frame's input
+//                events, saved to and loaded from a compact binary file so a
+//                session can be replayed without a person at the keyboard.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "InputRecording.h"
+#include "Macros.h"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+namespace
+{
+/// @brief "CTIR", little endian.
+constexpr std::uint32_t INPUT_RECORDING_MAGIC = 0x52495443;
+
+/// @brief Bump whenever the layout changes; older recordings are then refused rather than misread. Version 2 dropped
+/// the frame count from the header so frames can be appended as they are played.
+constexpr std::uint32_t INPUT_RECORDING_VERSION = 2;
+
+/// @brief Key modifier bits, packed into one byte.
+constexpr std::uint8_t MODIFIER_ALT = 1 << 0;
+constexpr std::uint8_t MODIFIER_CONTROL = 1 << 1;
+constexpr std::uint8_t MODIFIER_SHIFT = 1 << 2;
+constexpr std::uint8_t MODIFIER_SYSTEM = 1 << 3;
+
+/// @brief Appends a value's bytes. Recordings are read back on the machine family that wrote them, so the native
+/// little endian layout is kept, as the disk caches do.
+/// @param bytes destination.
+/// @param value value to append.
+template <typename T> void Write(std::vector<std::uint8_t> &bytes, T value)
+{
+    const auto *data = reinterpret_cast<const std::uint8_t *>(&value);
+    bytes.insert(bytes.end(), data, data + sizeof(T));
+}
+
+/// @brief Bounds checked cursor over a loaded recording.
+struct ByteReader
+{
+    const std::uint8_t *data = nullptr;
+    std::size_t size = 0;
+    std::size_t offset = 0;
+
+    /// @brief Set once a read finds the recording ending before the value does.
+    bool hasRunOut = false;
+
+    /// @brief Reads the next value.
+    /// @param value receives it.
+    /// @return false if the recording ends first.
+    template <typename T> bool Read(T &value)
+    {
+        if (size - offset < sizeof(T))
+        {
+            hasRunOut = true;
+
+            return false;
+        }
+
+        std::memcpy(&value, data + offset, sizeof(T));
+        offset += sizeof(T);
+
+        return true;
+    }
+
+    /// @brief Returns whether every byte was read.
+    /// @return true / false
+    bool IsAtEnd() const
+    {
+        return offset == size;
+    }
+};
+
+/// @brief Appends one event: its type, its offset into the frame, then only the fields that type uses.
+/// @param bytes destination.
+/// @param timed event and its offset from the frame start.
+/// @return false for events that are not input, which are left out.
+bool WriteEvent(std::vector<std::uint8_t> &bytes, const TimedInputEvent &timed)
+{
+    const sf::Event &event = timed.event;
+    const std::size_t start = bytes.size();
+
+    Write(bytes, static_cast<std::uint8_t>(event.type));
+    Write(bytes, static_cast<float>(timed.timeMs));
+
+    switch (event.type)
+    {
+        case sf::Event::KeyPressed:
+        case sf::Event::KeyReleased:
+            Write(bytes, static_cast<std::int16_t>(event.key.code));
+            Write(bytes, static_cast<std::uint8_t>((event.key.alt ? MODIFIER_ALT : 0) |
+                                                   (event.key.control ? MODIFIER_CONTROL : 0) |
+                                                   (event.key.shift ? MODIFIER_SHIFT : 0) |
+                                                   (event.key.system ? MODIFIER_SYSTEM : 0)));
+            return true;
+
+        case sf::Event::TextEntered:
+            Write(bytes, static_cast<std::uint32_t>(event.text.unicode));
+            return true;
+
+        case sf::Event::MouseMoved:
+            Write(bytes, static_cast<std::int32_t>(event.mouseMove.x));
+            Write(bytes, static_cast<std::int32_t>(event.mouseMove.y));
+            return true;
+
+        case sf::Event::MouseButtonPressed:
+        case sf::Event::MouseButtonReleased:
+            Write(bytes, static_cast<std::uint8_t>(event.mouseButton.button));
+            Write(bytes, static_cast<std::int32_t>(event.mouseButton.x));
+            Write(bytes, static_cast<std::int32_t>(event.mouseButton.y));
+            return true;
+
+        case sf::Event::MouseWheelScrolled:
+            Write(bytes, static_cast<std::uint8_t>(event.mouseWheelScroll.wheel));
+            Write(bytes, event.mouseWheelScroll.delta);
+            Write(bytes, static_cast<std::int32_t>(event.mouseWheelScroll.x));
+            Write(bytes, static_cast<std::int32_t>(event.mouseWheelScroll.y));
+            return true;
+
+        case sf::Event::JoystickButtonPressed:
+        case sf::Event::JoystickButtonReleased:
+            Write(bytes, static_cast<std::uint8_t>(event.joystickButton.joystickId));
+            Write(bytes, static_cast<std::uint8_t>(event.joystickButton.button));
+            return true;
+
+        case sf::Event::JoystickMoved:
+            Write(bytes, static_cast<std::uint8_t>(event.joystickMove.joystickId));
+            Write(bytes, static_cast<std::uint8_t>(event.joystickMove.axis));
+            Write(bytes, event.joystickMove.position);
+            return true;
+
+        case sf::Event::TouchBegan:
+        case sf::Event::TouchMoved:
+        case sf::Event::TouchEnded:
+            Write(bytes, static_cast<std::uint8_t>(event.touch.finger));
+            Write(bytes, static_cast<std::int32_t>(event.touch.x));
+            Write(bytes, static_cast<std::int32_t>(event.touch.y));
+            return true;
+
+        default:
+            bytes.resize(start);
+            return false;
+    }
+}
+
+/// @brief Reads one event written by WriteEvent.
+/// @param reader cursor over the recording.
+/// @param timed receives the event and its offset from the frame start.
+/// @return false if the recording ends first or holds an unknown event type.
+bool ReadEvent(ByteReader &reader, TimedInputEvent &timed)
+{
+    std::uint8_t type = 0;
+    float offsetMs = 0.0f;
+
+    if (!reader.Read(type) || !reader.Read(offsetMs))
+    {
+        return false;
+    }
+
+    sf::Event &event = timed.event;
+    event = sf::Event{};
+    event.type = static_cast<sf::Event::EventType>(type);
+    timed.timeMs = offsetMs;
+
+    switch (event.type)
+    {
+        case sf::Event::KeyPressed:
+        case sf::Event::KeyReleased:
+        {
+            std::int16_t code = 0;
+            std::uint8_t modifiers = 0;
+
+            if (!reader.Read(code) || !reader.Read(modifiers))
+            {
+                return false;
+            }
+
+            event.key.code = static_cast<sf::Keyboard::Key>(code);
+            event.key.alt = (modifiers & MODIFIER_ALT) != 0;
+            event.key.control = (modifiers & MODIFIER_CONTROL) != 0;
+            event.key.shift = (modifiers & MODIFIER_SHIFT) != 0;
+            event.key.system = (modifiers & MODIFIER_SYSTEM) != 0;
+            return true;
+        }
+
+        case sf::Event::TextEntered:
+        {
+            std::uint32_t unicode = 0;
+
+            if (!reader.Read(unicode))
+            {
+                return false;
+            }
+
+            event.text.unicode = unicode;
+            return true;
+        }
+
+        case sf::Event::MouseMoved:
+        {
+            std::int32_t x = 0;
+            std::int32_t y = 0;
+
+            if (!reader.Read(x) || !reader.Read(y))
+            {
+                return false;
+            }
+
+            event.mouseMove.x = x;
+            event.mouseMove.y = y;
+            return true;
+        }
+
+        case sf::Event::MouseButtonPressed:
+        case sf::Event::MouseButtonReleased:
+        {
+            std::uint8_t button = 0;
+            std::int32_t x = 0;
+            std::int32_t y = 0;
+
+            if (!reader.Read(button) || !reader.Read(x) || !reader.Read(y))
+            {
+                return false;
+            }
+
+            event.mouseButton.button = static_cast<sf::Mouse::Button>(button);
+            event.mouseButton.x = x;
+            event.mouseButton.y = y;
+            return true;
+        }
+
+        case sf::Event::MouseWheelScrolled:
+        {
+            std::uint8_t wheel = 0;
+            float delta = 0.0f;
+            std::int32_t x = 0;
+            std::int32_t y = 0;
+
+            if (!reader.Read(wheel) || !reader.Read(delta) || !reader.Read(x) || !reader.Read(y))
+            {
+                return false;
+            }
+
+            event.mouseWheelScroll.wheel = static_cast<sf::Mouse::Wheel>(wheel);
+            event.mouseWheelScroll.delta = delta;
+            event.mouseWheelScroll.x = x;
+            event.mouseWheelScroll.y = y;
+            return true;
+        }
+
+        case sf::Event::JoystickButtonPressed:
+        case sf::Event::JoystickButtonReleased:
+        {
+            std::uint8_t joystickId = 0;
+            std::uint8_t button = 0;
+
+            if (!reader.Read(joystickId) || !reader.Read(button))
+            {
+                return false;
+            }
+
+            event.joystickButton.joystickId = joystickId;
+            event.joystickButton.button = button;
+            return true;
+        }
+
+        case sf::Event::JoystickMoved:
+        {
+            std::uint8_t joystickId = 0;
+            std::uint8_t axis = 0;
+            float position = 0.0f;
+
+            if (!reader.Read(joystickId) || !reader.Read(axis) || !reader.Read(position))
+            {
+                return false;
+            }
+
+            event.joystickMove.joystickId = joystickId;
+            event.joystickMove.axis = static_cast<sf::Joystick::Axis>(axis);
+            event.joystickMove.position = position;
+            return true;
+        }
+
+        case sf::Event::TouchBegan:
+        case sf::Event::TouchMoved:
+        case sf::Event::TouchEnded:
+        {
+            std::uint8_t finger = 0;
+            std::int32_t x = 0;
+            std::int32_t y = 0;
+
+            if (!reader.Read(finger) || !reader.Read(x) || !reader.Read(y))
+            {
+                return false;
+            }
+
+            event.touch.finger = finger;
+            event.touch.x = x;
+            event.touch.y = y;
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+/// @brief Appends one frame: its delta, its event count, then its events. Events of types the format leaves out are
+/// skipped, and a frame keeps at most 65535 events.
+/// @param bytes destination.
+/// @param dt frame delta, in seconds.
+/// @param eventCount events the frame offers.
+/// @param eventAt returns an event by index, stamped as an offset from the frame start.
+/// @return events written.
+template <typename EventAt>
+std::size_t AppendFrame(std::vector<std::uint8_t> &bytes, float dt, std::size_t eventCount, EventAt eventAt)
+{
+    Write(bytes, dt);
+
+    const std::size_t countOffset = bytes.size();
+    std::uint16_t count = 0;
+    Write(bytes, count);
+
+    for (std::size_t i = 0; i < eventCount; ++i)
+    {
+        if (count < std::numeric_limits<std::uint16_t>::max() && WriteEvent(bytes, eventAt(i)))
+        {
+            ++count;
+        }
+    }
+
+    std::memcpy(bytes.data() + countOffset, &count, sizeof(count));
+
+    return count;
+}
+} // namespace
+
+/// @brief Appends a frame from the InputManager's frame events, rebasing their stamps onto the frame start so the
+/// recording does not depend on when the session began.
+/// @param dt frame delta, in seconds, as the frame's updates saw it.
+/// @param events InputManager::GetFrameEvents.
+/// @param frameStartMs InputManager::GetFrameStartMs.
+void InputRecording::AddFrame(float dt, const InputEventBuffer &events, double frameStartMs)
+{
+    InputFrame frame;
+    frame.dt = dt;
+    frame.events.reserve(events.Size());
+
+    for (std::size_t i = 0; i < events.Size(); ++i)
+    {
+        frame.events.push_back(TimedInputEvent{events[i].event, events[i].timeMs - frameStartMs});
+    }
+
+    m_frames.push_back(std::move(frame));
+}
+
+/// @brief Appends a frame as is.
+/// @param frame frame whose event stamps are already offsets from its start.
+void InputRecording::AddFrame(InputFrame frame)
+{
+    m_frames.push_back(std::move(frame));
+}
+
+/// @brief Forgets every frame.
+void InputRecording::Clear()
+{
+    m_frames.clear();
+}
+
+/// @brief Returns how many frames were recorded or loaded.
+/// @return m_frames size.
+std::size_t InputRecording::GetFrameCount() const
+{
+    return m_frames.size();
+}
+
+/// @brief Returns how many events all frames hold together.
+/// @return event count.
+std::size_t InputRecording::GetEventCount() const
+{
+    std::size_t count = 0;
+
+    for (const InputFrame &frame : m_frames)
+    {
+        count += frame.events.size();
+    }
+
+    return count;
+}
+
+/// @brief Returns a frame by index.
+/// @param index 0 up to GetFrameCount() - 1.
+/// @return the frame.
+const InputFrame &InputRecording::GetFrame(std::size_t index) const
+{
+    return m_frames[index];
+}
+
+/// @brief Writes the recording in the format InputRecordingWriter streams.
+/// @param filepath file to create or replace.
+/// @return true / false
+bool InputRecording::SaveToFile(const std::string &filepath) const
+{
+    InputRecordingWriter writer;
+
+    if (!writer.Open(filepath))
+    {
+        return false;
+    }
+
+    for (const InputFrame &frame : m_frames)
+    {
+        writer.WriteFrame(frame);
+    }
+
+    return writer.Close();
+}
+
+/// @brief Replaces the frames with the ones in a recording written by SaveToFile or InputRecordingWriter.
+/// @param filepath recording to read.
+/// @return false, leaving the recording empty, if the file is missing, from another version or malformed. A last frame
+/// cut short is dropped rather than refusing the file.
+bool InputRecording::LoadFromFile(const std::string &filepath)
+{
+    m_frames.clear();
+
+    std::ifstream in(filepath, std::ios::binary);
+
+    if (!in.is_open())
+    {
+        CT_LOG_WARN("InputRecording: could not open '{}'.", filepath);
+
+        return false;
+    }
+
+    const std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    ByteReader reader{bytes.data(), bytes.size()};
+
+    std::uint32_t magic = 0;
+    std::uint32_t version = 0;
+
+    if (!reader.Read(magic) || !reader.Read(version) || magic != INPUT_RECORDING_MAGIC ||
+        version != INPUT_RECORDING_VERSION)
+    {
+        CT_LOG_WARN("InputRecording: '{}' is not an input recording of version {}.", filepath,
+                    INPUT_RECORDING_VERSION);
+
+        return false;
+    }
+
+    // Frames run to the end of the file. A crash can cut the last one short while it is being written; the frames
+    // before it are whole and still replay. An unknown event is damage, not a crash, so it refuses the file.
+    std::vector<InputFrame> frames;
+
+    while (!reader.IsAtEnd())
+    {
+        InputFrame frame;
+        std::uint16_t eventCount = 0;
+        bool isWhole = reader.Read(frame.dt) && reader.Read(eventCount);
+
+        if (isWhole)
+        {
+            frame.events.resize(eventCount);
+
+            for (TimedInputEvent &timed : frame.events)
+            {
+                if (!ReadEvent(reader, timed))
+                {
+                    isWhole = false;
+                    break;
+                }
+            }
+        }
+
+        if (isWhole)
+        {
+            frames.push_back(std::move(frame));
+            continue;
+        }
+
+        if (!reader.hasRunOut)
+        {
+            CT_LOG_WARN("InputRecording: '{}' has an unknown event in frame {}.", filepath, frames.size());
+
+            return false;
+        }
+
+        CT_LOG_WARN("InputRecording: '{}' ends inside frame {}, keeping the frames before it.", filepath,
+                    frames.size());
+        break;
+    }
+
+    m_frames = std::move(frames);
+
+    return true;
+}
+
+/// @brief Closes the file, as Close does.
+InputRecordingWriter::~InputRecordingWriter()
+{
+    Close();
+}
+
+/// @brief Creates or replaces a recording and writes its header. Frames are then appended as they are written.
+/// @param filepath recording to create or replace.
+/// @return false if the file cannot be created.
+bool InputRecordingWriter::Open(const std::string &filepath)
+{
+    Close();
+
+    m_out.open(filepath, std::ios::binary | std::ios::trunc);
+
+    if (!m_out.is_open())
+    {
+        CT_LOG_WARN("InputRecording: could not write '{}'.", filepath);
+
+        return false;
+    }
+
+    m_filepath = filepath;
+    m_frameCount = 0;
+    m_eventCount = 0;
+    m_byteCount = 0;
+    m_hasFailed = false;
+
+    m_bytes.clear();
+    Write(m_bytes, INPUT_RECORDING_MAGIC);
+    Write(m_bytes, INPUT_RECORDING_VERSION);
+
+    return Flush();
+}
+
+/// @brief Appends a frame from the InputManager's frame events, rebasing their stamps onto the frame start.
+/// @param dt frame delta, in seconds, as the frame's updates saw it.
+/// @param events InputManager::GetFrameEvents.
+/// @param frameStartMs InputManager::GetFrameStartMs.
+/// @return false if the recording is not open or the write failed.
+bool InputRecordingWriter::WriteFrame(float dt, const InputEventBuffer &events, double frameStartMs)
+{
+    if (!IsOpen())
+    {
+        return false;
+    }
+
+    m_eventCount += AppendFrame(m_bytes, dt, events.Size(), [&](std::size_t i) {
+        return TimedInputEvent{events[i].event, events[i].timeMs - frameStartMs};
+    });
+    ++m_frameCount;
+
+    return Flush();
+}
+
+/// @brief Appends a frame as is.
+/// @param frame frame whose event stamps are already offsets from its start.
+/// @return false if the recording is not open or the write failed.
+bool InputRecordingWriter::WriteFrame(const InputFrame &frame)
+{
+    if (!IsOpen())
+    {
+        return false;
+    }
+
+    m_eventCount += AppendFrame(m_bytes, frame.dt, frame.events.size(),
+                                [&](std::size_t i) -> const TimedInputEvent & { return frame.events[i]; });
+    ++m_frameCount;
+
+    return Flush();
+}
+
+/// @brief Closes the recording. Every frame is already on disk, so this only reports what was written.
+/// @return false if any write failed.
+bool InputRecordingWriter::Close()
+{
+    if (!m_out.is_open())
+    {
+        return !m_hasFailed;
+    }
+
+    m_out.close();
+
+    if (!m_hasFailed)
+    {
+        CT_LOG_INFO("InputRecording: saved {} frames, {} events ({} bytes) to '{}'.", m_frameCount, m_eventCount,
+                    m_byteCount, m_filepath);
+    }
+
+    return !m_hasFailed;
+}
+
+/// @brief Returns whether frames are being written.
+/// @return true / false
+bool InputRecordingWriter::IsOpen() const
+{
+    return m_out.is_open() && !m_hasFailed;
+}
+
+/// @brief Returns how many frames were written since Open.
+/// @return m_frameCount.
+std::size_t InputRecordingWriter::GetFrameCount() const
+{
+    return m_frameCount;
+}
+
+/// @brief Returns how many events were written since Open.
+/// @return m_eventCount.
+std::size_t InputRecordingWriter::GetEventCount() const
+{
+    return m_eventCount;
+}
+
+/// @brief Hands the pending bytes to the OS, so they survive the process crashing. One small write per frame is
+/// far below what a frame costs; a failed write stops the recording, keeping the frames before it.
+/// @return false if the write failed.
+bool InputRecordingWriter::Flush()
+{
+    m_out.write(reinterpret_cast<const char *>(m_bytes.data()), static_cast<std::streamsize>(m_bytes.size()));
+    m_out.flush();
+
+    if (!m_out)
+    {
+        CT_LOG_WARN("InputRecording: writing '{}' failed after {} frames.", m_filepath, m_frameCount);
+        m_hasFailed = true;
+        m_out.close();
+
+        return false;
+    }
+
+    m_byteCount += m_bytes.size();
+    m_bytes.clear();
+
+    return true;
+}
@@ -0,0 +1,97 @@
+// ============================================================================
+//  File        : InputRecording.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-23
+//  Description : Per frame input stream, frame delta plus the frame's input
+//                events, saved to and loaded from a compact binary file so a
+//                session can be replayed without a person at the keyboard.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include "InputEventBuffer.h"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/// @brief One recorded frame: how long it lasted and the input events polled during it.
+struct InputFrame
+{
+    float dt = 0.0f;
+
+    /// @brief Events oldest first; timeMs is the offset from the frame start, not an absolute time.
+    std::vector<TimedInputEvent> events;
+};
+
+// ============================================================================
+//  Class       : InputRecording
+//  Purpose     : Holds a recorded input stream and its file format.
+//
+//  Responsibilities:
+//      - Appends a frame from the InputManager's frame events
+//      - Hands frames back out by index, for a replay
+//      - Saves and loads the stream, one small record per event
+//      - Leaves writing a live session to InputRecordingWriter
+//
+// ============================================================================
+class InputRecording
+{
+  public:
+    void AddFrame(float dt, const InputEventBuffer &events, double frameStartMs);
+    void AddFrame(InputFrame frame);
+    void Clear();
+
+    std::size_t GetFrameCount() const;
+    std::size_t GetEventCount() const;
+    const InputFrame &GetFrame(std::size_t index) const;
+
+    bool SaveToFile(const std::string &filepath) const;
+    bool LoadFromFile(const std::string &filepath);
+
+  private:
+    std::vector<InputFrame> m_frames;
+};
+
+// ============================================================================
+//  Class       : InputRecordingWriter
+//  Purpose     : Writes a recording frame by frame while the session runs,
+//                so a crash keeps every frame played before it.
+//
+//  Responsibilities:
+//      - Creates the file and writes its header on Open
+//      - Appends and flushes each frame as it is written
+//      - Stops at the first failed write, keeping what was written
+//
+// ============================================================================
+class InputRecordingWriter
+{
+  public:
+    ~InputRecordingWriter();
+
+    bool Open(const std::string &filepath);
+    bool WriteFrame(float dt, const InputEventBuffer &events, double frameStartMs);
+    bool WriteFrame(const InputFrame &frame);
+    bool Close();
+
+    bool IsOpen() const;
+    std::size_t GetFrameCount() const;
+    std::size_t GetEventCount() const;
+
+  private:
+    bool Flush();
+
+  private:
+    std::ofstream m_out;
+    std::string m_filepath;
+    std::vector<std::uint8_t> m_bytes;
+    std::size_t m_frameCount = 0;
+    std::size_t m_eventCount = 0;
+    std::size_t m_byteCount = 0;
+    bool m_hasFailed = false;
+};
@@ -0,0 +1,156 @@
+// ============================================================================
+//  File        : MixKernels.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-15
+//  Description : Inner loops of the software mixer: accumulate 16 bit
+//                voices into a float mix and convert the mix back to 16 bit.
+//                SSE2 where the compiler targets it, scalar otherwise.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "MixKernels.h"
+#include <algorithm>
+#include <cmath>
+
+#if CT_MIX_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+/// @brief Largest and smallest 16 bit sample; the mix is kept in the same scale so conversion is a clamp.
+constexpr float SAMPLE_MAX = 32767.f;
+constexpr float SAMPLE_MIN = -32768.f;
+} // namespace
+
+/// @brief Adds an interleaved stereo source into an interleaved stereo mix.
+/// @param mix accumulated mix, 2 * frames floats.
+/// @param source 16 bit interleaved stereo samples, 2 * frames.
+/// @param frames frames to mix.
+/// @param gainLeft gain applied to the left channel.
+/// @param gainRight gain applied to the right channel.
+void MixStereo(float *mix, const std::int16_t *source, std::size_t frames, float gainLeft, float gainRight)
+{
+#if CT_MIX_SSE2
+    const __m128 gains = _mm_setr_ps(gainLeft, gainRight, gainLeft, gainRight);
+    std::size_t i = 0;
+
+    // Four frames (eight samples) per step: widen the 16 bit samples to 32 bit integers, then to floats.
+    for (; i + 4 <= frames; i += 4)
+    {
+        const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 2));
+        const __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+        const __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(packed, packed), 16);
+
+        float *out = mix + i * 2;
+        _mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_mul_ps(_mm_cvtepi32_ps(low), gains)));
+        _mm_storeu_ps(out + 4, _mm_add_ps(_mm_loadu_ps(out + 4), _mm_mul_ps(_mm_cvtepi32_ps(high), gains)));
+    }
+
+    MixStereoScalar(mix + i * 2, source + i * 2, frames - i, gainLeft, gainRight);
+#else
+    MixStereoScalar(mix, source, frames, gainLeft, gainRight);
+#endif
+}
+
+/// @brief Adds a mono source into both channels of an interleaved stereo mix.
+/// @param mix accumulated mix, 2 * frames floats.
+/// @param source 16 bit mono samples, one per frame.
+/// @param frames frames to mix.
+/// @param gainLeft gain applied to the left channel.
+/// @param gainRight gain applied to the right channel.
+void MixMonoToStereo(float *mix, const std::int16_t *source, std::size_t frames, float gainLeft, float gainRight)
+{
+#if CT_MIX_SSE2
+    const __m128 gains = _mm_setr_ps(gainLeft, gainRight, gainLeft, gainRight);
+    std::size_t i = 0;
+
+    // Four frames per step: duplicating each sample into a pair already yields interleaved left and right.
+    for (; i + 4 <= frames; i += 4)
+    {
+        const __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(source + i));
+        const __m128i widened = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+        const __m128 samples = _mm_cvtepi32_ps(widened);
+
+        const __m128 low = _mm_unpacklo_ps(samples, samples);
+        const __m128 high = _mm_unpackhi_ps(samples, samples);
+
+        float *out = mix + i * 2;
+        _mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_mul_ps(low, gains)));
+        _mm_storeu_ps(out + 4, _mm_add_ps(_mm_loadu_ps(out + 4), _mm_mul_ps(high, gains)));
+    }
+
+    MixMonoToStereoScalar(mix + i * 2, source + i, frames - i, gainLeft, gainRight);
+#else
+    MixMonoToStereoScalar(mix, source, frames, gainLeft, gainRight);
+#endif
+}
+
+/// @brief Converts the float mix to 16 bit samples, clipping anything louder than full scale.
+/// @param mix accumulated mix.
+/// @param output receives the 16 bit samples.
+/// @param samples number of samples (not frames).
+void ConvertToInt16(const float *mix, std::int16_t *output, std::size_t samples)
+{
+#if CT_MIX_SSE2
+    std::size_t i = 0;
+
+    // _mm_packs_epi32 saturates, so clipping comes for free.
+    for (; i + 8 <= samples; i += 8)
+    {
+        const __m128i low = _mm_cvtps_epi32(_mm_loadu_ps(mix + i));
+        const __m128i high = _mm_cvtps_epi32(_mm_loadu_ps(mix + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), _mm_packs_epi32(low, high));
+    }
+
+    ConvertToInt16Scalar(mix + i, output + i, samples - i);
+#else
+    ConvertToInt16Scalar(mix, output, samples);
+#endif
+}
+
+/// @brief Portable version of MixStereo, also used for the tail the SIMD loop leaves over.
+/// @param mix accumulated mix, 2 * frames floats.
+/// @param source 16 bit interleaved stereo samples, 2 * frames.
+/// @param frames frames to mix.
+/// @param gainLeft gain applied to the left channel.
+/// @param gainRight gain applied to the right channel.
+void MixStereoScalar(float *mix, const std::int16_t *source, std::size_t frames, float gainLeft, float gainRight)
+{
+    for (std::size_t i = 0; i < frames; ++i)
+    {
+        mix[i * 2] += source[i * 2] * gainLeft;
+        mix[i * 2 + 1] += source[i * 2 + 1] * gainRight;
+    }
+}
+
+/// @brief Portable version of MixMonoToStereo, also used for the tail the SIMD loop leaves over.
+/// @param mix accumulated mix, 2 * frames floats.
+/// @param source 16 bit mono samples, one per frame.
+/// @param frames frames to mix.
+/// @param gainLeft gain applied to the left channel.
+/// @param gainRight gain applied to the right channel.
+void MixMonoToStereoScalar(float *mix, const std::int16_t *source, std::size_t frames, float gainLeft,
+                           float gainRight)
+{
+    for (std::size_t i = 0; i < frames; ++i)
+    {
+        mix[i * 2] += source[i] * gainLeft;
+        mix[i * 2 + 1] += source[i] * gainRight;
+    }
+}
+
+/// @brief Portable version of ConvertToInt16, also used for the tail the SIMD loop leaves over.
+/// @param mix accumulated mix.
+/// @param output receives the 16 bit samples.
+/// @param samples number of samples (not frames).
+void ConvertToInt16Scalar(const float *mix, std::int16_t *output, std::size_t samples)
+{
+    for (std::size_t i = 0; i < samples; ++i)
+    {
+        output[i] = static_cast<std::int16_t>(std::lrint(std::clamp(mix[i], SAMPLE_MIN, SAMPLE_MAX)));
+    }
+}
@@ -0,0 +1,32 @@
+// ============================================================================
+//  File        : MixKernels.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-15
+//  Description : Inner loops of the software mixer: accumulate 16 bit
+//                voices into a float mix and convert the mix back to 16 bit.
+//                SSE2 where the compiler targets it, scalar otherwise.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CT_MIX_SSE2 1
+#else
+#define CT_MIX_SSE2 0
+#endif
+
+void MixStereo(float *mix, const std::int16_t *source, std::size_t frames, float gainLeft, float gainRight);
+void MixMonoToStereo(float *mix, const std::int16_t *source, std::size_t frames, float gainLeft, float gainRight);
+void ConvertToInt16(const float *mix, std::int16_t *output, std::size_t samples);
+
+void MixStereoScalar(float *mix, const std::int16_t *source, std::size_t frames, float gainLeft, float gainRight);
+void MixMonoToStereoScalar(float *mix, const std::int16_t *source, std::size_t frames, float gainLeft,
+                           float gainRight);
+void ConvertToInt16Scalar(const float *mix, std::int16_t *output, std::size_t samples);
@@ -0,0 +1,487 @@
+// ============================================================================
+//  File        : MusicDeck.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-14
+//  Description : One of the two music players the AudioManager crossfades
+//                between, with its own gain and sample exact loop points.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "MusicDeck.h"
+#include "AudioImporter.h"
+#include "Macros.h"
+#include "MixKernels.h"
+#include <algorithm>
+
+namespace
+{
+/// @brief Frames handed to OpenAL per streaming buffer. SFML queues three buffers, so about 70 ms at 44.1 kHz stand
+/// between applying a gain and hearing it, instead of the three seconds sf::Music queues on its own.
+constexpr std::size_t CHUNK_FRAMES = 1024;
+
+/// @brief Buffers SFML keeps queued ahead of the playing position.
+constexpr std::size_t QUEUED_CHUNKS = 3;
+
+/// @brief Converts a frame index to the time SFML converts back to that same frame. SFML rounds time to the nearest
+/// sample, and a microsecond is finer than one sample at any supported rate.
+/// @param frame sample frame.
+/// @param sampleRate frames per second.
+/// @return time of the frame.
+sf::Time FrameToTime(std::uint64_t frame, unsigned int sampleRate)
+{
+    return sf::microseconds(static_cast<sf::Int64>((frame * 1000000 + sampleRate / 2) / sampleRate));
+}
+} // namespace
+
+/// @brief Jumps to a gain; samples already queued keep the gain they were decoded with.
+/// @param gain 0 to 1.
+void EnvelopedMusic::SetGain(float gain)
+{
+    std::lock_guard<std::mutex> lock(m_envelopeMutex);
+    m_envelope.Set(gain);
+}
+
+/// @brief Ramps from the current gain to a new one over an exact number of sample frames.
+/// @param gain 0 to 1.
+/// @param seconds ramp length.
+/// @param curve ramp shape.
+void EnvelopedMusic::FadeTo(float gain, float seconds, EnvelopeCurve curve)
+{
+    const double frames = static_cast<double>(std::max(0.f, seconds)) * getSampleRate();
+
+    std::lock_guard<std::mutex> lock(m_envelopeMutex);
+    m_envelope.Start(gain, frames, curve);
+}
+
+/// @brief Returns the gain of the frames being decoded now.
+/// @return gain, 0 to 1.
+float EnvelopedMusic::GetGain() const
+{
+    std::lock_guard<std::mutex> lock(m_envelopeMutex);
+
+    return m_envelope.GetGain();
+}
+
+/// @brief Returns whether a fade is still being heard: its last frame has not left the queue, and the stream has not
+/// stopped. A paused stream holds its fade where it is. Offline, the owner tracks the play status, and only the part
+/// of the last chunk not rendered yet stands between the envelope and the mix.
+/// @return true / false
+bool EnvelopedMusic::IsFading() const
+{
+    std::lock_guard<std::mutex> lock(m_envelopeMutex);
+
+    if (m_isOffline)
+    {
+        return !m_envelope.IsDone(static_cast<double>(m_chunkFrames - m_chunkOffset));
+    }
+
+    return getStatus() != sf::Music::Stopped &&
+           !m_envelope.IsDone(static_cast<double>(QUEUED_CHUNKS * CHUNK_FRAMES));
+}
+
+/// @brief Hands out the next short chunk of decoded audio, scaled by the envelope. Runs on the SFML streaming thread.
+/// sf::Music decodes a second at a time; that block is split here, and the next one only decoded once it is used up,
+/// so sf::Music sees its own reads and loop seeks in their usual order.
+/// @param data receives the chunk.
+/// @return false once the track, or the current loop, has no more samples.
+bool EnvelopedMusic::onGetData(Chunk &data)
+{
+    if (m_sourceOffset >= m_sourceCount)
+    {
+        Chunk source;
+        m_hasMoreSource = sf::Music::onGetData(source);
+        m_source = source.samples;
+        m_sourceCount = source.sampleCount;
+        m_sourceOffset = 0;
+    }
+
+    const unsigned int channels = std::max(1u, getChannelCount());
+    const std::size_t count = std::min(m_sourceCount - m_sourceOffset, CHUNK_FRAMES * channels);
+
+    m_output.assign(m_source + m_sourceOffset, m_source + m_sourceOffset + count);
+    m_sourceOffset += count;
+
+    {
+        std::lock_guard<std::mutex> lock(m_envelopeMutex);
+        m_envelope.Apply(m_output.data(), count / channels, channels);
+    }
+
+    data.samples = m_output.data();
+    data.sampleCount = count;
+
+    if (m_sourceOffset < m_sourceCount)
+    {
+        return true;
+    }
+
+    // The block is used up: report its end, and decode a fresh one next time, whether or not sf::Music is done.
+    const bool hasMore = m_hasMoreSource;
+    m_hasMoreSource = true;
+
+    return hasMore;
+}
+
+/// @brief Drops the undelivered rest of the decoded block before seeking. The envelope keeps its position, so a seek
+/// or loop does not restart a fade.
+/// @param timeOffset new playing position.
+void EnvelopedMusic::onSeek(sf::Time timeOffset)
+{
+    m_sourceCount = 0;
+    m_sourceOffset = 0;
+    m_hasMoreSource = true;
+
+    m_chunkFrames = 0;
+    m_chunkOffset = 0;
+    m_isChunkLast = false;
+
+    sf::Music::onSeek(timeOffset);
+}
+
+/// @brief Switches between playing through OpenAL and being rendered with Render. Stops and rewinds the stream first,
+/// so its thread never reads alongside Render.
+/// @param isOffline true to render on demand.
+void EnvelopedMusic::SetOffline(bool isOffline)
+{
+    stop();
+
+    std::lock_guard<std::mutex> lock(m_envelopeMutex);
+    m_isOffline = isOffline;
+}
+
+/// @brief Offline only: pulls the next frames through onGetData, exactly as the streaming thread would, and adds them
+/// to a stereo mix. Once the last chunk of the track or loop region is used up it loops the way the stream does.
+/// @param mix frames * 2 interleaved stereo samples, added to.
+/// @param frames frames wanted.
+/// @param volume gain applied on top of the envelope.
+/// @return frames rendered; fewer than asked once a track that does not loop has ended.
+std::size_t EnvelopedMusic::Render(float *mix, std::size_t frames, float volume)
+{
+    const unsigned int channels = getChannelCount();
+    std::size_t rendered = 0;
+
+    while (rendered < frames)
+    {
+        if (m_chunkOffset >= m_chunkFrames)
+        {
+            if (m_isChunkLast && onLoop() == NoLoop)
+            {
+                return rendered;
+            }
+
+            Chunk chunk;
+            m_isChunkLast = !onGetData(chunk);
+            m_chunk = chunk.samples;
+            m_chunkFrames = chunk.sampleCount / channels;
+            m_chunkOffset = 0;
+
+            // Only an empty track, or a seek to its very end, reads nothing.
+            if (m_chunkFrames == 0)
+            {
+                return rendered;
+            }
+        }
+
+        const std::size_t count = std::min(frames - rendered, m_chunkFrames - m_chunkOffset);
+        const sf::Int16 *source = m_chunk + m_chunkOffset * channels;
+
+        if (channels == 1)
+        {
+            MixMonoToStereo(mix + rendered * 2, source, count, volume, volume);
+        }
+        else
+        {
+            MixStereo(mix + rendered * 2, source, count, volume, volume);
+        }
+
+        m_chunkOffset += count;
+        rendered += count;
+    }
+
+    return rendered;
+}
+
+/// @brief Opens a track without starting it, replacing whatever the deck held. A WAV name is transparently swapped
+/// for its imported OGG version when one is up to date.
+/// @param filename music file to stream.
+/// @return true / false
+bool MusicDeck::Open(const std::string &filename)
+{
+    Close();
+
+    const std::string source = AudioImporter::ResolveSource(filename);
+
+    if (!m_music.openFromFile(source))
+    {
+        CT_LOG_WARN("Failed to open music file: {}", source);
+
+        return false;
+    }
+
+    m_track = filename;
+    m_isOpen = true;
+
+    return true;
+}
+
+/// @brief Stops the deck and forgets its track.
+void MusicDeck::Close()
+{
+    m_music.stop();
+    m_offlineStatus = sf::SoundSource::Stopped;
+    m_track.clear();
+    m_isOpen = false;
+    m_isPrimed = false;
+}
+
+/// @brief Returns whether a track is open.
+/// @return m_isOpen.
+bool MusicDeck::IsOpen() const
+{
+    return m_isOpen;
+}
+
+/// @brief Returns the name the open track was requested with.
+/// @return m_track, empty when closed.
+const std::string &MusicDeck::GetTrack() const
+{
+    return m_track;
+}
+
+/// @brief Fills the stream's first buffers without making a sound: the track is started silently, paused, and rewound
+/// to its start. SFML refills the queue as part of the rewind, so the next Play has audio ready immediately. The
+/// buffers are filled at zero gain, ready for the fade in a prepared track usually starts with. Offline there are no
+/// buffers to fill; the deck is only marked primed, at zero gain.
+void MusicDeck::Prime()
+{
+    if (!m_isOpen || GetStatus() != sf::SoundSource::Stopped)
+    {
+        return;
+    }
+
+    m_music.SetGain(0.f);
+
+    if (m_isOffline)
+    {
+        m_isPrimed = true;
+
+        return;
+    }
+
+    m_music.setVolume(0.f);
+    m_music.play();
+    m_music.pause();
+    m_music.setPlayingOffset(sf::Time::Zero);
+    m_music.setVolume(m_volume);
+
+    m_isPrimed = true;
+}
+
+/// @brief Returns whether the deck holds a primed track that has not started yet.
+/// @return m_isPrimed.
+bool MusicDeck::IsPrimed() const
+{
+    return m_isPrimed;
+}
+
+/// @brief Sets whether the track loops, over its loop points when set.
+/// @param loop true / false
+void MusicDeck::SetLoop(bool loop)
+{
+    m_music.setLoop(loop);
+}
+
+/// @brief Limits looping to a region of the track.
+/// @param points loop region in sample frames.
+/// @return false if no track is open or the region is empty.
+bool MusicDeck::SetLoopPoints(const MusicLoopPoints &points)
+{
+    if (!m_isOpen)
+    {
+        return false;
+    }
+
+    const unsigned int sampleRate = m_music.getSampleRate();
+    const std::uint64_t trackFrames = m_music.getDuration().asMicroseconds() * sampleRate / 1000000;
+    const std::uint64_t endFrame = points.endFrame == 0 ? trackFrames : std::min(points.endFrame, trackFrames);
+
+    if (sampleRate == 0 || points.startFrame >= endFrame)
+    {
+        return false;
+    }
+
+    m_music.setLoopPoints(sf::Music::TimeSpan(FrameToTime(points.startFrame, sampleRate),
+                                              FrameToTime(endFrame - points.startFrame, sampleRate)));
+
+    return true;
+}
+
+/// @brief Starts, or restarts, the open track. A primed track resumes from its already filled buffers, unless it
+/// starts audible; those buffers are silent, so it is rewound to refill them at the current gain first.
+void MusicDeck::Play()
+{
+    if (m_isOpen && m_isOffline)
+    {
+        m_isPrimed = false;
+        m_offlineStatus = sf::SoundSource::Playing;
+    }
+    else if (m_isOpen)
+    {
+        if (m_isPrimed && m_music.GetGain() > 0.f)
+        {
+            m_music.setPlayingOffset(sf::Time::Zero);
+        }
+
+        m_isPrimed = false;
+        m_music.play();
+    }
+}
+
+/// @brief Stops the track and rewinds it; the track stays open.
+void MusicDeck::Stop()
+{
+    m_isPrimed = false;
+    m_music.stop();
+    m_offlineStatus = sf::SoundSource::Stopped;
+}
+
+/// @brief Pauses the track if it is playing.
+void MusicDeck::Pause()
+{
+    if (IsPlaying() && m_isOffline)
+    {
+        m_offlineStatus = sf::SoundSource::Paused;
+    }
+    else if (IsPlaying())
+    {
+        m_music.pause();
+    }
+}
+
+/// @brief Resumes the track if it is paused.
+void MusicDeck::Resume()
+{
+    if (IsPaused() && m_isOffline)
+    {
+        m_offlineStatus = sf::SoundSource::Playing;
+    }
+    else if (IsPaused())
+    {
+        m_music.play();
+    }
+}
+
+/// @brief Returns whether the track is playing.
+/// @return true / false
+bool MusicDeck::IsPlaying() const
+{
+    return GetStatus() == sf::SoundSource::Playing;
+}
+
+/// @brief Returns whether the track was paused by Pause. A primed track is held paused too, but is not reported.
+/// @return true / false
+bool MusicDeck::IsPaused() const
+{
+    return !m_isPrimed && GetStatus() == sf::SoundSource::Paused;
+}
+
+/// @brief Sets the fade gain of this deck at once, cancelling any fade.
+/// @param gain 0 to 1.
+void MusicDeck::SetGain(float gain)
+{
+    m_music.SetGain(std::clamp(gain, 0.f, 1.f));
+}
+
+/// @brief Fades the deck gain from where it is now, sample exact, on the streaming thread.
+/// @param gain 0 to 1.
+/// @param seconds fade length.
+/// @param curve fade shape.
+void MusicDeck::FadeTo(float gain, float seconds, EnvelopeCurve curve)
+{
+    m_music.FadeTo(std::clamp(gain, 0.f, 1.f), seconds, curve);
+}
+
+/// @brief Returns the fade gain of this deck.
+/// @return gain, 0 to 1.
+float MusicDeck::GetGain() const
+{
+    return m_music.GetGain();
+}
+
+/// @brief Returns whether a fade started by FadeTo is still being heard.
+/// @return true / false
+bool MusicDeck::IsFading() const
+{
+    return (!m_isOffline || m_offlineStatus != sf::SoundSource::Stopped) && m_music.IsFading();
+}
+
+/// @brief Sets the music bus volume. The deck gain is applied to the samples, so the two combine without either
+/// overwriting the other.
+/// @param volume 0 to 100, already including master volume and mute.
+void MusicDeck::ApplyVolume(float volume)
+{
+    m_volume = volume;
+    m_music.setVolume(m_volume);
+}
+
+/// @brief Switches the deck between playing through the audio device and being rendered by a virtual clock. The deck
+/// is stopped and rewound either way; its track, loop points and gain are kept.
+/// @param isOffline true to render on demand with Render.
+void MusicDeck::SetOffline(bool isOffline)
+{
+    if (isOffline == m_isOffline)
+    {
+        return;
+    }
+
+    m_isPrimed = false;
+    m_offlineStatus = sf::SoundSource::Stopped;
+    m_isOffline = isOffline;
+    m_music.SetOffline(isOffline);
+}
+
+/// @brief Returns whether the deck is rendered offline.
+/// @return m_isOffline.
+bool MusicDeck::IsOffline() const
+{
+    return m_isOffline;
+}
+
+/// @brief Offline only: adds the next frames of a playing deck to a stereo mix, scaled by its fade and bus volume. The
+/// deck stops when a track that does not loop ends, as a stream would. A track at another rate cannot be rendered
+/// without resampling and is stopped instead.
+/// @param mix frames * 2 interleaved stereo samples, added to.
+/// @param frames frames to render.
+/// @param sampleRate rate of the mix.
+void MusicDeck::Render(float *mix, std::size_t frames, unsigned int sampleRate)
+{
+    if (!m_isOffline || GetStatus() != sf::SoundSource::Playing)
+    {
+        return;
+    }
+
+    const unsigned int channels = m_music.getChannelCount();
+
+    if (m_music.getSampleRate() != sampleRate || (channels != 1 && channels != 2))
+    {
+        CT_LOG_WARN("MusicDeck: cannot render '{}' ({} channels at {} Hz) into a {} Hz mix, stopped.", m_track,
+                    channels, m_music.getSampleRate(), sampleRate);
+        Stop();
+
+        return;
+    }
+
+    if (m_music.Render(mix, frames, m_volume / 100.f) < frames)
+    {
+        Stop();
+    }
+}
+
+/// @brief Returns the play status, from the stream or, offline, from the deck itself.
+/// @return Stopped, Paused or Playing.
+sf::SoundSource::Status MusicDeck::GetStatus() const
+{
+    return m_isOffline ? m_offlineStatus : m_music.getStatus();
+}
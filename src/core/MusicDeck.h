@@ -0,0 +1,137 @@
+// ============================================================================
+//  File        : MusicDeck.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-14
+//  Description : One of the two music players the AudioManager crossfades
+//                between, with its own gain and sample exact loop points.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include "AudioEnvelope.h"
+#include <SFML/Audio.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// @brief Loop region of a track in sample frames, so a loop lands on the exact sample whatever the rate.
+struct MusicLoopPoints
+{
+    std::uint64_t startFrame = 0;
+
+    /// @brief One past the last frame of the loop, 0 for the end of the track.
+    std::uint64_t endFrame = 0;
+};
+
+// ============================================================================
+//  Class       : EnvelopedMusic
+//  Purpose     : sf::Music whose samples are scaled by a gain envelope on
+//                the streaming thread, one gain per sample frame.
+//
+//  Responsibilities:
+//      - Hands decoded audio to OpenAL in short chunks, so a new fade is
+//        heard a few tens of milliseconds after it starts
+//      - Applies the envelope to every frame it hands out
+//      - Reports a fade as done once its last frame has been played
+//      - Renders into a caller's mix instead of OpenAL when offline
+//
+// ============================================================================
+class EnvelopedMusic : public sf::Music
+{
+  public:
+    void SetGain(float gain);
+    void FadeTo(float gain, float seconds, EnvelopeCurve curve);
+    float GetGain() const;
+    bool IsFading() const;
+
+    void SetOffline(bool isOffline);
+    std::size_t Render(float *mix, std::size_t frames, float volume);
+
+  protected:
+    bool onGetData(Chunk &data) override;
+    void onSeek(sf::Time timeOffset) override;
+
+  private:
+    mutable std::mutex m_envelopeMutex;
+    AudioEnvelope m_envelope;
+
+    /// @brief Samples decoded by sf::Music and not handed out yet.
+    const sf::Int16 *m_source = nullptr;
+    std::size_t m_sourceCount = 0;
+    std::size_t m_sourceOffset = 0;
+    bool m_hasMoreSource = true;
+
+    std::vector<sf::Int16> m_output;
+
+    /// @brief Offline only: the chunk being rendered, in frames, and whether it was the last before a loop or the end.
+    bool m_isOffline = false;
+    const sf::Int16 *m_chunk = nullptr;
+    std::size_t m_chunkFrames = 0;
+    std::size_t m_chunkOffset = 0;
+    bool m_isChunkLast = false;
+};
+
+// ============================================================================
+//  Class       : MusicDeck
+//  Purpose     : Streams one music track and scales it by a deck gain, so
+//                two decks can overlap during a crossfade.
+//
+//  Responsibilities:
+//      - Opens a track ahead of time, without starting it
+//      - Primes the stream buffers so a prepared track starts at once
+//      - Applies loop points given in sample frames
+//      - Fades its own gain at sample accuracy, apart from the bus volume
+//      - Plays offline, rendered on demand by a virtual clock, when asked
+//
+// ============================================================================
+class MusicDeck
+{
+  public:
+    bool Open(const std::string &filename);
+    void Close();
+    bool IsOpen() const;
+    const std::string &GetTrack() const;
+    void Prime();
+    bool IsPrimed() const;
+
+    void SetLoop(bool loop);
+    bool SetLoopPoints(const MusicLoopPoints &points);
+
+    void Play();
+    void Stop();
+    void Pause();
+    void Resume();
+    bool IsPlaying() const;
+    bool IsPaused() const;
+
+    void SetGain(float gain);
+    void FadeTo(float gain, float seconds, EnvelopeCurve curve);
+    float GetGain() const;
+    bool IsFading() const;
+    void ApplyVolume(float volume);
+
+    void SetOffline(bool isOffline);
+    bool IsOffline() const;
+    void Render(float *mix, std::size_t frames, unsigned int sampleRate);
+
+  private:
+    sf::SoundSource::Status GetStatus() const;
+
+  private:
+    EnvelopedMusic m_music;
+    std::string m_track;
+
+    float m_volume = 100.f;
+    bool m_isOpen = false;
+    bool m_isPrimed = false;
+
+    /// @brief Offline the stream never plays; the deck keeps its own status and Render pulls the samples.
+    bool m_isOffline = false;
+    sf::SoundSource::Status m_offlineStatus = sf::SoundSource::Stopped;
+};
@@ -32,6 +32,7 @@ struct Settings
     float m_musicVolume = 100.0f;
     float m_sfxVolume = 100.0f;
     bool m_isMuted = false;
+    bool m_useSoftwareMixer = false;
 
     GameDifficultySetting m_gameDifficulty = GameDifficultySetting::Normal;
 
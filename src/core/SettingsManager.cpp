@@ -105,7 +105,8 @@ bool SettingsManager::IsDifferentFrom(const Settings &other) const
            m_settings->m_verticleSyncEnabled != other.m_verticleSyncEnabled ||
            m_settings->m_isFullscreen != other.m_isFullscreen || m_settings->m_masterVolume != other.m_masterVolume ||
            m_settings->m_musicVolume != other.m_musicVolume || m_settings->m_sfxVolume != other.m_sfxVolume ||
-           m_settings->m_isMuted != other.m_isMuted || m_settings->m_gameDifficulty != other.m_gameDifficulty ||
+           m_settings->m_isMuted != other.m_isMuted || m_settings->m_useSoftwareMixer != other.m_useSoftwareMixer ||
+           m_settings->m_gameDifficulty != other.m_gameDifficulty ||
            m_settings->m_audioDirectory != other.m_audioDirectory ||
            m_settings->m_fontDirectory != other.m_fontDirectory ||
            m_settings->m_spriteDirectory != other.m_spriteDirectory || m_settings->m_keyBindings != other.m_keyBindings;
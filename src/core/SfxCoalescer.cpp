@@ -0,0 +1,121 @@
+// ============================================================================
+//  File        : SfxCoalescer.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-13
+//  Description : Gathers PlaySFX requests over a frame and merges identical
+//                ones, so a volley of shots starts one louder voice instead
+//                of dozens of phased copies.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "SfxCoalescer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+/// @brief Requests for a sound this soon after it started are merged into it, whatever its own interval.
+constexpr float DEFAULT_WINDOW_MS = 10.f;
+
+/// @brief Upper bound of the merged gain, about +6 dB; a big volley should read as louder, not as a spike.
+constexpr float MAX_COALESCED_GAIN = 2.f;
+} // namespace
+
+/// @brief Constructor for the SfxCoalescer.
+SfxCoalescer::SfxCoalescer() : m_windowMs(DEFAULT_WINDOW_MS)
+{
+}
+
+/// @brief Sets the interval under which every sound merges into its previous start.
+/// @param windowMs interval in milliseconds, 0 to only merge within a frame.
+void SfxCoalescer::SetWindowMs(float windowMs)
+{
+    m_windowMs = std::max(0.f, windowMs);
+}
+
+/// @brief Returns the interval under which every sound merges into its previous start.
+/// @return m_windowMs.
+float SfxCoalescer::GetWindowMs() const
+{
+    return m_windowMs;
+}
+
+/// @brief Records one PlaySFX call. Calls for a sound already queued this frame only bump its count.
+/// @param id AssetId the sound was requested with.
+/// @param buffer loaded sound buffer.
+void SfxCoalescer::Queue(AssetId id, const sf::SoundBuffer &buffer)
+{
+    for (auto &request : m_pending)
+    {
+        if (request.id == id)
+        {
+            ++request.count;
+
+            return;
+        }
+    }
+
+    m_pending.push_back({id, &buffer, 1, false});
+}
+
+/// @brief Hands out the requests gathered since the last flush, one per sound, in the order they were first queued.
+/// @param nowMs current time in milliseconds, on any monotonic clock.
+/// @param params per sound retrigger intervals; sounds without an entry use the window alone.
+/// @return requests to play, valid until the next Flush.
+const std::vector<SfxRequest> &SfxCoalescer::Flush(double nowMs, const std::unordered_map<AssetId, SfxParams> &params)
+{
+    m_ready.clear();
+    m_ready.swap(m_pending);
+
+    for (auto &request : m_ready)
+    {
+        auto paramIt = params.find(request.id);
+        const float intervalMs = std::max(m_windowMs, paramIt == params.end() ? 0.f : paramIt->second.minRetriggerMs);
+
+        auto lastIt = m_lastStartMs.find(request.id);
+        request.isRetrigger = lastIt != m_lastStartMs.end() && nowMs - lastIt->second < intervalMs;
+
+        if (!request.isRetrigger)
+        {
+            m_lastStartMs[request.id] = nowMs;
+        }
+
+        m_mergedCount += request.isRetrigger ? request.count : request.count - 1;
+    }
+
+    return m_ready;
+}
+
+/// @brief Drops every queued request and forgets when sounds last started.
+void SfxCoalescer::Clear()
+{
+    m_pending.clear();
+    m_ready.clear();
+    m_lastStartMs.clear();
+}
+
+/// @brief Returns how many distinct sounds are waiting for the next flush.
+/// @return m_pending.size().
+std::size_t SfxCoalescer::GetPendingCount() const
+{
+    return m_pending.size();
+}
+
+/// @brief Returns how many PlaySFX calls were folded into another voice instead of starting their own.
+/// @return m_mergedCount.
+std::size_t SfxCoalescer::GetMergedCount() const
+{
+    return m_mergedCount;
+}
+
+/// @brief Returns the gain of a voice standing in for count identical sounds: the square root of the count, which
+/// matches their summed power, capped so a volley cannot clip.
+/// @param count merged PlaySFX calls, at least 1.
+/// @return gain multiplier.
+float SfxCoalescer::GainFor(std::size_t count)
+{
+    return std::min(MAX_COALESCED_GAIN, std::sqrt(static_cast<float>(std::max<std::size_t>(1, count))));
+}
@@ -0,0 +1,73 @@
+// ============================================================================
+//  File        : SfxCoalescer.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-13
+//  Description : Gathers PlaySFX requests over a frame and merges identical
+//                ones, so a volley of shots starts one louder voice instead
+//                of dozens of phased copies.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include "AssetId.h"
+#include "SfxVoicePool.h"
+#include <SFML/Audio.hpp>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+/// @brief Every request for one sound gathered since the last flush.
+struct SfxRequest
+{
+    AssetId id;
+    const sf::SoundBuffer *buffer = nullptr;
+
+    /// @brief How many PlaySFX calls this request stands for.
+    std::size_t count = 0;
+
+    /// @brief True when the sound started less than its retrigger interval ago; the requests should be folded into
+    /// that voice rather than start a new one.
+    bool isRetrigger = false;
+};
+
+// ============================================================================
+//  Class       : SfxCoalescer
+//  Purpose     : Turns a frame's worth of PlaySFX calls into at most one
+//                request per sound.
+//
+//  Responsibilities:
+//      - Merges identical requests made within the same frame
+//      - Marks requests inside a sound's retrigger interval
+//      - Maps a merged request count to a voice gain
+//      - Counts the calls that did not get a voice of their own
+//
+// ============================================================================
+class SfxCoalescer
+{
+  public:
+    SfxCoalescer();
+
+    void SetWindowMs(float windowMs);
+    float GetWindowMs() const;
+
+    void Queue(AssetId id, const sf::SoundBuffer &buffer);
+    const std::vector<SfxRequest> &Flush(double nowMs, const std::unordered_map<AssetId, SfxParams> &params);
+    void Clear();
+
+    std::size_t GetPendingCount() const;
+    std::size_t GetMergedCount() const;
+
+    static float GainFor(std::size_t count);
+
+  private:
+    std::vector<SfxRequest> m_pending;
+    std::vector<SfxRequest> m_ready;
+    std::unordered_map<AssetId, double> m_lastStartMs;
+
+    float m_windowMs;
+    std::size_t m_mergedCount = 0;
+};
@@ -0,0 +1,327 @@
+// ============================================================================
+//  File        : SfxVoicePool.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-12
+//  Description : Fixed set of sound effect voices shared by every PlaySFX
+//                call, with per sound priority, per category limits and a
+//                stealing policy for when every voice is busy.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "SfxVoicePool.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+/// @brief Voices available when nothing else is configured; OpenAL guarantees far more sources than this.
+constexpr std::size_t DEFAULT_VOICE_COUNT = 16;
+
+/// @brief Weapon fire may hold at most this many voices by default, so a burst cannot starve everything else.
+constexpr std::size_t DEFAULT_WEAPON_LIMIT = 10;
+
+/// @brief Voices started within this many milliseconds of each other count as equally old.
+constexpr float AGE_TIE_MS = 20.f;
+
+/// @brief Category limit meaning "only bounded by the voice count".
+constexpr std::size_t NO_CATEGORY_LIMIT = std::numeric_limits<std::size_t>::max();
+
+/// @brief Returns whether voice a is a better steal victim than voice b: lower priority, then older, then quieter.
+/// @param a candidate voice.
+/// @param b current best victim.
+/// @return true / false
+bool IsBetterVictim(const SfxVoiceState &a, const SfxVoiceState &b)
+{
+    if (a.priority != b.priority)
+    {
+        return a.priority < b.priority;
+    }
+
+    if (std::abs(a.ageMs - b.ageMs) > AGE_TIE_MS)
+    {
+        return a.ageMs > b.ageMs;
+    }
+
+    return a.audibility < b.audibility;
+}
+} // namespace
+
+/// @brief Constructor for the SfxVoicePool.
+SfxVoicePool::SfxVoicePool() : m_voices(DEFAULT_VOICE_COUNT)
+{
+    m_categoryLimits.fill(NO_CATEGORY_LIMIT);
+    m_categoryLimits[static_cast<std::size_t>(SfxCategory::Weapon)] = DEFAULT_WEAPON_LIMIT;
+}
+
+/// @brief Resizes the pool. Voices past the new count are stopped, and their ids stop resolving in GetVoice; voices
+/// below it keep playing under the same id.
+/// @param count number of voices, at least 1.
+void SfxVoicePool::SetVoiceCount(std::size_t count)
+{
+    count = std::max<std::size_t>(1, count);
+
+    for (std::size_t i = count; i < m_voices.size(); ++i)
+    {
+        m_voices[i].sound.stop();
+    }
+
+    m_voices.resize(count);
+}
+
+/// @brief Returns how many voices the pool holds.
+/// @return m_voices.size().
+std::size_t SfxVoicePool::GetVoiceCount() const
+{
+    return m_voices.size();
+}
+
+/// @brief Caps how many voices one category may hold at once. At the cap, a new sound of that category can only
+/// steal from its own category.
+/// @param category category to limit.
+/// @param limit maximum concurrent voices, at least 1.
+void SfxVoicePool::SetCategoryLimit(SfxCategory category, std::size_t limit)
+{
+    m_categoryLimits[static_cast<std::size_t>(category)] = std::max<std::size_t>(1, limit);
+}
+
+/// @brief Returns the cap of one category.
+/// @param category category to query.
+/// @return maximum concurrent voices.
+std::size_t SfxVoicePool::GetCategoryLimit(SfxCategory category) const
+{
+    return std::min(m_categoryLimits[static_cast<std::size_t>(category)], m_voices.size());
+}
+
+/// @brief Starts buffer on a free voice, or on the voice ChooseVoice is willing to steal.
+/// @param buffer loaded sound buffer.
+/// @param params priority and category of this sound.
+/// @param volume voice volume, 0 to 100.
+/// @return the voice now playing buffer, or INVALID_VOICE if every candidate was more important.
+SfxVoicePool::VoiceId SfxVoicePool::Play(const sf::SoundBuffer &buffer, const SfxParams &params, float volume)
+{
+    const int index = ChooseVoice(CaptureStates(buffer), params, GetCategoryLimit(params.category));
+
+    if (index < 0)
+    {
+        ++m_rejectCount;
+
+        return INVALID_VOICE;
+    }
+
+    return Start(static_cast<std::size_t>(index), buffer, params, volume);
+}
+
+/// @brief Starts buffer only if ChooseVoice picks a free voice. Used to bring back a sound that lost its voice: it
+/// waits for one to free up rather than cutting off another sound, so it is neither counted as a steal nor a reject.
+/// @param buffer loaded sound buffer.
+/// @param params priority and category of this sound.
+/// @param volume voice volume, 0 to 100.
+/// @return the voice now playing buffer, or INVALID_VOICE if no free voice may take it.
+SfxVoicePool::VoiceId SfxVoicePool::PlayFree(const sf::SoundBuffer &buffer, const SfxParams &params, float volume)
+{
+    const std::vector<SfxVoiceState> states = CaptureStates(buffer);
+    const int index = ChooseVoice(states, params, GetCategoryLimit(params.category));
+
+    if (index < 0 || states[static_cast<std::size_t>(index)].isPlaying)
+    {
+        return INVALID_VOICE;
+    }
+
+    return Start(static_cast<std::size_t>(index), buffer, params, volume);
+}
+
+/// @brief Stops every voice.
+void SfxVoicePool::StopAll()
+{
+    for (auto &voice : m_voices)
+    {
+        voice.sound.stop();
+    }
+}
+
+/// @brief Returns the sound behind a voice id. Look it up on every use rather than keeping the pointer; a resize may
+/// move or remove it.
+/// @param voice id from Play or PlayFree.
+/// @return the voice, or nullptr if the id is invalid or past the voice count.
+sf::Sound *SfxVoicePool::GetVoice(VoiceId voice)
+{
+    return voice < m_voices.size() ? &m_voices[voice].sound : nullptr;
+}
+
+/// @brief Returns the sound behind a voice id.
+/// @param voice id from Play or PlayFree.
+/// @return the voice, or nullptr if the id is invalid or past the voice count.
+const sf::Sound *SfxVoicePool::GetVoice(VoiceId voice) const
+{
+    return voice < m_voices.size() ? &m_voices[voice].sound : nullptr;
+}
+
+/// @brief Returns how many voices are playing.
+/// @return playing voice count.
+std::size_t SfxVoicePool::GetActiveCount() const
+{
+    return static_cast<std::size_t>(std::count_if(m_voices.begin(), m_voices.end(), [](const Voice &voice)
+                                                  { return voice.sound.getStatus() != sf::Sound::Stopped; }));
+}
+
+/// @brief Returns how many voices of one category are playing.
+/// @param category category to count.
+/// @return playing voice count.
+std::size_t SfxVoicePool::GetActiveCount(SfxCategory category) const
+{
+    return static_cast<std::size_t>(
+        std::count_if(m_voices.begin(), m_voices.end(), [category](const Voice &voice)
+                      { return voice.params.category == category && voice.sound.getStatus() != sf::Sound::Stopped; }));
+}
+
+/// @brief Returns how many voices are playing one buffer.
+/// @param buffer buffer to count.
+/// @return playing voice count.
+std::size_t SfxVoicePool::GetActiveCount(const sf::SoundBuffer &buffer) const
+{
+    return static_cast<std::size_t>(
+        std::count_if(m_voices.begin(), m_voices.end(), [&buffer](const Voice &voice)
+                      { return voice.sound.getBuffer() == &buffer && voice.sound.getStatus() != sf::Sound::Stopped; }));
+}
+
+/// @brief Returns how many playing voices were cut short for a new sound.
+/// @return m_stealCount.
+std::size_t SfxVoicePool::GetStealCount() const
+{
+    return m_stealCount;
+}
+
+/// @brief Returns how many sounds were dropped because every candidate voice was more important.
+/// @return m_rejectCount.
+std::size_t SfxVoicePool::GetRejectCount() const
+{
+    return m_rejectCount;
+}
+
+/// @brief Picks the voice for a new sound. A sound at its instance limit restarts its own oldest voice. Otherwise a
+/// free voice wins, unless the sound's category is at its limit; failing that the best victim among voices of no
+/// higher priority is stolen.
+/// @param voices state of every voice.
+/// @param params priority and category of the new sound.
+/// @param categoryLimit cap of the new sound's category.
+/// @return voice index, or -1 to reject the sound.
+int SfxVoicePool::ChooseVoice(const std::vector<SfxVoiceState> &voices, const SfxParams &params,
+                              std::size_t categoryLimit)
+{
+    const auto instances = static_cast<std::size_t>(std::count_if(
+        voices.begin(), voices.end(), [](const SfxVoiceState &voice) { return voice.isPlaying && voice.isSameSound; }));
+
+    if (params.maxInstances > 0 && instances >= params.maxInstances)
+    {
+        int oldest = -1;
+
+        for (std::size_t i = 0; i < voices.size(); ++i)
+        {
+            if (voices[i].isPlaying && voices[i].isSameSound &&
+                (oldest < 0 || voices[i].ageMs > voices[static_cast<std::size_t>(oldest)].ageMs))
+            {
+                oldest = static_cast<int>(i);
+            }
+        }
+
+        return oldest;
+    }
+
+    const auto inCategory = static_cast<std::size_t>(
+        std::count_if(voices.begin(), voices.end(), [&params](const SfxVoiceState &voice)
+                      { return voice.isPlaying && voice.category == params.category; }));
+
+    const bool isCategoryFull = inCategory >= categoryLimit;
+
+    if (!isCategoryFull)
+    {
+        for (std::size_t i = 0; i < voices.size(); ++i)
+        {
+            if (!voices[i].isPlaying)
+            {
+                return static_cast<int>(i);
+            }
+        }
+    }
+
+    int victim = -1;
+
+    for (std::size_t i = 0; i < voices.size(); ++i)
+    {
+        const SfxVoiceState &voice = voices[i];
+
+        if (!voice.isPlaying || voice.priority > params.priority)
+        {
+            continue;
+        }
+
+        if (isCategoryFull && voice.category != params.category)
+        {
+            continue;
+        }
+
+        if (victim < 0 || IsBetterVictim(voice, voices[static_cast<std::size_t>(victim)]))
+        {
+            victim = static_cast<int>(i);
+        }
+    }
+
+    return victim;
+}
+
+/// @brief Reads the state of every voice for ChooseVoice.
+/// @param buffer buffer of the sound being placed.
+/// @return one state per voice, in voice order.
+std::vector<SfxVoiceState> SfxVoicePool::CaptureStates(const sf::SoundBuffer &buffer) const
+{
+    std::vector<SfxVoiceState> states(m_voices.size());
+
+    for (std::size_t i = 0; i < m_voices.size(); ++i)
+    {
+        const Voice &voice = m_voices[i];
+        SfxVoiceState &state = states[i];
+
+        state.isPlaying = voice.sound.getStatus() != sf::Sound::Stopped;
+        state.priority = voice.params.priority;
+        state.category = voice.params.category;
+        state.isSameSound = voice.sound.getBuffer() == &buffer;
+        state.ageMs = static_cast<float>(voice.sound.getPlayingOffset().asMilliseconds());
+        state.audibility = voice.sound.getVolume() / 100.f;
+    }
+
+    return states;
+}
+
+/// @brief Starts buffer on one voice, stopping what it played.
+/// @param index voice to use.
+/// @param buffer loaded sound buffer.
+/// @param params priority and category of this sound.
+/// @param volume voice volume, 0 to 100.
+/// @return index.
+SfxVoicePool::VoiceId SfxVoicePool::Start(std::size_t index, const sf::SoundBuffer &buffer, const SfxParams &params, float volume)
+{
+    Voice &voice = m_voices[index];
+
+    if (voice.sound.getStatus() != sf::Sound::Stopped)
+    {
+        voice.sound.stop();
+        ++m_stealCount;
+    }
+
+    voice.params = params;
+    voice.sound.setBuffer(buffer);
+    voice.sound.setVolume(volume);
+
+    // Centered on the listener at normal pitch; a positional sound pans the voice, and an audio event pitches it,
+    // after it starts.
+    voice.sound.setRelativeToListener(true);
+    voice.sound.setPosition(0.f, 0.f, 0.f);
+    voice.sound.setPitch(1.f);
+    voice.sound.play();
+
+    return index;
+}
@@ -0,0 +1,132 @@
+// ============================================================================
+//  File        : SfxVoicePool.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-12
+//  Description : Fixed set of sound effect voices shared by every PlaySFX
+//                call, with per sound priority, per category limits and a
+//                stealing policy for when every voice is busy.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include "SpatialAudio.h"
+#include <SFML/Audio.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/// @brief Groups sound effects so each group can be limited on its own.
+enum class SfxCategory : std::uint8_t
+{
+    Default,
+    UI,
+    Weapon,
+    Explosion,
+    Count
+};
+
+/// @brief How a sound effect competes for a voice. Higher priorities steal from lower ones, never the reverse.
+struct SfxParams
+{
+    int priority = 0;
+    SfxCategory category = SfxCategory::Default;
+
+    /// @brief Most voices this sound may hold at once, 0 for no limit. At the limit its oldest voice restarts.
+    std::size_t maxInstances = 0;
+
+    /// @brief Requests this soon after the sound started are merged into that voice instead of starting a new one.
+    float minRetriggerMs = 0.f;
+
+    /// @brief Distance falloff when the sound is played at a position.
+    SfxAttenuation attenuation{};
+};
+
+/// @brief What the stealing policy needs to know about one voice.
+struct SfxVoiceState
+{
+    bool isPlaying = false;
+    int priority = 0;
+    SfxCategory category = SfxCategory::Default;
+
+    /// @brief True when the voice plays the same buffer as the sound being placed.
+    bool isSameSound = false;
+
+    /// @brief Time since the voice started, in milliseconds.
+    float ageMs = 0.f;
+
+    /// @brief Current volume, 0 to 1.
+    float audibility = 0.f;
+};
+
+// ============================================================================
+//  Class       : SfxVoicePool
+//  Purpose     : Owns the sf::Sound voices used for sound effects and decides
+//                which one a new sound effect gets.
+//
+//  Responsibilities:
+//      - Prefers free voices
+//      - Steals by lowest priority, then oldest, then quietest
+//      - Caps how many voices each category, and each sound, may hold
+//      - Rejects sounds that would only steal from more important ones
+//      - Resumes sounds on free voices only, never stealing for them
+//      - Counts steals and rejections
+//      - Hands out voices by index, so a resize never leaves a caller
+//        holding a dangling sound
+//
+// ============================================================================
+class SfxVoicePool
+{
+  public:
+    using VoiceId = std::size_t;
+
+    /// @brief Returned by Play and PlayFree when no voice was given.
+    static constexpr VoiceId INVALID_VOICE = std::numeric_limits<VoiceId>::max();
+
+    SfxVoicePool();
+
+    void SetVoiceCount(std::size_t count);
+    std::size_t GetVoiceCount() const;
+
+    void SetCategoryLimit(SfxCategory category, std::size_t limit);
+    std::size_t GetCategoryLimit(SfxCategory category) const;
+
+    VoiceId Play(const sf::SoundBuffer &buffer, const SfxParams &params, float volume);
+    VoiceId PlayFree(const sf::SoundBuffer &buffer, const SfxParams &params, float volume);
+    void StopAll();
+
+    sf::Sound *GetVoice(VoiceId voice);
+    const sf::Sound *GetVoice(VoiceId voice) const;
+
+    std::size_t GetActiveCount() const;
+    std::size_t GetActiveCount(SfxCategory category) const;
+    std::size_t GetActiveCount(const sf::SoundBuffer &buffer) const;
+    std::size_t GetStealCount() const;
+    std::size_t GetRejectCount() const;
+
+    static int ChooseVoice(const std::vector<SfxVoiceState> &voices, const SfxParams &params,
+                           std::size_t categoryLimit);
+
+  private:
+    /// @brief One sound effect voice and the parameters it was started with.
+    struct Voice
+    {
+        sf::Sound sound;
+        SfxParams params;
+    };
+
+    std::vector<SfxVoiceState> CaptureStates(const sf::SoundBuffer &buffer) const;
+    VoiceId Start(std::size_t index, const sf::SoundBuffer &buffer, const SfxParams &params, float volume);
+
+  private:
+    std::vector<Voice> m_voices;
+    std::array<std::size_t, static_cast<std::size_t>(SfxCategory::Count)> m_categoryLimits;
+
+    std::size_t m_stealCount = 0;
+    std::size_t m_rejectCount = 0;
+};
@@ -0,0 +1,272 @@
+// ============================================================================
+//  File        : SoftwareMixer.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-15
+//  Description : Mixes sound effect voices in software and plays the result
+//                through a single SFML sound stream.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "SoftwareMixer.h"
+#include "Macros.h"
+#include "MixKernels.h"
+#include <algorithm>
+
+namespace
+{
+/// @brief Frames mixed per stream chunk; about 12 ms at 44.1 kHz, so a new voice is heard within a few chunks.
+constexpr std::size_t CHUNK_FRAMES = 512;
+
+/// @brief The mix is always interleaved stereo.
+constexpr unsigned int MIX_CHANNELS = 2;
+
+/// @brief Voices reserved up front, so starting one rarely allocates while the mixer thread waits on the lock.
+constexpr std::size_t RESERVED_VOICES = 64;
+
+/// @brief Balance law: the far channel fades out as the sound moves aside, the near one stays at full gain, so a
+/// centered sound plays exactly as loud as an unpanned one.
+/// @param pan -1 left to 1 right.
+/// @param left receives the left channel gain.
+/// @param right receives the right channel gain.
+void PanGains(float pan, float &left, float &right)
+{
+    left = pan > 0.f ? 1.f - pan : 1.f;
+    right = pan < 0.f ? 1.f + pan : 1.f;
+}
+} // namespace
+
+/// @brief Constructor for the SoftwareMixer. The stream is not started; call play() once to start mixing.
+/// @param buses bus gains applied to every voice; must outlive the mixer.
+/// @param sampleRate output sample rate. Only buffers at this rate can be mixed.
+SoftwareMixer::SoftwareMixer(const AudioBuses &buses, unsigned int sampleRate)
+    : m_buses(buses), m_mix(CHUNK_FRAMES * MIX_CHANNELS), m_output(CHUNK_FRAMES * MIX_CHANNELS)
+{
+    m_voices.reserve(RESERVED_VOICES);
+    initialize(MIX_CHANNELS, sampleRate);
+}
+
+/// @brief Destructor for the SoftwareMixer. Stops the stream thread before the voices go away.
+SoftwareMixer::~SoftwareMixer()
+{
+    stop();
+}
+
+/// @brief Returns whether a buffer can be mixed as is: mono or stereo, at the mixer sample rate.
+/// @param buffer buffer to check.
+/// @return true / false
+bool SoftwareMixer::CanMix(const sf::SoundBuffer &buffer) const
+{
+    return buffer.getSampleCount() > 0 && buffer.getSampleRate() == getSampleRate() &&
+           (buffer.getChannelCount() == 1 || buffer.getChannelCount() == 2);
+}
+
+/// @brief Starts a voice.
+/// @param buffer samples to play; must stay loaded until the voice ends or is stopped.
+/// @param bus bus the voice is routed through.
+/// @param gain voice gain, 0 to 1 or more for merged requests.
+/// @param pan -1 left to 1 right.
+/// @param startFrame frame of the buffer to start from, to resume a sound part way through.
+/// @return id of the new voice, or INVALID_VOICE if the buffer cannot be mixed.
+SoftwareMixer::VoiceId SoftwareMixer::Play(const sf::SoundBuffer &buffer, AudioBusId bus, float gain, float pan,
+                                           std::size_t startFrame)
+{
+    if (!CanMix(buffer))
+    {
+        CT_LOG_WARN("SoftwareMixer: cannot mix a {} channel buffer at {} Hz, expected mono or stereo at {} Hz.",
+                    buffer.getChannelCount(), buffer.getSampleRate(), getSampleRate());
+
+        return INVALID_VOICE;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    Voice voice;
+    voice.id = m_nextId++;
+    voice.buffer = &buffer;
+    voice.position = startFrame;
+    voice.gain = std::max(0.f, gain);
+    voice.pan = std::clamp(pan, -1.f, 1.f);
+    voice.bus = bus;
+
+    if (m_nextId == INVALID_VOICE)
+    {
+        ++m_nextId;
+    }
+
+    m_voices.push_back(voice);
+
+    return voice.id;
+}
+
+/// @brief Stops one voice. Does nothing if it already ended.
+/// @param voice id returned by Play.
+void SoftwareMixer::Stop(VoiceId voice)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_voices.erase(std::remove_if(m_voices.begin(), m_voices.end(), [voice](const Voice &v) { return v.id == voice; }),
+                   m_voices.end());
+}
+
+/// @brief Stops every voice. Call before any buffer a voice may be playing is released or reloaded.
+void SoftwareMixer::StopAll()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_voices.clear();
+}
+
+/// @brief Returns whether a voice is still playing.
+/// @param voice id returned by Play.
+/// @return true / false
+bool SoftwareMixer::IsVoicePlaying(VoiceId voice) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return Find(voice) != nullptr;
+}
+
+/// @brief Changes the gain of a playing voice, taking effect from the next mixed chunk.
+/// @param voice id returned by Play.
+/// @param gain new voice gain.
+void SoftwareMixer::SetVoiceGain(VoiceId voice, float gain)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (Voice *v = Find(voice))
+    {
+        v->gain = std::max(0.f, gain);
+    }
+}
+
+/// @brief Moves a playing voice in the stereo field, taking effect from the next mixed chunk.
+/// @param voice id returned by Play.
+/// @param pan -1 left to 1 right.
+void SoftwareMixer::SetVoicePan(VoiceId voice, float pan)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (Voice *v = Find(voice))
+    {
+        v->pan = std::clamp(pan, -1.f, 1.f);
+    }
+}
+
+/// @brief Returns how many voices are playing.
+/// @return m_voices.size().
+std::size_t SoftwareMixer::GetActiveVoiceCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_voices.size();
+}
+
+/// @brief Mixes the next frames of every voice into output and advances them, dropping voices that end. Called from
+/// the stream thread.
+/// @param output receives frames * 2 interleaved stereo samples.
+/// @param frames frames to mix.
+void SoftwareMixer::Mix(sf::Int16 *output, std::size_t frames)
+{
+    if (m_mix.size() < frames * MIX_CHANNELS)
+    {
+        m_mix.resize(frames * MIX_CHANNELS);
+    }
+
+    std::fill_n(m_mix.begin(), frames * MIX_CHANNELS, 0.f);
+    Accumulate(m_mix.data(), frames);
+
+    ConvertToInt16(m_mix.data(), output, frames * MIX_CHANNELS);
+}
+
+/// @brief Adds the next frames of every voice to a float mix and advances them, dropping voices that end. Public so
+/// other sources can be summed into the same mix before it is clipped, and so it can run without an audio device.
+/// @param mix frames * 2 interleaved stereo samples, added to.
+/// @param frames frames to mix.
+void SoftwareMixer::Accumulate(float *mix, std::size_t frames)
+{
+    std::array<float, static_cast<std::size_t>(AudioBusId::Count)> busGains;
+
+    for (std::size_t i = 0; i < busGains.size(); ++i)
+    {
+        busGains[i] = m_buses.GetEffectiveGain(static_cast<AudioBusId>(i));
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (Voice &voice : m_voices)
+    {
+        const unsigned int channels = voice.buffer->getChannelCount();
+        const std::size_t totalFrames = static_cast<std::size_t>(voice.buffer->getSampleCount()) / channels;
+        const std::size_t count = std::min(frames, totalFrames - std::min(voice.position, totalFrames));
+        const float gain = voice.gain * busGains[static_cast<std::size_t>(voice.bus)];
+        const sf::Int16 *source = voice.buffer->getSamples() + voice.position * channels;
+
+        float left = 1.f;
+        float right = 1.f;
+        PanGains(voice.pan, left, right);
+
+        if (gain > 0.f)
+        {
+            if (channels == 1)
+            {
+                MixMonoToStereo(mix, source, count, gain * left, gain * right);
+            }
+            else
+            {
+                MixStereo(mix, source, count, gain * left, gain * right);
+            }
+        }
+
+        voice.position += count;
+    }
+
+    m_voices.erase(std::remove_if(m_voices.begin(), m_voices.end(),
+                                  [](const Voice &voice)
+                                  {
+                                      const unsigned int channels = voice.buffer->getChannelCount();
+                                      return voice.position * channels >= voice.buffer->getSampleCount();
+                                  }),
+                   m_voices.end());
+}
+
+/// @brief Feeds SFML the next chunk. The stream never ends on its own; silence is streamed while no voice plays.
+/// @param data receives the chunk.
+/// @return true to keep streaming.
+bool SoftwareMixer::onGetData(Chunk &data)
+{
+    Mix(m_output.data(), CHUNK_FRAMES);
+
+    data.samples = m_output.data();
+    data.sampleCount = m_output.size();
+
+    return true;
+}
+
+/// @brief Seeking has no meaning for a live mix; voices keep their own positions.
+/// @param timeOffset ignored.
+void SoftwareMixer::onSeek(sf::Time /*timeOffset*/)
+{
+}
+
+/// @brief Looks up a playing voice. The caller holds m_mutex.
+/// @param voice id returned by Play.
+/// @return the voice, or nullptr if it ended.
+SoftwareMixer::Voice *SoftwareMixer::Find(VoiceId voice)
+{
+    auto it = std::find_if(m_voices.begin(), m_voices.end(), [voice](const Voice &v) { return v.id == voice; });
+
+    return it == m_voices.end() ? nullptr : &*it;
+}
+
+/// @brief Looks up a playing voice. The caller holds m_mutex.
+/// @param voice id returned by Play.
+/// @return the voice, or nullptr if it ended.
+const SoftwareMixer::Voice *SoftwareMixer::Find(VoiceId voice) const
+{
+    auto it = std::find_if(m_voices.begin(), m_voices.end(), [voice](const Voice &v) { return v.id == voice; });
+
+    return it == m_voices.end() ? nullptr : &*it;
+}
@@ -0,0 +1,90 @@
+// ============================================================================
+//  File        : SoftwareMixer.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-15
+//  Description : Mixes sound effect voices in software and plays the result
+//                through a single SFML sound stream.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include "AudioBus.h"
+#include <SFML/Audio.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// ============================================================================
+//  Class       : SoftwareMixer
+//  Purpose     : Sound stream that outputs the sum of every voice started on
+//                it, each scaled by its own gain and its bus.
+//
+//  Responsibilities:
+//      - Plays any number of voices on one OpenAL source
+//      - Accepts 16 bit mono and stereo buffers at the mixer sample rate
+//      - Applies bus gains once per mixed block, not per voice change
+//      - Mixes and clips with the SIMD kernels in MixKernels
+//
+// ============================================================================
+class SoftwareMixer : public sf::SoundStream
+{
+  public:
+    using VoiceId = std::uint32_t;
+
+    /// @brief Returned by Play when a buffer cannot be mixed.
+    static constexpr VoiceId INVALID_VOICE = 0;
+
+    explicit SoftwareMixer(const AudioBuses &buses, unsigned int sampleRate = 44100);
+    ~SoftwareMixer() override;
+
+    SoftwareMixer(const SoftwareMixer &) = delete;
+    SoftwareMixer &operator=(const SoftwareMixer &) = delete;
+
+    bool CanMix(const sf::SoundBuffer &buffer) const;
+
+    VoiceId Play(const sf::SoundBuffer &buffer, AudioBusId bus, float gain, float pan = 0.f, std::size_t startFrame = 0);
+    void Stop(VoiceId voice);
+    void StopAll();
+
+    bool IsVoicePlaying(VoiceId voice) const;
+    void SetVoiceGain(VoiceId voice, float gain);
+    void SetVoicePan(VoiceId voice, float pan);
+    std::size_t GetActiveVoiceCount() const;
+
+    void Mix(sf::Int16 *output, std::size_t frames);
+    void Accumulate(float *mix, std::size_t frames);
+
+  protected:
+    bool onGetData(Chunk &data) override;
+    void onSeek(sf::Time timeOffset) override;
+
+  private:
+    /// @brief One sound being mixed. The buffer must outlive the voice.
+    struct Voice
+    {
+        VoiceId id = INVALID_VOICE;
+        const sf::SoundBuffer *buffer = nullptr;
+        std::size_t position = 0;
+        float gain = 1.f;
+        float pan = 0.f;
+        AudioBusId bus = AudioBusId::Sfx;
+    };
+
+    Voice *Find(VoiceId voice);
+    const Voice *Find(VoiceId voice) const;
+
+  private:
+    const AudioBuses &m_buses;
+
+    mutable std::mutex m_mutex;
+    std::vector<Voice> m_voices;
+    VoiceId m_nextId = 1;
+
+    std::vector<float> m_mix;
+    std::vector<sf::Int16> m_output;
+};
@@ -0,0 +1,113 @@
+// ============================================================================
+//  File        : SoundDiskCache.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-21
+//  Description : On disk cache of decoded and normalized sound effects, so
+//                later runs map samples straight into the sound buffer
+//                instead of decoding and resampling again.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "SoundDiskCache.h"
+#include "Macros.h"
+#include <utility>
+
+namespace
+{
+/// @brief "CTSD", little endian.
+constexpr std::uint32_t COOKED_SOUND_MAGIC = 0x44535443;
+
+/// @brief Bump whenever the entry layout or the normalization changes; older entries are then ignored and rewritten.
+constexpr std::uint32_t COOKED_SOUND_VERSION = 1;
+
+/// @brief Fixed size prefix of every entry, followed by sampleCount 16 bit samples.
+struct CookedSoundHeader
+{
+    CookedEntryPrefix prefix{COOKED_SOUND_MAGIC, COOKED_SOUND_VERSION};
+    std::uint32_t sampleRate = 0;
+    std::uint32_t channelCount = 0;
+    std::uint64_t sampleCount = 0;
+};
+
+static_assert(sizeof(CookedSoundHeader) == 48, "CookedSoundHeader must not contain padding.");
+} // namespace
+
+/// @brief Constructor for the SoundDiskCache. Entries default to cache/sounds/.
+SoundDiskCache::SoundDiskCache() : CookedEntryCache("SoundDiskCache", "cache/sounds/", ".csnd")
+{
+}
+
+/// @brief Maps the entry for a source sound if it was written from the file as it is now, for the same sample rate.
+/// Safe to call from any thread.
+/// @param sourcePath source sound, as passed to Store.
+/// @param sampleRate rate the samples must have been normalized to.
+/// @param cooked receives the mapped entry.
+/// @return false when disabled, missing, stale, for another rate or malformed.
+bool SoundDiskCache::Load(const std::string &sourcePath, unsigned int sampleRate, CookedSound &cooked) const
+{
+    MappedFile file;
+    CookedSoundHeader header;
+
+    if (!LoadEntry(sourcePath, file, header))
+    {
+        return false;
+    }
+
+    if (header.sampleRate != sampleRate)
+    {
+        CT_LOG_DEBUG("SoundDiskCache: '{}' was cached at {} Hz, not {} Hz.", sourcePath, header.sampleRate,
+                     sampleRate);
+
+        return false;
+    }
+
+    const std::size_t sampleBytes = static_cast<std::size_t>(header.sampleCount) * sizeof(std::int16_t);
+
+    if (sampleBytes == 0 || header.channelCount == 0 || file.Size() != sizeof(CookedSoundHeader) + sampleBytes)
+    {
+        CT_LOG_WARN("SoundDiskCache: entry for '{}' is truncated, ignoring it.", sourcePath);
+
+        return false;
+    }
+
+    cooked.contentHash = header.prefix.contentHash;
+    cooked.sourceSize = static_cast<std::size_t>(header.prefix.sourceSize);
+    cooked.sampleRate = header.sampleRate;
+    cooked.channelCount = header.channelCount;
+    cooked.sampleCount = static_cast<std::size_t>(header.sampleCount);
+    cooked.samples = reinterpret_cast<const std::int16_t *>(file.Data() + sizeof(CookedSoundHeader));
+    cooked.file = std::move(file);
+
+    return true;
+}
+
+/// @brief Writes normalized samples for a source sound, replacing any older entry. Safe to call from any thread for
+/// different sources.
+/// @param sourcePath source sound the samples were decoded from.
+/// @param contentHash Fnv1a64 of the source bytes.
+/// @param sourceSize size of the source bytes.
+/// @param sampleRate frames per second of samples.
+/// @param channelCount samples per frame.
+/// @param samples interleaved 16 bit samples.
+/// @param sampleCount samples in samples, over all channels.
+/// @return true / false
+bool SoundDiskCache::Store(const std::string &sourcePath, std::uint64_t contentHash, std::size_t sourceSize,
+                           unsigned int sampleRate, unsigned int channelCount, const std::int16_t *samples,
+                           std::size_t sampleCount) const
+{
+    if (!samples || sampleCount == 0 || channelCount == 0)
+    {
+        return false;
+    }
+
+    CookedSoundHeader header;
+    header.prefix.contentHash = contentHash;
+    header.sampleRate = sampleRate;
+    header.channelCount = channelCount;
+    header.sampleCount = sampleCount;
+
+    return StoreEntry(sourcePath, sourceSize, header, samples, sampleCount * sizeof(std::int16_t));
+}
@@ -0,0 +1,62 @@
+// ============================================================================
+//  File        : SoundDiskCache.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-21
+//  Description : On disk cache of decoded and normalized sound effects, so
+//                later runs map samples straight into the sound buffer
+//                instead of decoding and resampling again.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include "CookedEntryCache.h"
+#include "MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/// @brief A cache entry mapped into memory. The samples stay valid while the entry is alive.
+struct CookedSound
+{
+    MappedFile file;
+
+    std::uint64_t contentHash = 0;
+    std::size_t sourceSize = 0;
+    unsigned int sampleRate = 0;
+    unsigned int channelCount = 0;
+    std::size_t sampleCount = 0;
+
+    /// @brief Interleaved 16 bit samples.
+    const std::int16_t *samples = nullptr;
+
+    bool IsValid() const
+    {
+        return samples != nullptr;
+    }
+};
+
+// ============================================================================
+//  Class       : SoundDiskCache
+//  Purpose     : Stores normalized sound samples keyed by source path, and
+//                hands them back memory mapped while the source is unchanged.
+//
+//  Responsibilities:
+//      - Writes one entry per source sound, through CookedEntryCache
+//      - Rejects entries that were normalized for another sample rate, so
+//        changing the output rate invalidates them
+//
+// ============================================================================
+class SoundDiskCache : public CookedEntryCache
+{
+  public:
+    SoundDiskCache();
+
+    bool Load(const std::string &sourcePath, unsigned int sampleRate, CookedSound &cooked) const;
+    bool Store(const std::string &sourcePath, std::uint64_t contentHash, std::size_t sourceSize,
+               unsigned int sampleRate, unsigned int channelCount, const std::int16_t *samples,
+               std::size_t sampleCount) const;
+};
@@ -0,0 +1,234 @@
+// ============================================================================
+//  File        : SoundNormalizer.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-21
+//  Description : Load time conversion of decoded sound effects to the device
+//                sample rate, and to mono when both channels carry the same
+//                signal.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "SoundNormalizer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+/// @brief Pi, for the sinc and window.
+constexpr double PI = 3.14159265358979323846;
+
+/// @brief Zero crossings of the sinc on each side of the filter centre. More is sharper, and costs more per frame.
+constexpr int ZERO_CROSSINGS = 16;
+
+/// @brief Kernel table entries per zero crossing; values in between are interpolated linearly.
+constexpr int KERNEL_RESOLUTION = 512;
+
+/// @brief Cutoff as a fraction of the lower Nyquist frequency, leaving the filter room to roll off before aliasing.
+constexpr double ROLLOFF = 0.95;
+
+/// @brief Largest left / right difference, in 16 bit steps, still treated as the same signal (about -66 dBFS).
+constexpr int MONO_TOLERANCE = 16;
+
+/// @brief Builds one side of the Blackman windowed sinc, from the centre out to the last zero crossing.
+/// @return ZERO_CROSSINGS * KERNEL_RESOLUTION + 1 kernel values.
+std::vector<float> BuildKernel()
+{
+    std::vector<float> kernel(ZERO_CROSSINGS * KERNEL_RESOLUTION + 1);
+
+    for (std::size_t i = 0; i < kernel.size(); ++i)
+    {
+        const double x = static_cast<double>(i) / KERNEL_RESOLUTION;
+        const double sinc = i == 0 ? 1.0 : std::sin(PI * x) / (PI * x);
+        const double phase = PI * x / ZERO_CROSSINGS;
+        const double window = 0.42 + 0.5 * std::cos(phase) + 0.08 * std::cos(2.0 * phase);
+
+        kernel[i] = static_cast<float>(sinc * window);
+    }
+
+    kernel.back() = 0.f;
+
+    return kernel;
+}
+
+/// @brief Evaluates the windowed sinc.
+/// @param x distance from the filter centre, in zero crossings.
+/// @return kernel value, 0 past the last zero crossing.
+double Kernel(double x)
+{
+    static const std::vector<float> kernel = BuildKernel();
+
+    const double position = std::abs(x) * KERNEL_RESOLUTION;
+    const auto index = static_cast<std::size_t>(position);
+
+    if (index + 1 >= kernel.size())
+    {
+        return 0.0;
+    }
+
+    const double fraction = position - static_cast<double>(index);
+
+    return kernel[index] + (kernel[index + 1] - kernel[index]) * fraction;
+}
+
+/// @brief Rounds a filtered value back to a 16 bit sample.
+/// @param value filtered value.
+/// @return value rounded and clipped to the 16 bit range.
+std::int16_t ToSample(double value)
+{
+    return static_cast<std::int16_t>(std::clamp(std::lround(value), -32768L, 32767L));
+}
+} // namespace
+
+/// @brief Converts a decoded sound to the target rate, and to mono when its two channels are the same signal. Sounds
+/// that are already in that layout are left alone, so the caller can keep its buffer.
+/// @param samples interleaved 16 bit samples.
+/// @param sampleCount samples in samples, over all channels.
+/// @param channels samples per frame.
+/// @param sampleRate frames per second of samples.
+/// @param targetRate frames per second to convert to, or 0 to keep the rate.
+/// @param normalized receives the converted samples.
+/// @param normalizedChannels receives the channel count of normalized.
+/// @return false if nothing needed converting; normalized is then left untouched.
+bool SoundNormalizer::Normalize(const std::int16_t *samples, std::size_t sampleCount, unsigned int channels,
+                                unsigned int sampleRate, unsigned int targetRate,
+                                std::vector<std::int16_t> &normalized, unsigned int &normalizedChannels)
+{
+    if (!samples || channels == 0 || sampleRate == 0 || sampleCount < channels)
+    {
+        return false;
+    }
+
+    const std::size_t frames = sampleCount / channels;
+    const bool isDownmixed = channels == 2 && IsEffectivelyMono(samples, frames);
+    const bool isResampled = targetRate != 0 && targetRate != sampleRate;
+
+    if (!isDownmixed && !isResampled)
+    {
+        return false;
+    }
+
+    normalizedChannels = channels;
+
+    if (isDownmixed)
+    {
+        normalized = DownmixToMono(samples, frames);
+        normalizedChannels = 1;
+    }
+
+    if (isResampled)
+    {
+        normalized = Resample(isDownmixed ? normalized.data() : samples, frames, normalizedChannels, sampleRate,
+                              targetRate);
+    }
+
+    return true;
+}
+
+/// @brief Returns whether an interleaved stereo sound has the same signal on both channels, as many exported SFX do.
+/// @param samples interleaved stereo samples.
+/// @param frames frames in samples.
+/// @return true if no frame differs by more than MONO_TOLERANCE between left and right.
+bool SoundNormalizer::IsEffectivelyMono(const std::int16_t *samples, std::size_t frames)
+{
+    for (std::size_t i = 0; i < frames; ++i)
+    {
+        if (std::abs(samples[i * 2] - samples[i * 2 + 1]) > MONO_TOLERANCE)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// @brief Averages the two channels of a stereo sound.
+/// @param samples interleaved stereo samples.
+/// @param frames frames in samples.
+/// @return frames mono samples.
+std::vector<std::int16_t> SoundNormalizer::DownmixToMono(const std::int16_t *samples, std::size_t frames)
+{
+    std::vector<std::int16_t> mono(frames);
+
+    for (std::size_t i = 0; i < frames; ++i)
+    {
+        mono[i] = static_cast<std::int16_t>((samples[i * 2] + samples[i * 2 + 1]) / 2);
+    }
+
+    return mono;
+}
+
+/// @brief Resamples with a Blackman windowed sinc. Its cutoff sits just under the lower of the two Nyquist
+/// frequencies, so downsampling does not fold high frequencies back and upsampling does not leave images. Meant for
+/// load time: each output frame costs 2 * ZERO_CROSSINGS taps per channel, or more when downsampling.
+/// @param samples interleaved 16 bit samples.
+/// @param frames frames in samples.
+/// @param channels samples per frame.
+/// @param fromRate frames per second of samples.
+/// @param toRate frames per second to resample to.
+/// @return GetResampledFrames(frames, fromRate, toRate) interleaved frames.
+std::vector<std::int16_t> SoundNormalizer::Resample(const std::int16_t *samples, std::size_t frames,
+                                                    unsigned int channels, unsigned int fromRate, unsigned int toRate)
+{
+    const std::size_t outFrames = GetResampledFrames(frames, fromRate, toRate);
+    std::vector<std::int16_t> resampled(outFrames * channels);
+
+    if (outFrames == 0 || channels == 0)
+    {
+        return resampled;
+    }
+
+    const double step = static_cast<double>(fromRate) / toRate;
+    const double cutoff = std::min(1.0, static_cast<double>(toRate) / fromRate) * ROLLOFF;
+    const double halfWidth = ZERO_CROSSINGS / cutoff;
+    const auto lastFrame = static_cast<double>(frames - 1);
+
+    std::vector<double> sums(channels);
+
+    for (std::size_t n = 0; n < outFrames; ++n)
+    {
+        const double centre = static_cast<double>(n) * step;
+        const auto first = static_cast<std::size_t>(std::max(0.0, std::ceil(centre - halfWidth)));
+        const auto last = static_cast<std::size_t>(std::min(lastFrame, std::floor(centre + halfWidth)));
+
+        std::fill(sums.begin(), sums.end(), 0.0);
+
+        for (std::size_t k = first; k <= last; ++k)
+        {
+            const double weight = cutoff * Kernel((centre - static_cast<double>(k)) * cutoff);
+            const std::int16_t *frame = samples + k * channels;
+
+            for (unsigned int c = 0; c < channels; ++c)
+            {
+                sums[c] += weight * frame[c];
+            }
+        }
+
+        for (unsigned int c = 0; c < channels; ++c)
+        {
+            resampled[n * channels + c] = ToSample(sums[c]);
+        }
+    }
+
+    return resampled;
+}
+
+/// @brief Returns how many frames a sound has after resampling, so it keeps its duration.
+/// @param frames frames before resampling.
+/// @param fromRate original frames per second.
+/// @param toRate new frames per second.
+/// @return frames * toRate / fromRate, rounded up.
+std::size_t SoundNormalizer::GetResampledFrames(std::size_t frames, unsigned int fromRate, unsigned int toRate)
+{
+    if (fromRate == 0)
+    {
+        return 0;
+    }
+
+    const std::uint64_t scaled = static_cast<std::uint64_t>(frames) * toRate;
+
+    return static_cast<std::size_t>((scaled + fromRate - 1) / fromRate);
+}
@@ -0,0 +1,44 @@
+// ============================================================================
+//  File        : SoundNormalizer.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-21
+//  Description : Load time conversion of decoded sound effects to the device
+//                sample rate, and to mono when both channels carry the same
+//                signal.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ============================================================================
+//  Class       : SoundNormalizer
+//  Purpose     : Brings every sound effect to one sample layout up front, so
+//                no voice is resampled while it plays.
+//
+//  Responsibilities:
+//      - Detects stereo sounds whose channels are the same signal
+//      - Down mixes those to mono, halving their memory
+//      - Resamples to a target rate with a windowed sinc filter
+//
+// ============================================================================
+class SoundNormalizer
+{
+  public:
+    static bool Normalize(const std::int16_t *samples, std::size_t sampleCount, unsigned int channels,
+                          unsigned int sampleRate, unsigned int targetRate, std::vector<std::int16_t> &normalized,
+                          unsigned int &normalizedChannels);
+
+    static bool IsEffectivelyMono(const std::int16_t *samples, std::size_t frames);
+    static std::vector<std::int16_t> DownmixToMono(const std::int16_t *samples, std::size_t frames);
+
+    static std::vector<std::int16_t> Resample(const std::int16_t *samples, std::size_t frames, unsigned int channels,
+                                              unsigned int fromRate, unsigned int toRate);
+    static std::size_t GetResampledFrames(std::size_t frames, unsigned int fromRate, unsigned int toRate);
+};
@@ -0,0 +1,222 @@
+// ============================================================================
+//  File        : SpatialAudio.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-17
+//  Description : 2D positional audio: distance attenuation, stereo pan and
+//                culling, evaluated for many emitters in one batched pass.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "SpatialAudio.h"
+#include "MixKernels.h"
+#include <algorithm>
+#include <cmath>
+
+#if CT_MIX_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+/// @brief Emitters quieter than this are culled; about -40 dB, lost under anything else playing.
+constexpr float MIN_AUDIBLE_GAIN = 0.01f;
+
+/// @brief Keeps the linear falloff finite when min and max distance meet.
+constexpr float MIN_FALLOFF_RANGE = 1.f;
+
+/// @brief Removes element index from v by moving the last element into its place.
+/// @param v vector to shrink.
+/// @param index element to remove.
+template <typename T> void SwapRemove(std::vector<T> &v, std::size_t index)
+{
+    v[index] = v.back();
+    v.pop_back();
+}
+} // namespace
+
+/// @brief Appends an emitter.
+/// @param position emitter position, in world units.
+/// @param attenuation distance falloff.
+/// @return index of the emitter, valid until the next Remove or Clear.
+std::size_t SpatialBatch::Add(const sf::Vector2f &position, const SfxAttenuation &attenuation)
+{
+    const float minDistance = std::max(1.f, attenuation.minDistance);
+    const float maxDistance = std::max(minDistance, attenuation.maxDistance);
+
+    m_x.push_back(position.x);
+    m_y.push_back(position.y);
+    m_minDistance.push_back(minDistance);
+    m_maxDistance.push_back(maxDistance);
+    m_inverseRange.push_back(1.f / std::max(MIN_FALLOFF_RANGE, maxDistance - minDistance));
+    m_isLinear.push_back(attenuation.model == AttenuationModel::Linear ? 1.f : 0.f);
+    m_isInverse.push_back(attenuation.model == AttenuationModel::Inverse ? 1.f : 0.f);
+    m_gains.push_back(0.f);
+    m_pans.push_back(0.f);
+
+    return m_x.size() - 1;
+}
+
+/// @brief Removes an emitter. The last emitter takes its index.
+/// @param index emitter to remove.
+void SpatialBatch::Remove(std::size_t index)
+{
+    SwapRemove(m_x, index);
+    SwapRemove(m_y, index);
+    SwapRemove(m_minDistance, index);
+    SwapRemove(m_maxDistance, index);
+    SwapRemove(m_inverseRange, index);
+    SwapRemove(m_isLinear, index);
+    SwapRemove(m_isInverse, index);
+    SwapRemove(m_gains, index);
+    SwapRemove(m_pans, index);
+}
+
+/// @brief Removes every emitter, keeping the storage for the next batch.
+void SpatialBatch::Clear()
+{
+    m_x.clear();
+    m_y.clear();
+    m_minDistance.clear();
+    m_maxDistance.clear();
+    m_inverseRange.clear();
+    m_isLinear.clear();
+    m_isInverse.clear();
+    m_gains.clear();
+    m_pans.clear();
+}
+
+/// @brief Returns how many emitters the batch holds.
+/// @return m_x.size().
+std::size_t SpatialBatch::GetCount() const
+{
+    return m_x.size();
+}
+
+/// @brief Moves an emitter.
+/// @param index emitter to move.
+/// @param position new position, in world units.
+void SpatialBatch::SetPosition(std::size_t index, const sf::Vector2f &position)
+{
+    m_x[index] = position.x;
+    m_y[index] = position.y;
+}
+
+/// @brief Computes gain and pan of every emitter, four at a time where SSE2 is available. Culled emitters get a gain
+/// of exactly 0.
+/// @param listener where the sounds are heard from.
+void SpatialBatch::Compute(const SpatialListener &listener)
+{
+    const std::size_t count = m_x.size();
+    std::size_t i = 0;
+
+#if CT_MIX_SSE2
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 minusOne = _mm_set1_ps(-1.f);
+    const __m128 minGain = _mm_set1_ps(MIN_AUDIBLE_GAIN);
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    const __m128 listenerX = _mm_set1_ps(listener.position.x);
+    const __m128 listenerY = _mm_set1_ps(listener.position.y);
+    const __m128 reachX = _mm_set1_ps(listener.halfExtents.x + listener.margin);
+    const __m128 reachY = _mm_set1_ps(listener.halfExtents.y + listener.margin);
+    const __m128 panScale = _mm_set1_ps(1.f / std::max(1.f, listener.halfExtents.x));
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 dx = _mm_sub_ps(_mm_loadu_ps(&m_x[i]), listenerX);
+        const __m128 dy = _mm_sub_ps(_mm_loadu_ps(&m_y[i]), listenerY);
+        const __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+
+        const __m128 minDistance = _mm_loadu_ps(&m_minDistance[i]);
+        const __m128 maxDistance = _mm_loadu_ps(&m_maxDistance[i]);
+
+        // Linear: 1 at minDistance down to 0 at maxDistance.
+        const __m128 linear = _mm_min_ps(
+            one, _mm_max_ps(zero, _mm_sub_ps(one, _mm_mul_ps(_mm_sub_ps(distance, minDistance),
+                                                              _mm_loadu_ps(&m_inverseRange[i])))));
+
+        // Inverse: minDistance / distance, cut off beyond maxDistance.
+        const __m128 inverse =
+            _mm_and_ps(_mm_cmple_ps(distance, maxDistance),
+                       _mm_div_ps(minDistance, _mm_max_ps(_mm_max_ps(distance, minDistance), one)));
+
+        // gain = 1 + isLinear * (linear - 1) + isInverse * (inverse - 1); None keeps 1.
+        __m128 gain = _mm_add_ps(one, _mm_mul_ps(_mm_loadu_ps(&m_isLinear[i]), _mm_sub_ps(linear, one)));
+        gain = _mm_add_ps(gain, _mm_mul_ps(_mm_loadu_ps(&m_isInverse[i]), _mm_sub_ps(inverse, one)));
+
+        const __m128 isOnScreen = _mm_and_ps(_mm_cmple_ps(_mm_and_ps(dx, absMask), reachX),
+                                             _mm_cmple_ps(_mm_and_ps(dy, absMask), reachY));
+        const __m128 isAudible = _mm_and_ps(isOnScreen, _mm_cmpge_ps(gain, minGain));
+
+        _mm_storeu_ps(&m_gains[i], _mm_and_ps(isAudible, gain));
+        _mm_storeu_ps(&m_pans[i], _mm_min_ps(one, _mm_max_ps(minusOne, _mm_mul_ps(dx, panScale))));
+    }
+#endif
+
+    ComputeRange(listener, i, count);
+}
+
+/// @brief Portable version of Compute, also used for the emitters the SIMD loop leaves over.
+/// @param listener where the sounds are heard from.
+void SpatialBatch::ComputeScalar(const SpatialListener &listener)
+{
+    ComputeRange(listener, 0, m_x.size());
+}
+
+/// @brief Returns the gain of an emitter after the last Compute.
+/// @param index emitter to query.
+/// @return 0 to 1; 0 when culled.
+float SpatialBatch::GetGain(std::size_t index) const
+{
+    return m_gains[index];
+}
+
+/// @brief Returns the stereo position of an emitter after the last Compute.
+/// @param index emitter to query.
+/// @return -1 (left edge of the screen) to 1 (right edge).
+float SpatialBatch::GetPan(std::size_t index) const
+{
+    return m_pans[index];
+}
+
+/// @brief Returns whether an emitter survived culling in the last Compute.
+/// @param index emitter to query.
+/// @return true / false
+bool SpatialBatch::IsAudible(std::size_t index) const
+{
+    return m_gains[index] > 0.f;
+}
+
+/// @brief Scalar evaluation of emitters [begin, end), matching the SSE2 path.
+/// @param listener where the sounds are heard from.
+/// @param begin first emitter.
+/// @param end one past the last emitter.
+void SpatialBatch::ComputeRange(const SpatialListener &listener, std::size_t begin, std::size_t end)
+{
+    const float reachX = listener.halfExtents.x + listener.margin;
+    const float reachY = listener.halfExtents.y + listener.margin;
+    const float panScale = 1.f / std::max(1.f, listener.halfExtents.x);
+
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        const float dx = m_x[i] - listener.position.x;
+        const float dy = m_y[i] - listener.position.y;
+        const float distance = std::sqrt(dx * dx + dy * dy);
+
+        const float linear = std::min(1.f, std::max(0.f, 1.f - (distance - m_minDistance[i]) * m_inverseRange[i]));
+        const float inverse = distance <= m_maxDistance[i]
+                                  ? m_minDistance[i] / std::max(std::max(distance, m_minDistance[i]), 1.f)
+                                  : 0.f;
+
+        float gain = 1.f + m_isLinear[i] * (linear - 1.f);
+        gain += m_isInverse[i] * (inverse - 1.f);
+
+        const bool isOnScreen = std::abs(dx) <= reachX && std::abs(dy) <= reachY;
+
+        m_gains[i] = isOnScreen && gain >= MIN_AUDIBLE_GAIN ? gain : 0.f;
+        m_pans[i] = std::min(1.f, std::max(-1.f, dx * panScale));
+    }
+}
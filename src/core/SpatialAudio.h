@@ -0,0 +1,90 @@
+// ============================================================================
+//  File        : SpatialAudio.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-17
+//  Description : 2D positional audio: distance attenuation, stereo pan and
+//                culling, evaluated for many emitters in one batched pass.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// @brief How a positional sound fades with distance from the listener.
+enum class AttenuationModel : std::uint8_t
+{
+    None,
+    Linear,
+    Inverse
+};
+
+/// @brief Distance falloff of one sound. Full volume up to minDistance, silent beyond maxDistance.
+struct SfxAttenuation
+{
+    AttenuationModel model = AttenuationModel::Linear;
+    float minDistance = 100.f;
+    float maxDistance = 1200.f;
+};
+
+/// @brief Where positional sounds are heard from, in world units.
+struct SpatialListener
+{
+    sf::Vector2f position;
+
+    /// @brief Half the size of the visible area; sounds further out than this plus margin are culled.
+    sf::Vector2f halfExtents = {640.f, 360.f};
+    float margin = 64.f;
+};
+
+// ============================================================================
+//  Class       : SpatialBatch
+//  Purpose     : Structure of arrays holding emitters, so gain, pan and
+//                audibility are computed for all of them in one SIMD pass.
+//
+//  Responsibilities:
+//      - Stores position and attenuation per emitter
+//      - Computes gain (0 to 1) and pan (-1 left to 1 right) per emitter
+//      - Flags emitters that are off screen or too quiet to be heard
+//
+// ============================================================================
+class SpatialBatch
+{
+  public:
+    std::size_t Add(const sf::Vector2f &position, const SfxAttenuation &attenuation);
+    void Remove(std::size_t index);
+    void Clear();
+    std::size_t GetCount() const;
+
+    void SetPosition(std::size_t index, const sf::Vector2f &position);
+
+    void Compute(const SpatialListener &listener);
+    void ComputeScalar(const SpatialListener &listener);
+
+    float GetGain(std::size_t index) const;
+    float GetPan(std::size_t index) const;
+    bool IsAudible(std::size_t index) const;
+
+  private:
+    void ComputeRange(const SpatialListener &listener, std::size_t begin, std::size_t end);
+
+  private:
+    std::vector<float> m_x;
+    std::vector<float> m_y;
+    std::vector<float> m_minDistance;
+    std::vector<float> m_maxDistance;
+    std::vector<float> m_inverseRange;
+
+    /// @brief 1 for the emitter's model, 0 otherwise; lets every model share one branch free formula.
+    std::vector<float> m_isLinear;
+    std::vector<float> m_isInverse;
+
+    std::vector<float> m_gains;
+    std::vector<float> m_pans;
+};
@@ -0,0 +1,103 @@
+// ============================================================================
+//  File        : TextureDiskCache.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-09
+//  Description : On disk cache of decoded RGBA textures, so later runs map
+//                pixels straight into the GPU upload instead of decoding
+//                PNGs again.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "TextureDiskCache.h"
+#include "Macros.h"
+#include <utility>
+
+namespace
+{
+/// @brief "CTTX", little endian.
+constexpr std::uint32_t COOKED_TEXTURE_MAGIC = 0x58545443;
+
+/// @brief Bump whenever the entry layout changes; older entries are then ignored and rewritten.
+constexpr std::uint32_t COOKED_TEXTURE_VERSION = 1;
+
+/// @brief Bytes per RGBA8 pixel.
+constexpr std::size_t BYTES_PER_PIXEL = 4;
+
+/// @brief Fixed size prefix of every entry, followed by width * height RGBA8 pixels.
+struct CookedTextureHeader
+{
+    CookedEntryPrefix prefix{COOKED_TEXTURE_MAGIC, COOKED_TEXTURE_VERSION};
+    std::uint32_t width = 0;
+    std::uint32_t height = 0;
+};
+
+static_assert(sizeof(CookedTextureHeader) == 40, "CookedTextureHeader must not contain padding.");
+} // namespace
+
+/// @brief Constructor for the TextureDiskCache. Entries default to cache/textures/.
+TextureDiskCache::TextureDiskCache() : CookedEntryCache("TextureDiskCache", "cache/textures/", ".ctex")
+{
+}
+
+/// @brief Maps the entry for a source image if it was written from the file as it is now. Safe to call from any
+/// thread.
+/// @param sourcePath source image, as passed to Store.
+/// @param cooked receives the mapped entry.
+/// @return false when disabled, missing, stale or malformed.
+bool TextureDiskCache::Load(const std::string &sourcePath, CookedTexture &cooked) const
+{
+    MappedFile file;
+    CookedTextureHeader header;
+
+    if (!LoadEntry(sourcePath, file, header))
+    {
+        return false;
+    }
+
+    const std::size_t pixelBytes = static_cast<std::size_t>(header.width) * header.height * BYTES_PER_PIXEL;
+
+    if (pixelBytes == 0 || file.Size() != sizeof(CookedTextureHeader) + pixelBytes)
+    {
+        CT_LOG_WARN("TextureDiskCache: entry for '{}' is truncated, ignoring it.", sourcePath);
+
+        return false;
+    }
+
+    cooked.contentHash = header.prefix.contentHash;
+    cooked.sourceSize = static_cast<std::size_t>(header.prefix.sourceSize);
+    cooked.width = header.width;
+    cooked.height = header.height;
+    cooked.pixels = file.Data() + sizeof(CookedTextureHeader);
+    cooked.file = std::move(file);
+
+    return true;
+}
+
+/// @brief Writes decoded pixels for a source image, replacing any older entry. Safe to call from any thread for
+/// different sources.
+/// @param sourcePath source image the pixels were decoded from.
+/// @param contentHash Fnv1a64 of the source bytes.
+/// @param sourceSize size of the source bytes.
+/// @param width width in pixels.
+/// @param height height in pixels.
+/// @param pixels width * height RGBA8 pixels.
+/// @return true / false
+bool TextureDiskCache::Store(const std::string &sourcePath, std::uint64_t contentHash, std::size_t sourceSize,
+                             unsigned int width, unsigned int height, const std::uint8_t *pixels) const
+{
+    if (!pixels || width == 0 || height == 0)
+    {
+        return false;
+    }
+
+    CookedTextureHeader header;
+    header.prefix.contentHash = contentHash;
+    header.width = width;
+    header.height = height;
+
+    return StoreEntry(sourcePath, sourceSize, header, pixels,
+                      static_cast<std::size_t>(width) * height * BYTES_PER_PIXEL);
+}
@@ -0,0 +1,59 @@
+// ============================================================================
+//  File        : TextureDiskCache.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-09
+//  Description : On disk cache of decoded RGBA textures, so later runs map
+//                pixels straight into the GPU upload instead of decoding
+//                PNGs again.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include "CookedEntryCache.h"
+#include "MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/// @brief A cache entry mapped into memory. The pixels stay valid while the entry is alive.
+struct CookedTexture
+{
+    MappedFile file;
+
+    std::uint64_t contentHash = 0;
+    std::size_t sourceSize = 0;
+    unsigned int width = 0;
+    unsigned int height = 0;
+
+    /// @brief Tightly packed RGBA8 rows, top row first.
+    const std::uint8_t *pixels = nullptr;
+
+    bool IsValid() const
+    {
+        return pixels != nullptr;
+    }
+};
+
+// ============================================================================
+//  Class       : TextureDiskCache
+//  Purpose     : Stores decoded texture pixels keyed by source path, and
+//                hands them back memory mapped while the source is unchanged.
+//
+//  Responsibilities:
+//      - Writes one entry per source image, through CookedEntryCache
+//      - Rejects entries whose pixel data does not match their size
+//
+// ============================================================================
+class TextureDiskCache : public CookedEntryCache
+{
+  public:
+    TextureDiskCache();
+
+    bool Load(const std::string &sourcePath, CookedTexture &cooked) const;
+    bool Store(const std::string &sourcePath, std::uint64_t contentHash, std::size_t sourceSize, unsigned int width,
+               unsigned int height, const std::uint8_t *pixels) const;
+};
@@ -0,0 +1,237 @@
+// ============================================================================
+//  File        : TextureStreamer.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-10
+//  Description : Uploads large textures in horizontal slices spread over
+//                several frames, showing a low resolution proxy until the
+//                full image is on the GPU.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "TextureStreamer.h"
+#include "Macros.h"
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+/// @brief Rows uploaded per slice by default; a 1920 wide RGBA slice is about 0.5 MB.
+constexpr unsigned int DEFAULT_SLICE_ROWS = 64;
+
+/// @brief Images with fewer pixel bytes than this upload in one go; slicing them would only add overhead.
+constexpr std::size_t STREAM_MIN_BYTES = 1024 * 1024;
+
+/// @brief Longest side of the placeholder drawn while a texture streams.
+constexpr unsigned int PROXY_MAX_SIDE = 64;
+
+/// @brief Bytes per RGBA8 pixel.
+constexpr std::size_t BYTES_PER_PIXEL = 4;
+
+/// @brief Point samples pixels down to a proxy no larger than PROXY_MAX_SIDE on its longest side.
+/// @param pixels full size RGBA8 pixels.
+/// @param size full size.
+/// @param proxy receives the proxy texture, smoothed so it reads as a blur when stretched.
+void BuildProxy(const sf::Uint8 *pixels, const sf::Vector2u &size, sf::Texture &proxy)
+{
+    const unsigned int step = std::max(1u, (std::max(size.x, size.y) + PROXY_MAX_SIDE - 1) / PROXY_MAX_SIDE);
+    const sf::Vector2u proxySize(std::max(1u, size.x / step), std::max(1u, size.y / step));
+
+    sf::Image image;
+    image.create(proxySize.x, proxySize.y);
+
+    for (unsigned int y = 0; y < proxySize.y; ++y)
+    {
+        for (unsigned int x = 0; x < proxySize.x; ++x)
+        {
+            const sf::Uint8 *pixel = pixels + (static_cast<std::size_t>(y) * step * size.x + x * step) * BYTES_PER_PIXEL;
+            image.setPixel(x, y, sf::Color(pixel[0], pixel[1], pixel[2], pixel[3]));
+        }
+    }
+
+    proxy.loadFromImage(image);
+    proxy.setSmooth(true);
+}
+} // namespace
+
+/// @brief Constructor for the TextureStreamer.
+TextureStreamer::TextureStreamer() : m_sliceRows(DEFAULT_SLICE_ROWS)
+{
+}
+
+/// @brief Returns whether an image is large enough to be worth streaming.
+/// @param size image size in pixels.
+/// @return true / false
+bool TextureStreamer::ShouldStream(const sf::Vector2u &size)
+{
+    return static_cast<std::size_t>(size.x) * size.y * BYTES_PER_PIXEL >= STREAM_MIN_BYTES;
+}
+
+/// @brief Queues a texture to be filled from source. The texture must already be created at the source size, and
+/// stay alive until it is no longer streaming.
+/// @param texture destination texture.
+/// @param source decoded image or disk cache mapping; kept until the last slice is uploaded.
+void TextureStreamer::Enqueue(sf::Texture &texture, PrefetchedAsset source)
+{
+    auto upload = std::make_unique<Upload>();
+    upload->texture = &texture;
+    upload->source = std::move(source);
+    upload->pixels = upload->source.cooked.IsValid() ? upload->source.cooked.pixels
+                                                     : upload->source.image.getPixelsPtr();
+
+    if (!upload->pixels)
+    {
+        CT_LOG_WARN("TextureStreamer: nothing to upload, texture left empty.");
+
+        return;
+    }
+
+    BuildProxy(upload->pixels, texture.getSize(), upload->proxy);
+    m_uploads.push_back(std::move(upload));
+}
+
+/// @brief Uploads slices, oldest request first, until the budget is spent. At least one slice is uploaded per call
+/// while anything is pending, so streaming always progresses.
+/// @param budgetMs time allowed for this call, in milliseconds.
+/// @return number of slices uploaded.
+std::size_t TextureStreamer::Pump(float budgetMs)
+{
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t slices = 0;
+
+    while (!m_uploads.empty())
+    {
+        if (UploadSlice(*m_uploads.front()))
+        {
+            m_uploads.pop_front();
+        }
+
+        ++slices;
+
+        const std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        if (elapsed.count() >= budgetMs)
+        {
+            break;
+        }
+    }
+
+    return slices;
+}
+
+/// @brief Uploads everything still pending, ignoring the budget.
+void TextureStreamer::Flush()
+{
+    while (!m_uploads.empty())
+    {
+        if (UploadSlice(*m_uploads.front()))
+        {
+            m_uploads.pop_front();
+        }
+    }
+}
+
+/// @brief Drops every pending upload. Call before the destination textures are destroyed.
+void TextureStreamer::Clear()
+{
+    m_uploads.clear();
+}
+
+/// @brief Returns whether a texture still has rows waiting to be uploaded.
+/// @param texture texture to query.
+/// @return true / false
+bool TextureStreamer::IsStreaming(const sf::Texture *texture) const
+{
+    return Find(texture) != nullptr;
+}
+
+/// @brief Returns the placeholder to draw instead of a streaming texture.
+/// @param texture texture to query.
+/// @return proxy texture, or nullptr once the texture is complete.
+const sf::Texture *TextureStreamer::GetProxy(const sf::Texture *texture) const
+{
+    const Upload *upload = Find(texture);
+
+    return upload ? &upload->proxy : nullptr;
+}
+
+/// @brief Builds a sprite that draws the proxy exactly where sprite would draw its streaming texture.
+/// @param sprite sprite using a possibly streaming texture.
+/// @param proxySprite receives the stand-in sprite.
+/// @return false if the sprite's texture is complete and should be drawn as is.
+bool TextureStreamer::MakeProxySprite(const sf::Sprite &sprite, sf::Sprite &proxySprite) const
+{
+    const sf::Texture *texture = sprite.getTexture();
+    const sf::Texture *proxy = GetProxy(texture);
+
+    if (!proxy)
+    {
+        return false;
+    }
+
+    const sf::Vector2u size = texture->getSize();
+    const sf::Vector2u proxySize = proxy->getSize();
+
+    proxySprite.setTexture(*proxy, true);
+    proxySprite.setColor(sprite.getColor());
+    proxySprite.setOrigin(sprite.getOrigin().x * proxySize.x / size.x, sprite.getOrigin().y * proxySize.y / size.y);
+    proxySprite.setRotation(sprite.getRotation());
+    proxySprite.setPosition(sprite.getPosition());
+    proxySprite.setScale(sprite.getScale().x * size.x / proxySize.x, sprite.getScale().y * size.y / proxySize.y);
+
+    return true;
+}
+
+/// @brief Returns how many textures are still streaming.
+/// @return m_uploads.size().
+std::size_t TextureStreamer::GetPendingCount() const
+{
+    return m_uploads.size();
+}
+
+/// @brief Sets how many rows each slice uploads.
+/// @param rows rows per slice, at least 1.
+void TextureStreamer::SetSliceRows(unsigned int rows)
+{
+    m_sliceRows = std::max(1u, rows);
+}
+
+/// @brief Returns how many rows each slice uploads.
+/// @return m_sliceRows.
+unsigned int TextureStreamer::GetSliceRows() const
+{
+    return m_sliceRows;
+}
+
+/// @brief Uploads the next slice of one texture.
+/// @param upload texture being filled.
+/// @return true once its last row is uploaded.
+bool TextureStreamer::UploadSlice(Upload &upload)
+{
+    const sf::Vector2u size = upload.texture->getSize();
+    const unsigned int rows = std::min(m_sliceRows, size.y - upload.nextRow);
+
+    upload.texture->update(upload.pixels + static_cast<std::size_t>(upload.nextRow) * size.x * BYTES_PER_PIXEL, size.x,
+                           rows, 0, upload.nextRow);
+    upload.nextRow += rows;
+
+    return upload.nextRow >= size.y;
+}
+
+/// @brief Looks up the pending upload of a texture.
+/// @param texture texture to query.
+/// @return pending upload, or nullptr.
+const TextureStreamer::Upload *TextureStreamer::Find(const sf::Texture *texture) const
+{
+    for (const auto &upload : m_uploads)
+    {
+        if (upload->texture == texture)
+        {
+            return upload.get();
+        }
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,70 @@
+// ============================================================================
+//  File        : TextureStreamer.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-10
+//  Description : Uploads large textures in horizontal slices spread over
+//                several frames, showing a low resolution proxy until the
+//                full image is on the GPU.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include "AssetPrefetch.h"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <deque>
+#include <memory>
+
+// ============================================================================
+//  Class       : TextureStreamer
+//  Purpose     : Fills already created textures a few rows at a time.
+//
+//  Responsibilities:
+//      - Keeps the decoded (or disk cache mapped) pixels alive until uploaded
+//      - Builds a tiny proxy texture to draw while a texture is streaming
+//      - Uploads slices in request order within a per frame time budget
+//
+// ============================================================================
+class TextureStreamer
+{
+  public:
+    TextureStreamer();
+
+    static bool ShouldStream(const sf::Vector2u &size);
+
+    void Enqueue(sf::Texture &texture, PrefetchedAsset source);
+    std::size_t Pump(float budgetMs);
+    void Flush();
+    void Clear();
+
+    bool IsStreaming(const sf::Texture *texture) const;
+    const sf::Texture *GetProxy(const sf::Texture *texture) const;
+    bool MakeProxySprite(const sf::Sprite &sprite, sf::Sprite &proxySprite) const;
+
+    std::size_t GetPendingCount() const;
+
+    void SetSliceRows(unsigned int rows);
+    unsigned int GetSliceRows() const;
+
+  private:
+    /// @brief One texture being filled.
+    struct Upload
+    {
+        sf::Texture *texture = nullptr;
+        PrefetchedAsset source;
+        const sf::Uint8 *pixels = nullptr;
+        unsigned int nextRow = 0;
+        sf::Texture proxy;
+    };
+
+    bool UploadSlice(Upload &upload);
+    const Upload *Find(const sf::Texture *texture) const;
+
+  private:
+    std::deque<std::unique_ptr<Upload>> m_uploads;
+    unsigned int m_sliceRows;
+};
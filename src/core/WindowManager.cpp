@@ -11,6 +11,7 @@
 // ============================================================================
 
 #include "WindowManager.h"
+#include "GlyphCache.h"
 #include "Macros.h"
 #include "ResolutionScaleManager.h"
 #include "SceneTransitionManager.h"
@@ -177,12 +178,46 @@ void WindowManager::ApplyResolution(ResolutionSetting res)
 
     m_window->setVerticalSyncEnabled(m_settings->m_verticleSyncEnabled);
 
-    ResolutionScaleManager::Instance().SetReferenceResolution(ResolutionSetting::Res720p);
-    ResolutionScaleManager::Instance().SetCurrentResolution(m_window->getSize());
+    auto &scaleMgr = ResolutionScaleManager::Instance();
+    const float previousScale = scaleMgr.GetUniformScale();
+
+    scaleMgr.SetReferenceResolution(ResolutionSetting::Res720p);
+    scaleMgr.SetCurrentResolution(m_window->getSize());
+
+    // Every scaled UI font size just changed; warm the new sizes before the UI is rebuilt with them.
+    if (scaleMgr.GetUniformScale() != previousScale)
+    {
+        GlyphCache::Instance().PrewarmUI();
+    }
 
     CT_LOG_INFO("Applied new resolution: {}x{} - vsync: {}", size.x, size.y, m_settings->m_verticleSyncEnabled);
 }
 
+/// @brief Applies video settings that changed on disk. A new resolution recreates the window, as the settings menu
+/// does; vsync and the frame limit are set on the live window. The scene's UI is laid out again on its next change.
+/// @param previous settings before the reload; the current ones are read from the shared Settings.
+void WindowManager::HotReload(const Settings &previous)
+{
+    CT_WARN_IF_UNINITIALIZED("WindowManager", "HotReload");
+
+    if (m_settings->m_resolution != previous.m_resolution)
+    {
+        ApplyResolution(m_settings->m_resolution);
+
+        return;
+    }
+
+    if (m_settings->m_verticleSyncEnabled != previous.m_verticleSyncEnabled)
+    {
+        m_window->setVerticalSyncEnabled(m_settings->m_verticleSyncEnabled);
+    }
+
+    if (m_settings->m_targetFramerate != previous.m_targetFramerate)
+    {
+        m_window->setFramerateLimit(m_settings->m_targetFramerate);
+    }
+}
+
 /// @brief Returns the resolution size for this window.
 /// @param setting ResolutionSettings to help return size of window.
 /// @return Vector2u of {width, height}.
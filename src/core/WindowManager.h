@@ -43,6 +43,7 @@ class WindowManager
     void Recreate(const unsigned int width, const unsigned int height, const std::string &title, sf::Uint32 style);
     void ApplySettings(sf::Uint32 style);
     void ApplyResolution(ResolutionSetting res);
+    void HotReload(const Settings &previous);
     sf::Vector2u GetResolutionSize(ResolutionSetting res) const;
     void SetClearColor(const sf::Color &color);
     void ToggleFullscreen();
@@ -0,0 +1,60 @@
+// ============================================================================
+//  File        : AssetId.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-03
+//  Description : Interned identifiers for assets. An AssetId is a hash of
+//                the asset key that can be computed at compile time, and an
+//                AssetHandle is a dense index into the AssetManager storage.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include "Hash.h"
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string_view>
+
+/// @brief Hashed asset key. Cheap to copy, compare and hash; build it once with MakeAssetId.
+struct AssetId
+{
+    std::uint64_t value = 0;
+
+    constexpr bool operator==(const AssetId &other) const = default;
+};
+
+/// @brief Builds an AssetId from a key. With a literal argument in a constexpr context this costs nothing at runtime.
+/// @param key asset key, e.g. "Default.ttf".
+/// @return AssetId for key.
+constexpr AssetId MakeAssetId(std::string_view key)
+{
+    return AssetId{Fnv1a64(key)};
+}
+
+/// @brief Dense index into AssetManager storage. Valid until the owning cache is cleared.
+struct AssetHandle
+{
+    static constexpr std::uint32_t InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t index = InvalidIndex;
+
+    constexpr bool IsValid() const
+    {
+        return index != InvalidIndex;
+    }
+
+    constexpr bool operator==(const AssetHandle &other) const = default;
+};
+
+/// @brief Lets AssetId key standard unordered containers. The value is already a hash.
+template <> struct std::hash<AssetId>
+{
+    std::size_t operator()(const AssetId &id) const noexcept
+    {
+        return static_cast<std::size_t>(id.value);
+    }
+};
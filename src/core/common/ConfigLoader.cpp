@@ -45,6 +45,7 @@ bool ConfigLoader::LoadFromJson(const std::string &filepath, Settings &settings)
         settings.m_musicVolume = j["audio"]["music_volume"];
         settings.m_sfxVolume = j["audio"]["sfx_volume"];
         settings.m_isMuted = j["audio"]["is_muted"];
+        settings.m_useSoftwareMixer = j["audio"].value("software_mixer", false);
 
         // Video Resolution
         settings.m_resolution = FromStringToResolution(j["video"]["resolution"]);
@@ -80,6 +81,7 @@ bool ConfigLoader::SaveAsJson(const std::string &filepath, const Settings &setti
     j["audio"]["music_volume"] = settings.m_musicVolume;
     j["audio"]["sfx_volume"] = settings.m_sfxVolume;
     j["audio"]["is_muted"] = settings.m_isMuted;
+    j["audio"]["software_mixer"] = settings.m_useSoftwareMixer;
 
     j["video"]["resolution"] = ResolutionSettingToString(settings.m_resolution);
 
@@ -0,0 +1,301 @@
+// ============================================================================
+//  File        : FileWatcher.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-04
+//  Description : Background file change detection used for asset and
+//                config hot reloading. inotify backed on Linux, inert on
+//                other platforms.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "FileWatcher.h"
+#include "Macros.h"
+#include <filesystem>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+#if defined(__linux__)
+/// @brief Events that mean "the file now has new content". IN_MOVED_TO covers editors that save via rename.
+constexpr uint32_t WATCH_MASK = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+
+/// @brief How long the watcher thread blocks in poll() before re-checking the stop flag.
+constexpr int POLL_TIMEOUT_MS = 100;
+#endif
+} // namespace
+
+/// @brief Destructor for the FileWatcher, joins the watcher thread if still running.
+FileWatcher::~FileWatcher()
+{
+    Stop();
+}
+
+/// @brief Returns whether this platform has a FileWatcher backend.
+/// @return true / false
+bool FileWatcher::IsSupported()
+{
+#if defined(__linux__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+/// @brief Begins watching the given paths. Directories are watched recursively, files individually.
+/// @param paths Collection of directories and files to watch.
+/// @return true if the watcher thread started.
+bool FileWatcher::Start(const std::vector<std::string> &paths)
+{
+    if (m_isRunning)
+    {
+        return true;
+    }
+
+#if defined(__linux__)
+    m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if (m_fd < 0)
+    {
+        CT_LOG_WARN("FileWatcher: inotify_init1 failed, hot reload disabled.");
+
+        return false;
+    }
+
+    for (const auto &path : paths)
+    {
+        std::error_code ec;
+
+        if (std::filesystem::is_directory(path, ec))
+        {
+            AddDirectory(path, true);
+        }
+        else
+        {
+            AddFile(path);
+        }
+    }
+
+    if (m_watches.empty())
+    {
+        close(m_fd);
+        m_fd = -1;
+
+        CT_LOG_WARN("FileWatcher: nothing to watch, hot reload disabled.");
+
+        return false;
+    }
+
+    m_isRunning = true;
+    m_thread = std::thread(&FileWatcher::Run, this);
+
+    CT_LOG_INFO("FileWatcher started with {} watch descriptors.", m_watches.size());
+
+    return true;
+#else
+    CT_LOG_INFO("FileWatcher: not supported on this platform, hot reload disabled.");
+
+    return false;
+#endif
+}
+
+/// @brief Stops the watcher thread and releases every watch.
+void FileWatcher::Stop()
+{
+    if (!m_isRunning)
+    {
+        return;
+    }
+
+    m_isRunning = false;
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+#if defined(__linux__)
+    close(m_fd);
+    m_fd = -1;
+#endif
+
+    m_watches.clear();
+
+    CT_LOG_INFO("FileWatcher stopped.");
+}
+
+/// @brief Returns whether the watcher thread is active.
+/// @return m_isRunning.
+bool FileWatcher::IsRunning() const
+{
+    return m_isRunning;
+}
+
+/// @brief Hands every path changed since the last call to the caller, oldest first, each path at most once.
+/// @return changed paths.
+std::vector<std::string> FileWatcher::ConsumeChanges()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::vector<std::string> changes;
+    changes.swap(m_pending);
+    m_pendingSet.clear();
+
+    return changes;
+}
+
+/// @brief Adds a watch on a directory, and optionally on every directory beneath it.
+/// @param directory directory to watch.
+/// @param recursive whether to descend into subdirectories.
+/// @return true if at least the top directory is watched.
+bool FileWatcher::AddDirectory(const std::string &directory, bool recursive)
+{
+#if defined(__linux__)
+    const int wd = inotify_add_watch(m_fd, directory.c_str(), WATCH_MASK);
+
+    if (wd < 0)
+    {
+        CT_LOG_WARN("FileWatcher: failed to watch directory '{}'.", directory);
+
+        return false;
+    }
+
+    WatchTarget &target = m_watches[wd];
+    target.directory = directory;
+    target.recursive = target.recursive || recursive;
+    target.allFiles = true;
+
+    if (recursive)
+    {
+        std::error_code ec;
+
+        for (const auto &entry : std::filesystem::directory_iterator(directory, ec))
+        {
+            if (entry.is_directory(ec))
+            {
+                AddDirectory(entry.path().generic_string(), true);
+            }
+        }
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+/// @brief Adds a watch for a single file. The parent directory is watched, since editors often replace files.
+/// @param filepath file to watch.
+/// @return true / false
+bool FileWatcher::AddFile(const std::string &filepath)
+{
+#if defined(__linux__)
+    const std::filesystem::path path(filepath);
+    const std::string directory = path.has_parent_path() ? path.parent_path().generic_string() : ".";
+
+    const int wd = inotify_add_watch(m_fd, directory.c_str(), WATCH_MASK);
+
+    if (wd < 0)
+    {
+        CT_LOG_WARN("FileWatcher: failed to watch file '{}'.", filepath);
+
+        return false;
+    }
+
+    WatchTarget &target = m_watches[wd];
+    target.directory = directory;
+    target.files.insert(path.filename().string());
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+/// @brief Watcher thread body, waits for inotify events until stopped.
+void FileWatcher::Run()
+{
+#if defined(__linux__)
+    pollfd descriptor{m_fd, POLLIN, 0};
+
+    while (m_isRunning)
+    {
+        const int ready = poll(&descriptor, 1, POLL_TIMEOUT_MS);
+
+        if (ready > 0 && (descriptor.revents & POLLIN))
+        {
+            HandleEvents();
+        }
+    }
+#endif
+}
+
+/// @brief Drains the inotify descriptor, recording changed files and following newly created directories.
+void FileWatcher::HandleEvents()
+{
+#if defined(__linux__)
+    alignas(inotify_event) char buffer[4096];
+
+    while (true)
+    {
+        const ssize_t length = read(m_fd, buffer, sizeof(buffer));
+
+        if (length <= 0)
+        {
+            return;
+        }
+
+        for (ssize_t offset = 0; offset < length;)
+        {
+            const auto *event = reinterpret_cast<const inotify_event *>(buffer + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+            auto it = m_watches.find(event->wd);
+
+            if (it == m_watches.end() || event->len == 0)
+            {
+                continue;
+            }
+
+            const WatchTarget &target = it->second;
+            const std::string name = event->name;
+            const std::string fullPath = target.directory + "/" + name;
+
+            if (event->mask & IN_ISDIR)
+            {
+                if (target.recursive)
+                {
+                    AddDirectory(fullPath, true);
+                }
+
+                continue;
+            }
+
+            // IN_CREATE alone means an empty file; its content arrives with the following IN_CLOSE_WRITE.
+            if ((event->mask & IN_CREATE) && !(event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)))
+            {
+                continue;
+            }
+
+            if (!target.allFiles && !target.files.contains(name))
+            {
+                continue;
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (m_pendingSet.insert(fullPath).second)
+            {
+                m_pending.push_back(fullPath);
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,77 @@
+// ============================================================================
+//  File        : FileWatcher.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-04
+//  Description : Background file change detection used for asset and
+//                config hot reloading. inotify backed on Linux, inert on
+//                other platforms.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// ============================================================================
+//  Class       : FileWatcher
+//  Purpose     : Watches directories (recursively) and single files for
+//                writes, collecting the changed paths on a worker thread.
+//
+//  Responsibilities:
+//      - Starts and stops the watcher thread
+//      - Coalesces repeated notifications for the same path
+//      - Hands the changed paths to the main thread on request
+//
+// ============================================================================
+class FileWatcher
+{
+  public:
+    FileWatcher() = default;
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher &) = delete;
+    FileWatcher &operator=(const FileWatcher &) = delete;
+
+    static bool IsSupported();
+
+    bool Start(const std::vector<std::string> &paths);
+    void Stop();
+    bool IsRunning() const;
+
+    std::vector<std::string> ConsumeChanges();
+
+  private:
+    /// @brief What a single watch descriptor is responsible for.
+    struct WatchTarget
+    {
+        std::string directory;
+        bool recursive = false;
+        bool allFiles = false;
+        std::unordered_set<std::string> files;
+    };
+
+    bool AddDirectory(const std::string &directory, bool recursive);
+    bool AddFile(const std::string &filepath);
+    void Run();
+    void HandleEvents();
+
+  private:
+    int m_fd = -1;
+    std::thread m_thread;
+    std::atomic<bool> m_isRunning = false;
+
+    std::unordered_map<int, WatchTarget> m_watches;
+
+    std::mutex m_mutex;
+    std::vector<std::string> m_pending;
+    std::unordered_set<std::string> m_pendingSet;
+};
@@ -0,0 +1,57 @@
+// ============================================================================
+//  File        : Hash.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-02
+//  Description : Small, dependency free hashing helpers shared by the
+//                asset caches and identifiers.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/// @brief FNV-1a 64 bit offset basis.
+constexpr std::uint64_t CT_FNV1A_OFFSET_BASIS = 14695981039346656037ull;
+
+/// @brief FNV-1a 64 bit prime.
+constexpr std::uint64_t CT_FNV1A_PRIME = 1099511628211ull;
+
+/// @brief Hashes a string with FNV-1a. Usable in constant expressions.
+/// @param text characters to hash.
+/// @return 64 bit FNV-1a digest.
+constexpr std::uint64_t Fnv1a64(std::string_view text)
+{
+    std::uint64_t hash = CT_FNV1A_OFFSET_BASIS;
+
+    for (const char c : text)
+    {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= CT_FNV1A_PRIME;
+    }
+
+    return hash;
+}
+
+/// @brief Hashes a block of raw memory with FNV-1a.
+/// @param data pointer to the first byte.
+/// @param size number of bytes to hash.
+/// @return 64 bit FNV-1a digest.
+inline std::uint64_t Fnv1a64(const void *data, std::size_t size)
+{
+    const auto *bytes = static_cast<const std::uint8_t *>(data);
+    std::uint64_t hash = CT_FNV1A_OFFSET_BASIS;
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= CT_FNV1A_PRIME;
+    }
+
+    return hash;
+}
@@ -0,0 +1,209 @@
+// ============================================================================
+//  File        : MappedFile.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-09
+//  Description : Read only memory mapping of a whole file, using mmap on
+//                POSIX and file mapping objects on Windows.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "MappedFile.h"
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/// @brief Unmaps the file, if one is open.
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+/// @brief Takes over another mapping, leaving it closed.
+/// @param other mapping to move from.
+MappedFile::MappedFile(MappedFile &&other) noexcept
+{
+    *this = std::move(other);
+}
+
+/// @brief Closes this mapping and takes over another, leaving it closed.
+/// @param other mapping to move from.
+/// @return *this
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+        m_isOpen = std::exchange(other.m_isOpen, false);
+        m_fileHandle = std::exchange(other.m_fileHandle, nullptr);
+        m_mappingHandle = std::exchange(other.m_mappingHandle, nullptr);
+    }
+
+    return *this;
+}
+
+/// @brief Maps a whole file read only, closing any previous mapping first. An empty file opens with no data.
+/// @param filepath file to map.
+/// @return true / false
+bool MappedFile::Open(const std::string &filepath)
+{
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+
+    if (!GetFileSizeEx(file, &size))
+    {
+        CloseHandle(file);
+
+        return false;
+    }
+
+    m_fileHandle = file;
+    m_size = static_cast<std::size_t>(size.QuadPart);
+    m_isOpen = true;
+
+    if (m_size == 0)
+    {
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void *view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+    m_mappingHandle = mapping;
+
+    if (!view)
+    {
+        Close();
+
+        return false;
+    }
+
+    m_data = static_cast<const std::uint8_t *>(view);
+#else
+    const int descriptor = ::open(filepath.c_str(), O_RDONLY);
+
+    if (descriptor < 0)
+    {
+        return false;
+    }
+
+    struct stat info;
+
+    if (::fstat(descriptor, &info) != 0)
+    {
+        ::close(descriptor);
+
+        return false;
+    }
+
+    m_size = static_cast<std::size_t>(info.st_size);
+    m_isOpen = true;
+
+    if (m_size > 0)
+    {
+        void *view = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+        if (view == MAP_FAILED)
+        {
+            ::close(descriptor);
+            Reset();
+
+            return false;
+        }
+
+        m_data = static_cast<const std::uint8_t *>(view);
+    }
+
+    // The mapping keeps the file alive on its own.
+    ::close(descriptor);
+#endif
+
+    return true;
+}
+
+/// @brief Unmaps the file. Safe to call when nothing is open.
+void MappedFile::Close()
+{
+#ifdef _WIN32
+    if (m_data)
+    {
+        UnmapViewOfFile(m_data);
+    }
+
+    if (m_mappingHandle)
+    {
+        CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+    }
+
+    if (m_fileHandle)
+    {
+        CloseHandle(static_cast<HANDLE>(m_fileHandle));
+    }
+#else
+    if (m_data)
+    {
+        ::munmap(const_cast<std::uint8_t *>(m_data), m_size);
+    }
+#endif
+
+    Reset();
+}
+
+/// @brief Returns whether a file is mapped.
+/// @return m_isOpen.
+bool MappedFile::IsOpen() const
+{
+    return m_isOpen;
+}
+
+/// @brief Returns the first byte of the mapping.
+/// @return pointer valid until Close, nullptr for an empty file.
+const std::uint8_t *MappedFile::Data() const
+{
+    return m_data;
+}
+
+/// @brief Returns the size of the mapped file.
+/// @return size in bytes.
+std::size_t MappedFile::Size() const
+{
+    return m_size;
+}
+
+/// @brief Forgets the mapping without releasing it.
+void MappedFile::Reset()
+{
+    m_data = nullptr;
+    m_size = 0;
+    m_isOpen = false;
+    m_fileHandle = nullptr;
+    m_mappingHandle = nullptr;
+}
@@ -0,0 +1,59 @@
+// ============================================================================
+//  File        : MappedFile.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-09
+//  Description : Read only memory mapping of a whole file, using mmap on
+//                POSIX and file mapping objects on Windows.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// ============================================================================
+//  Class       : MappedFile
+//  Purpose     : Owns a read only view of a file's contents.
+//
+//  Responsibilities:
+//      - Maps the whole file on Open, unmaps on Close or destruction
+//      - Lets the OS page the contents in on demand, with no extra copy
+//      - Can be moved but not copied
+//
+// ============================================================================
+class MappedFile
+{
+  public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    bool Open(const std::string &filepath);
+    void Close();
+
+    bool IsOpen() const;
+    const std::uint8_t *Data() const;
+    std::size_t Size() const;
+
+  private:
+    void Reset();
+
+  private:
+    const std::uint8_t *m_data = nullptr;
+    std::size_t m_size = 0;
+    bool m_isOpen = false;
+
+    /// @brief Win32 file and mapping handles; unused on POSIX, where the descriptor is closed right after mmap.
+    void *m_fileHandle = nullptr;
+    void *m_mappingHandle = nullptr;
+};
@@ -0,0 +1,96 @@
+// ============================================================================
+//  File        : SpscQueue.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-16
+//  Description : Bounded lock free queue for exactly one producer thread and
+//                one consumer thread, such as game thread to audio thread.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+// ============================================================================
+//  Class       : SpscQueue
+//  Purpose     : Ring buffer of Capacity slots, one of which is always kept
+//                free to tell a full queue from an empty one.
+//
+//  Responsibilities:
+//      - Push from the producer thread only, Pop from the consumer only
+//      - Never blocks and never allocates after construction
+//      - Keeps head and tail on separate cache lines
+//
+// ============================================================================
+template <typename T, std::size_t Capacity> class SpscQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two.");
+
+  public:
+    /// @brief Appends a value. Producer thread only.
+    /// @param value moved from only when the push succeeds.
+    /// @return false if the queue is full.
+    bool Push(T &&value)
+    {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        const std::size_t next = (tail + 1) & MASK;
+
+        if (next == m_head.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        m_slots[tail] = std::move(value);
+        m_tail.store(next, std::memory_order_release);
+
+        return true;
+    }
+
+    /// @brief Removes the oldest value. Consumer thread only.
+    /// @param value receives the value.
+    /// @return false if the queue is empty.
+    bool Pop(T &value)
+    {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+
+        if (head == m_tail.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        value = std::move(m_slots[head]);
+        m_head.store((head + 1) & MASK, std::memory_order_release);
+
+        return true;
+    }
+
+    /// @brief Returns whether the queue looked empty at the time of the call. Either thread.
+    /// @return true / false
+    bool IsEmpty() const
+    {
+        return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+    }
+
+    /// @brief Returns how many values the queue can hold at once.
+    /// @return Capacity - 1.
+    static constexpr std::size_t GetCapacity()
+    {
+        return Capacity - 1;
+    }
+
+  private:
+    static constexpr std::size_t MASK = Capacity - 1;
+
+    /// @brief Typical cache line size; keeps the two threads from invalidating each other's index.
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    std::array<T, Capacity> m_slots;
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_head{0};
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_tail{0};
+};
@@ -0,0 +1,291 @@
+// ============================================================================
+//  File        : StartupGraph.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-07
+//  Description : Declarative dependency graph for startup work. Tasks run
+//                as soon as their dependencies finish, on a worker thread
+//                or on the main thread depending on their affinity.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "StartupGraph.h"
+#include "Macros.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <mutex>
+
+namespace
+{
+/// @brief Returned by FindTask when no task has the requested name.
+constexpr std::size_t INVALID_TASK = std::numeric_limits<std::size_t>::max();
+
+/// @brief Milliseconds elapsed since start.
+/// @param start reference point.
+/// @return milliseconds.
+double MillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+} // namespace
+
+/// @brief Declares a task. Dependencies may be declared in any order, they are resolved when the graph runs.
+/// @param name unique task name.
+/// @param affinity MainThread for window / GL bound work, Worker for everything else.
+/// @param dependencies names of the tasks that must succeed first.
+/// @param func the work; returning false skips every task that depends on it.
+/// @return false if the name is already taken.
+bool StartupGraph::Add(const std::string &name, StartupAffinity affinity, std::vector<std::string> dependencies,
+                       TaskFunc func)
+{
+    if (FindTask(name) != INVALID_TASK)
+    {
+        CT_LOG_ERROR("StartupGraph: task '{}' declared twice.", name);
+
+        return false;
+    }
+
+    Task task;
+    task.name = name;
+    task.affinity = affinity;
+    task.dependencies = std::move(dependencies);
+    task.func = std::move(func);
+
+    m_tasks.push_back(std::move(task));
+
+    return true;
+}
+
+/// @brief Runs every task. Main thread tasks run on the caller, worker tasks on pool, each as soon as all of its
+/// dependencies have finished. Returns once every task has run or been skipped.
+/// @param pool workers for Worker affinity tasks.
+/// @return true if every task succeeded.
+bool StartupGraph::Run(ThreadPool &pool)
+{
+    if (!Resolve())
+    {
+        return false;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    m_timings.assign(m_tasks.size(), {});
+
+    std::mutex mutex;
+    std::condition_variable workerFinished;
+    std::deque<std::pair<std::size_t, bool>> finishedOnWorkers;
+    std::deque<std::size_t> mainReady;
+
+    std::size_t finishedCount = 0;
+    bool allSucceeded = true;
+
+    const auto execute = [&](std::size_t index)
+    {
+        StartupTaskTiming &timing = m_timings[index];
+        timing.startMs = MillisecondsSince(start);
+        timing.succeeded = m_tasks[index].func();
+        timing.endMs = MillisecondsSince(start);
+
+        return timing.succeeded;
+    };
+
+    std::function<void(std::size_t, bool)> complete;
+
+    const auto dispatch = [&](std::size_t index)
+    {
+        Task &task = m_tasks[index];
+        m_timings[index].name = task.name;
+        m_timings[index].affinity = task.affinity;
+
+        if (task.hasFailedDependency)
+        {
+            CT_LOG_WARN("StartupGraph: skipping '{}', a dependency failed.", task.name);
+
+            m_timings[index].wasSkipped = true;
+            complete(index, false);
+        }
+        else if (task.affinity == StartupAffinity::MainThread)
+        {
+            mainReady.push_back(index);
+        }
+        else
+        {
+            pool.Submit(
+                [&, index]()
+                {
+                    const bool succeeded = execute(index);
+
+                    // Notify under the lock: Run may return, destroying these locals, as soon as it is released.
+                    std::lock_guard<std::mutex> lock(mutex);
+                    finishedOnWorkers.emplace_back(index, succeeded);
+                    workerFinished.notify_one();
+                });
+        }
+    };
+
+    complete = [&](std::size_t index, bool succeeded)
+    {
+        ++finishedCount;
+        allSucceeded = allSucceeded && succeeded;
+
+        if (!succeeded && !m_timings[index].wasSkipped)
+        {
+            CT_LOG_ERROR("StartupGraph: task '{}' failed.", m_tasks[index].name);
+        }
+
+        for (const std::size_t dependent : m_tasks[index].dependents)
+        {
+            Task &task = m_tasks[dependent];
+            task.hasFailedDependency = task.hasFailedDependency || !succeeded;
+
+            if (--task.pendingDependencies == 0)
+            {
+                dispatch(dependent);
+            }
+        }
+    };
+
+    for (std::size_t i = 0; i < m_tasks.size(); ++i)
+    {
+        if (m_tasks[i].pendingDependencies == 0)
+        {
+            dispatch(i);
+        }
+    }
+
+    while (finishedCount < m_tasks.size())
+    {
+        if (!mainReady.empty())
+        {
+            const std::size_t index = mainReady.front();
+            mainReady.pop_front();
+            complete(index, execute(index));
+
+            continue;
+        }
+
+        std::deque<std::pair<std::size_t, bool>> finished;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            workerFinished.wait(lock, [&]() { return !finishedOnWorkers.empty(); });
+            finished.swap(finishedOnWorkers);
+        }
+
+        for (const auto &[index, succeeded] : finished)
+        {
+            complete(index, succeeded);
+        }
+    }
+
+    return allSucceeded;
+}
+
+/// @brief Returns the timings of the last Run, in declaration order.
+/// @return m_timings.
+const std::vector<StartupTaskTiming> &StartupGraph::GetTimings() const
+{
+    return m_timings;
+}
+
+/// @brief Writes one line per task with its thread, start and duration.
+void StartupGraph::LogTimings() const
+{
+    for (const auto &timing : m_timings)
+    {
+        CT_LOG_INFO("StartupGraph: {:<14} {:<6} start {:8.2f} ms, took {:8.2f} ms{}", timing.name,
+                    timing.affinity == StartupAffinity::MainThread ? "main" : "worker", timing.startMs,
+                    timing.endMs - timing.startMs,
+                    timing.wasSkipped ? " (skipped)" : (timing.succeeded ? "" : " (failed)"));
+    }
+}
+
+/// @brief Links every task to its dependents and checks the graph can finish.
+/// @return false on an unknown dependency or a cycle.
+bool StartupGraph::Resolve()
+{
+    for (auto &task : m_tasks)
+    {
+        task.dependents.clear();
+        task.pendingDependencies = task.dependencies.size();
+        task.hasFailedDependency = false;
+    }
+
+    for (std::size_t i = 0; i < m_tasks.size(); ++i)
+    {
+        for (const auto &dependency : m_tasks[i].dependencies)
+        {
+            const std::size_t index = FindTask(dependency);
+
+            if (index == INVALID_TASK)
+            {
+                CT_LOG_ERROR("StartupGraph: '{}' depends on unknown task '{}'.", m_tasks[i].name, dependency);
+
+                return false;
+            }
+
+            m_tasks[index].dependents.push_back(i);
+        }
+    }
+
+    // Kahn's algorithm: if a topological walk cannot reach every task, some of them wait on each other.
+    std::vector<std::size_t> pending(m_tasks.size());
+    std::deque<std::size_t> ready;
+    std::size_t reached = 0;
+
+    for (std::size_t i = 0; i < m_tasks.size(); ++i)
+    {
+        pending[i] = m_tasks[i].pendingDependencies;
+
+        if (pending[i] == 0)
+        {
+            ready.push_back(i);
+        }
+    }
+
+    while (!ready.empty())
+    {
+        const std::size_t index = ready.front();
+        ready.pop_front();
+        ++reached;
+
+        for (const std::size_t dependent : m_tasks[index].dependents)
+        {
+            if (--pending[dependent] == 0)
+            {
+                ready.push_back(dependent);
+            }
+        }
+    }
+
+    if (reached != m_tasks.size())
+    {
+        CT_LOG_ERROR("StartupGraph: dependency cycle between {} tasks.", m_tasks.size() - reached);
+
+        return false;
+    }
+
+    return true;
+}
+
+/// @brief Looks a task up by name.
+/// @param name task name.
+/// @return index into m_tasks, or INVALID_TASK.
+std::size_t StartupGraph::FindTask(const std::string &name) const
+{
+    for (std::size_t i = 0; i < m_tasks.size(); ++i)
+    {
+        if (m_tasks[i].name == name)
+        {
+            return i;
+        }
+    }
+
+    return INVALID_TASK;
+}
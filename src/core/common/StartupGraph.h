@@ -0,0 +1,85 @@
+// ============================================================================
+//  File        : StartupGraph.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-07
+//  Description : Declarative dependency graph for startup work. Tasks run
+//                as soon as their dependencies finish, on a worker thread
+//                or on the main thread depending on their affinity.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include "ThreadPool.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+/// @brief Where a startup task is allowed to run.
+enum class StartupAffinity
+{
+    MainThread,
+    Worker,
+};
+
+/// @brief When a startup task ran, relative to the start of StartupGraph::Run.
+struct StartupTaskTiming
+{
+    std::string name;
+    StartupAffinity affinity = StartupAffinity::MainThread;
+    double startMs = 0.0;
+    double endMs = 0.0;
+    bool succeeded = false;
+    bool wasSkipped = false;
+};
+
+// ============================================================================
+//  Class       : StartupGraph
+//  Purpose     : Runs named tasks in dependency order, as concurrently as
+//                their dependencies and affinities allow.
+//
+//  Responsibilities:
+//      - Validates that every dependency exists and there are no cycles
+//      - Keeps GL and window bound tasks on the calling (main) thread
+//      - Hands every other ready task to a ThreadPool
+//      - Skips the dependents of a failed task
+//      - Records per task timings
+//
+// ============================================================================
+class StartupGraph
+{
+  public:
+    using TaskFunc = std::function<bool()>;
+
+    bool Add(const std::string &name, StartupAffinity affinity, std::vector<std::string> dependencies,
+             TaskFunc func);
+
+    bool Run(ThreadPool &pool);
+
+    const std::vector<StartupTaskTiming> &GetTimings() const;
+    void LogTimings() const;
+
+  private:
+    /// @brief A task and its position in the graph.
+    struct Task
+    {
+        std::string name;
+        StartupAffinity affinity = StartupAffinity::MainThread;
+        std::vector<std::string> dependencies;
+        TaskFunc func;
+
+        std::vector<std::size_t> dependents;
+        std::size_t pendingDependencies = 0;
+        bool hasFailedDependency = false;
+    };
+
+    bool Resolve();
+    std::size_t FindTask(const std::string &name) const;
+
+  private:
+    std::vector<Task> m_tasks;
+    std::vector<StartupTaskTiming> m_timings;
+};
@@ -0,0 +1,116 @@
+// ============================================================================
+//  File        : ThreadPool.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-07
+//  Description : Small fixed size worker pool for background jobs such as
+//                startup work and asset decoding.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "ThreadPool.h"
+#include <algorithm>
+
+/// @brief Starts the worker threads.
+/// @param threadCount number of workers, at least one is always started.
+ThreadPool::ThreadPool(std::size_t threadCount)
+{
+    const std::size_t count = std::max<std::size_t>(1, threadCount);
+    m_workers.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        m_workers.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+}
+
+/// @brief Finishes every queued job, then joins the workers.
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+
+    m_jobAvailable.notify_all();
+
+    for (auto &worker : m_workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+}
+
+/// @brief Returns a worker count that leaves one hardware thread for the main thread.
+/// @return at least 1.
+std::size_t ThreadPool::DefaultThreadCount()
+{
+    const unsigned int hardware = std::thread::hardware_concurrency();
+
+    return hardware > 1 ? hardware - 1 : 1;
+}
+
+/// @brief Queues a job for the next free worker.
+/// @param job work to run off the calling thread.
+void ThreadPool::Submit(std::function<void()> job)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.push_back(std::move(job));
+    }
+
+    m_jobAvailable.notify_one();
+}
+
+/// @brief Blocks until the queue is empty and no job is running.
+void ThreadPool::WaitIdle()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this]() { return m_jobs.empty() && m_activeJobs == 0; });
+}
+
+/// @brief Returns the number of worker threads.
+/// @return m_workers.size().
+std::size_t ThreadPool::GetThreadCount() const
+{
+    return m_workers.size();
+}
+
+/// @brief Worker body: takes jobs until the pool is stopping and the queue is drained.
+void ThreadPool::WorkerLoop()
+{
+    while (true)
+    {
+        std::function<void()> job;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_jobAvailable.wait(lock, [this]() { return m_isStopping || !m_jobs.empty(); });
+
+            if (m_jobs.empty())
+            {
+                return;
+            }
+
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+            ++m_activeJobs;
+        }
+
+        job();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_activeJobs;
+
+            if (m_jobs.empty() && m_activeJobs == 0)
+            {
+                m_idle.notify_all();
+            }
+        }
+    }
+}
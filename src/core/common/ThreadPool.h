@@ -0,0 +1,61 @@
+// ============================================================================
+//  File        : ThreadPool.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-07
+//  Description : Small fixed size worker pool for background jobs such as
+//                startup work and asset decoding.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+//  Class       : ThreadPool
+//  Purpose     : Runs submitted jobs on a fixed set of worker threads.
+//
+//  Responsibilities:
+//      - Starts its workers on construction, joins them on destruction
+//      - Runs jobs in submission order, as workers become free
+//      - Finishes every queued job before shutting down
+//
+// ============================================================================
+class ThreadPool
+{
+  public:
+    explicit ThreadPool(std::size_t threadCount = DefaultThreadCount());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    static std::size_t DefaultThreadCount();
+
+    void Submit(std::function<void()> job);
+    void WaitIdle();
+    std::size_t GetThreadCount() const;
+
+  private:
+    void WorkerLoop();
+
+  private:
+    std::vector<std::thread> m_workers;
+    std::deque<std::function<void()>> m_jobs;
+
+    std::mutex m_mutex;
+    std::condition_variable m_jobAvailable;
+    std::condition_variable m_idle;
+
+    std::size_t m_activeJobs = 0;
+    bool m_isStopping = false;
+};
@@ -11,9 +11,18 @@
 
 #pragma once
 
+#include "AssetId.h"
 #include <SFML/Graphics.hpp>
+#include <array>
 #include <string>
 
+// ============================================================================
+// Assets:
+// ============================================================================
+
+/// @brief Interned key of the font every UI element is created with.
+constexpr AssetId DEFAULT_FONT_ID = MakeAssetId("Default.ttf");
+
 // ============================================================================
 // Titles:
 // ============================================================================
@@ -67,6 +76,9 @@ const sf::Color BUTTON_DEFAULT_DISABLED_TEXT_COLOR = sf::Color(200, 200, 200);
 /// @brief Default button font size.
 constexpr unsigned int BUTTON_DEFAULT_FONT_SIZE = 24;
 
+/// @brief Unscaled font size of factory built buttons and selectable buttons.
+constexpr unsigned int BASE_BUTTON_FONT_SIZE = 18;
+
 /// @brief Main Menu button width in pixels.
 constexpr float MAIN_MENU_BUTTON_WIDTH_PIXEL = 180.f;
 
@@ -116,6 +128,9 @@ constexpr float BASE_SLIDER_SPACING_PERCENT = .05f;
 /// @brief Generic slider width in relative screen sizing, 45%.
 constexpr float BASE_SLIDER_WIDTH_PERCENT = .45f;
 
+/// @brief Unscaled font size of factory built slider labels.
+constexpr unsigned int BASE_SLIDER_FONT_SIZE = 14;
+
 /// @brief Generic slider knob radius for default constructing.
 constexpr float BASE_SLIDER_KNOB_RADIUS = 6.f;
 
@@ -172,6 +187,9 @@ constexpr float TOAST_DEFAULT_DRIFT_PERCENTAGE = .05f;
 /// @brief General use default color for a toast message.
 const sf::Color TOAST_DEFAULT_COLOR(102, 255, 102);
 
+/// @brief Unscaled font size of factory built toast messages.
+constexpr unsigned int BASE_TOAST_FONT_SIZE = 18;
+
 // ============================================================================
 // Generic Arrow uses:
 // ============================================================================
@@ -187,3 +205,18 @@ constexpr float DEFAULT_ARROW_RIGHT_CENTER_PERCENT = .95f;
 
 /// @brief Default relative space from left boundary for an Arrow, 5%.
 constexpr float DEFAULT_ARROW_BOTTOM_CENTER_PERCENT = .95f;
+
+// ============================================================================
+// Glyph prewarm:
+// ============================================================================
+
+/// @brief First code point of the UI charset (space).
+constexpr sf::Uint32 UI_CHARSET_FIRST = 32;
+
+/// @brief Last code point of the UI charset (tilde), printable ASCII only.
+constexpr sf::Uint32 UI_CHARSET_LAST = 126;
+
+/// @brief Every unscaled size the UI requests from the default font, scaled by ScaleFont before prewarming.
+constexpr std::array<unsigned int, 5> UI_PREWARM_BASE_FONT_SIZES = {BASE_SLIDER_FONT_SIZE, BASE_BUTTON_FONT_SIZE,
+                                                                    BASE_GROUPBOX_FONT_SIZE, BUTTON_DEFAULT_FONT_SIZE,
+                                                                    DEFAULT_TITLE_FONT_SIZE};
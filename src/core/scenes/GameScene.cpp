@@ -12,13 +12,22 @@
 #include "GameScene.h"
 #include "AssetManager.h"
 #include "AudioManager.h"
+#include "GameAssets.h"
+#include "GlyphCache.h"
 #include "InputManager.h"
 #include "Macros.h"
 #include "MainMenuScene.h"
 #include "SceneFactory.h"
 #include "SceneManager.h"
+#include "UIPresets.h"
 #include "WindowManager.h"
 
+namespace
+{
+/// @brief Character size of the in game hint text.
+constexpr unsigned int HINT_FONT_SIZE = 24;
+} // namespace
+
 GameScene::GameScene(std::shared_ptr<Settings> settings) : m_settings(settings)
 {
 }
@@ -29,9 +38,22 @@ void GameScene::Init()
     CF_EXIT_EARLY_IF_ALREADY_INITIALIZED();
 
     // Load assets, music, and scene-specific setup
+    LoadRequiredAssets();
     AudioManager::Instance().SetMasterVolume(50.f);
-    AudioManager::Instance().PlayMusic(m_settings->m_audioDirectory + "Gametrack.wav", true);
-    InputManager::Instance().BindKey("MenuSelectBack", m_settings->m_keyBindings["MenuSelectBack"]);
+    AudioManager::Instance().SwitchTrack(AudioManager::Instance().GetEventTrack(GameAssets::GameSongId), true);
+    m_backAction = InputManager::Instance().BindKey("MenuSelectBack", m_settings->m_keyBindings["MenuSelectBack"]);
+
+    // Positional sound effects are heard from the camera; everything it cannot see is culled.
+    const sf::View &view = WindowManager::Instance().GetWindow().getView();
+    AudioManager::Instance().SetListener(view.getCenter(), view.getSize());
+
+    // Resolve once, so Render is a single array index per frame.
+    m_fontHandle = AssetManager::Instance().GetFontHandle(DEFAULT_FONT_ID);
+
+    if (const sf::Font *font = AssetManager::Instance().GetFont(m_fontHandle))
+    {
+        GlyphCache::Instance().Prewarm(*font, {HINT_FONT_SIZE});
+    }
 
     m_isInitialized = true;
     CT_LOG_INFO("GameScene initialized.");
@@ -39,6 +61,16 @@ void GameScene::Init()
 
 void GameScene::LoadRequiredAssets()
 {
+    // Event sounds are preloaded with the event data; only check that everything this scene fires is there.
+    for (const char *event : GameAssets::Events)
+    {
+        if (!AudioManager::Instance().GetEventHandle(MakeAssetId(event)).IsValid())
+        {
+            CT_LOG_ERROR("GameScene::LoadRequiredAssets missing audio event: {}", event);
+        }
+    }
+
+    CT_LOG_INFO("GameScene finished LoadRequiredAssets.");
 }
 
 // Shuts down this scene and resets internal state.
@@ -71,7 +103,7 @@ void GameScene::OnExit()
 // Performs internal state management during a single frame.
 void GameScene::Update(float dt)
 {
-    if (InputManager::Instance().IsKeyJustReleased("MenuSelectBack"))
+    if (InputManager::Instance().IsKeyJustReleased(m_backAction))
     {
         AudioManager::Instance().StopMusic(true, 1.0f);
         m_shouldExit = true;
@@ -98,7 +130,8 @@ void GameScene::HandleEvent(const sf::Event &event)
 
 void GameScene::OnResize(const sf::Vector2u &newSize)
 {
-    // intentionally blank for now.
+    const sf::View &view = WindowManager::Instance().GetWindow().getView();
+    AudioManager::Instance().SetListener(view.getCenter(), view.getSize());
 }
 
 // While this scene is active, render the necessary components to the Game Scene.
@@ -107,13 +140,20 @@ void GameScene::Render()
     CT_WARN_IF_UNINITIALIZED("GameScene", "Render");
 
     sf::RenderWindow &window = WindowManager::Instance().GetWindow();
+    sf::Font *font = AssetManager::Instance().GetFont(m_fontHandle);
+
+    if (!font)
+    {
+        return;
+    }
 
     sf::Text text;
     text.setString("Game Scene - Press [Space] to return to Menu");
-    text.setCharacterSize(24);
+    text.setCharacterSize(HINT_FONT_SIZE);
     text.setFillColor(sf::Color::Green);
-    text.setFont(*AssetManager::Instance().GetFont("Default"));
+    text.setFont(*font);
     text.setPosition(80.f, 80.f);
+    GlyphCache::Instance().Track(text);
 
     window.draw(text);
 }
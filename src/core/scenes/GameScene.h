@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include "AssetId.h"
+#include "InputManager.h"
 #include "Scene.h"
 #include "Settings.h"
 #include <memory>
@@ -49,4 +51,6 @@ class GameScene final : public Scene
 
   private:
     std::shared_ptr<Settings> m_settings;
+    AssetHandle m_fontHandle;
+    InputActionId m_backAction;
 };
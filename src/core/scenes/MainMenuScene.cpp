@@ -12,6 +12,8 @@
 #include "MainMenuScene.h"
 #include "AssetManager.h"
 #include "AudioManager.h"
+#include "GameAssets.h"
+#include "GlyphCache.h"
 #include "InputManager.h"
 #include "Macros.h"
 #include "MainMenuAssets.h"
@@ -62,7 +64,7 @@ void MainMenuScene::LoadRequiredAssets()
 
     for (const auto &[key, path] : MainMenuAssets::Textures)
     {
-        if (!assets.LoadTexture(key, path))
+        if (!assets.LoadTextureStreamed(key, path))
         {
             CT_LOG_ERROR("MainMenuScene::LoadRequiredAssets::LoadTexture failed to load Asset: {}, {}", key, path);
         }
@@ -76,6 +78,9 @@ void MainMenuScene::LoadRequiredAssets()
         }
     }
 
+    // Rasterize the UI charset now, so the first frames never stall on glyph uploads.
+    GlyphCache::Instance().PrewarmUI();
+
     CT_LOG_INFO("MainMenuScene finished LoadRequiredAssets.");
 }
 
@@ -90,14 +95,10 @@ void MainMenuScene::Shutdown()
     CT_LOG_INFO("MainMenuScene Shutdown.");
 }
 
-/// @brief Handles the exit criteria for this scene.
+/// @brief Handles the exit criteria for this scene. The menu music keeps playing, so the next scene can crossfade out
+/// of it or carry on with it.
 void MainMenuScene::OnExit()
 {
-    if (AudioManager::Instance().IsInitialized())
-    {
-        AudioManager::Instance().StopMusic();
-    }
-
     CT_LOG_INFO("MainMenuScene OnExit.");
 }
 
@@ -254,15 +255,19 @@ void MainMenuScene::LoadBackground()
 /// @brief Plays the background music for this MainMenuScene.
 void MainMenuScene::PlayIntroMusic()
 {
-    if (!AudioManager::Instance().IsMusicPlaying() ||
-        AudioManager::Instance().GetCurrentMusicName() != MainMenuAssets::MenuSong)
+    const std::string &menuSong = AudioManager::Instance().GetEventTrack(MainMenuAssets::MenuSongId);
+
+    if (!AudioManager::Instance().IsMusicPlaying() || AudioManager::Instance().GetCurrentMusicName() != menuSong)
     {
         CT_LOG_INFO("MainMenuScene: Starting or resuming menu music.");
-        AudioManager::Instance().PlayMusic(MainMenuAssets::MenuSong, true);
+        AudioManager::Instance().PlayMusic(menuSong, true);
     }
 
     else
     {
         CT_LOG_INFO("MainMenuScene: Menu music already playing, no action needed.");
     }
+
+    // Open the game track now, so pressing Play crossfades into it without touching the disk.
+    AudioManager::Instance().PrepareMusic(AudioManager::Instance().GetEventTrack(GameAssets::GameSongId));
 }
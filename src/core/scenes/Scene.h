@@ -52,7 +52,18 @@ class Scene
         return m_isInitialized;
     };
 
+    const char *GetName() const
+    {
+        return m_name;
+    }
+
+    void SetName(const char *name)
+    {
+        m_name = name;
+    }
+
   protected:
+    const char *m_name = "Unnamed";
     bool m_shouldExit = false;
     bool m_isInitialized = false;
     bool m_hasPendingTransition = false;
@@ -11,7 +11,9 @@
 // ============================================================================
 
 #include "SceneManager.h"
+#include "AssetManager.h"
 #include "GameScene.h"
+#include "GlyphCache.h"
 #include "Macros.h"
 #include "MainMenuScene.h"
 #include "SettingsScene.h"
@@ -143,7 +145,14 @@ std::unique_ptr<Scene> SceneManager::Create(SceneID sceneId)
     {
         CT_LOG_INFO("SceneManager: Create '{}'.", SceneIDToString(sceneId));
 
-        return m_sceneRegistry[sceneId]();
+        auto scene = m_sceneRegistry[sceneId]();
+
+        if (scene)
+        {
+            scene->SetName(SceneIDToString(sceneId));
+        }
+
+        return scene;
     }
 
     CT_LOG_WARN("SceneManager::Create failed: '{}' is not registered.", SceneIDToString(sceneId));
@@ -159,8 +168,14 @@ void SceneManager::PushScene(std::unique_ptr<Scene> scene)
 
     if (scene)
     {
+        AssetManager::Instance().SetLoadingScene(scene->GetName());
+
+        GlyphCache::Instance().BeginLoading();
         scene->Init();
+        GlyphCache::Instance().EndLoading();
+
         CT_LOG_INFO("Pushing new scene: {}", typeid(*scene).name());
+        AssetManager::Instance().LogMemoryReport(std::string("push ") + scene->GetName());
         m_scenes.push(std::move(scene));
     }
 }
@@ -173,8 +188,15 @@ void SceneManager::PopScene()
     if (!m_scenes.empty())
     {
         CT_LOG_INFO("Popping scene: {}", typeid(*m_scenes.top()).name());
+        const std::string name = m_scenes.top()->GetName();
         m_scenes.top()->Shutdown();
         m_scenes.pop();
+        AssetManager::Instance().LogMemoryReport("pop " + name);
+
+        if (!m_scenes.empty())
+        {
+            AssetManager::Instance().SetLoadingScene(m_scenes.top()->GetName());
+        }
     }
 }
 
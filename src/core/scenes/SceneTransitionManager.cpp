@@ -28,7 +28,7 @@ void SceneTransitionManager::Reset()
     m_fadeComplete = false;
     m_pendingFadeIn = false;
     m_opacity = 0.f;
-    m_fadeSpeed = 0.f;
+    m_envelope.Set(0.f);
 }
 
 /// @brief Start the sequence to begin the fading out effect.
@@ -41,7 +41,8 @@ void SceneTransitionManager::StartFadeOut(float duration)
     m_isFadingIn = false;
     m_fadeComplete = false;
     m_opacity = 0.f;
-    m_fadeSpeed = 255.f / duration;
+    m_envelope.Set(0.f);
+    m_envelope.Start(1.f, duration, EnvelopeCurve::Linear);
 
     m_fadeRectangle.setSize({800.f, 600.f}); // Will be resized dynamically to window size
     m_fadeRectangle.setFillColor(sf::Color(0, 0, 0, static_cast<sf::Uint8>(m_opacity)));
@@ -57,7 +58,8 @@ void SceneTransitionManager::StartFadeIn(float duration)
     m_isFadingIn = true;
     m_fadeComplete = false;
     m_opacity = 255.f;
-    m_fadeSpeed = 255.f / duration;
+    m_envelope.Set(1.f);
+    m_envelope.Start(0.f, duration, EnvelopeCurve::Linear);
 
     m_fadeRectangle.setSize({800.f, 600.f});
     m_fadeRectangle.setFillColor(sf::Color(0, 0, 0, static_cast<sf::Uint8>(m_opacity)));
@@ -67,26 +69,14 @@ void SceneTransitionManager::StartFadeIn(float duration)
 /// @param dt delta timme since last update.
 void SceneTransitionManager::Update(float dt)
 {
-    if (m_isFadingOut)
+    if (m_isFadingOut || m_isFadingIn)
     {
-        m_opacity += m_fadeSpeed * dt;
+        m_opacity = 255.f * m_envelope.Advance(dt);
 
-        if (m_opacity >= 255.f)
+        if (m_envelope.IsDone())
         {
-            m_opacity = 255.f;
             m_fadeComplete = true;
             m_isFadingOut = false;
-        }
-    }
-
-    else if (m_isFadingIn)
-    {
-        m_opacity -= m_fadeSpeed * dt;
-
-        if (m_opacity <= 0.f)
-        {
-            m_opacity = 0.f;
-            m_fadeComplete = true;
             m_isFadingIn = false;
         }
     }
@@ -130,6 +120,7 @@ bool SceneTransitionManager::IsFadeComplete() const
 void SceneTransitionManager::ForceFullyOpaque()
 {
     m_opacity = 255.f;
+    m_envelope.Set(1.f);
     m_fadeRectangle.setFillColor(sf::Color(0, 0, 0, static_cast<sf::Uint8>(m_opacity)));
     m_isFadingOut = false;
     m_isFadingIn = false;
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "AudioEnvelope.h"
 #include <SFML/Graphics.hpp>
 
 // ============================================================================
@@ -52,10 +53,12 @@ class SceneTransitionManager
   private:
     sf::RectangleShape m_fadeRectangle;
 
+    /// @brief Opacity from 0 to 1, advanced in seconds.
+    AudioEnvelope m_envelope;
+
     bool m_isFadingOut = false;
     bool m_isFadingIn = false;
     bool m_fadeComplete = false;
     bool m_pendingFadeIn = false;
     float m_opacity = 0.f;
-    float m_fadeSpeed = 0.f;
 };
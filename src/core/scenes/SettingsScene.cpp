@@ -12,6 +12,7 @@
 #include "SettingsScene.h"
 #include "AssetManager.h"
 #include "AudioManager.h"
+#include "GlyphCache.h"
 #include "InputManager.h"
 #include "Macros.h"
 #include "ResolutionScaleManager.h"
@@ -59,7 +60,7 @@ void SettingsScene::LoadRequiredAssets()
 
     for (const auto &[key, path] : SettingsAssets::Textures)
     {
-        if (!assets.LoadTexture(key, path))
+        if (!assets.LoadTextureStreamed(key, path))
         {
             CT_LOG_ERROR("SettingsScene::LoadRequiredAssets::LoadTexture failed to load Asset: {}, {}", key, path);
         }
@@ -73,6 +74,8 @@ void SettingsScene::LoadRequiredAssets()
         }
     }
 
+    AudioManager::Instance().SetSFXParams(SettingsAssets::SettingsSoundId, SettingsAssets::SettingsSoundParams);
+
     for (const auto &[key, path] : SettingsAssets::Fonts)
     {
         if (!assets.LoadFont(key, path))
@@ -81,6 +84,8 @@ void SettingsScene::LoadRequiredAssets()
         }
     }
 
+    GlyphCache::Instance().PrewarmUI();
+
     CT_LOG_INFO("SettingsScene finished LoadRequiredAssets.");
 }
 
@@ -345,7 +350,7 @@ void SettingsScene::CreateButtonControls()
             m_hasUnsavedChanges = false;
 
             AudioManager::Instance().HotReload(SettingsManager::Instance().GetSettings());
-            AudioManager::Instance().PlaySFX(SettingsAssets::SettingsSound);
+            AudioManager::Instance().PlaySFX(SettingsAssets::SettingsSoundId);
 
             auto targetSetting = SettingsManager::Instance().GetSettings()->m_resolution;
 
@@ -57,7 +57,7 @@ void SplashScene::LoadRequiredAssets()
     const std::string key = SplashAssets::SplashBackground;
     const std::string path = SplashAssets::Textures.at(key);
 
-    if (!AssetManager::Instance().LoadTexture(key, path))
+    if (!AssetManager::Instance().LoadTextureStreamed(key, path))
     {
         CT_LOG_ERROR("SplashScene: Failed to load splash background.");
     }
@@ -125,7 +125,17 @@ void SplashScene::Render()
 
     if (m_background)
     {
-        window.draw(*m_background);
+        // The splash image is large enough to stream; draw its proxy until the upload completes.
+        sf::Sprite proxy;
+
+        if (AssetManager::Instance().GetTextureStreamer().MakeProxySprite(*m_background, proxy))
+        {
+            window.draw(proxy);
+        }
+        else
+        {
+            window.draw(*m_background);
+        }
     }
 
     window.display();
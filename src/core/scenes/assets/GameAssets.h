@@ -0,0 +1,48 @@
+// ============================================================================
+//  File        : GameAssets.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-12
+//  Description : Hosts the namespace for GameAssets
+//                GameAssets are used in the GameScene.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include "AssetId.h"
+#include <array>
+
+/// @brief Exposes the audio events and music of the GameScene to the GameAssets namespace. Files, variations and
+/// voice priorities live in the audio event data file.
+namespace GameAssets
+{
+/// @brief Key to the in game music track in the audio event data.
+constexpr auto GameSong = "Game";
+
+/// @brief Key to the PewPew event, fired with every shot.
+constexpr auto PewPew = "PewPew";
+
+/// @brief Key to the Bomb event.
+constexpr auto Bomb = "Bomb";
+
+/// @brief Key to the Explosion event.
+constexpr auto Explosion = "Explosion";
+
+/// @brief Interned id of the in game music track.
+constexpr AssetId GameSongId = MakeAssetId(GameSong);
+
+/// @brief Interned id of the PewPew event.
+constexpr AssetId PewPewId = MakeAssetId(PewPew);
+
+/// @brief Interned id of the Bomb event.
+constexpr AssetId BombId = MakeAssetId(Bomb);
+
+/// @brief Interned id of the Explosion event.
+constexpr AssetId ExplosionId = MakeAssetId(Explosion);
+
+/// @brief Events the GameScene needs; it reports any the event data is missing.
+constexpr std::array<const char *, 3> Events = {PewPew, Bomb, Explosion};
+} // namespace GameAssets
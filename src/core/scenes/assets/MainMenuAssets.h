@@ -12,14 +12,15 @@
 
 #pragma once
 
+#include "AssetId.h"
 #include <string>
 #include <unordered_map>
 
 /// @brief Exposes Textures, Fonts, and Audio assets to the MainMenuAssets namespace.
 namespace MainMenuAssets
 {
-/// @brief Path for the MenuSong.
-constexpr auto MenuSong = "assets/audio/RootMenu.wav";
+/// @brief Interned id of the menu music track in the audio event data.
+constexpr AssetId MenuSongId = MakeAssetId("Menu");
 
 /// @brief Textures contain a Key and Value pair collection of image assets
 static const std::unordered_map<std::string, std::string> Textures = {
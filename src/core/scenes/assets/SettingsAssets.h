@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include "AssetId.h"
+#include "SfxVoicePool.h"
 #include <string>
 #include <unordered_map>
 
@@ -21,6 +23,12 @@ namespace SettingsAssets
 /// @brief Key to the SettingsSound Asset.
 constexpr auto SettingsSound = "SettingsSound";
 
+/// @brief Interned id of the SettingsSound Asset.
+constexpr AssetId SettingsSoundId = MakeAssetId(SettingsSound);
+
+/// @brief Voice priority of the SettingsSound Asset.
+constexpr SfxParams SettingsSoundParams = {0, SfxCategory::UI};
+
 /// @brief Textures contain a Key and Value pair collection of image assets
 static const std::unordered_map<std::string, std::string> Textures = {
     {"PlainStarBackground", "assets/backgrounds/PlainStarBackground.png"},
@@ -0,0 +1,286 @@
+// ============================================================================
+//  File        : GlyphCache.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-08
+//  Description : Pre-rasterizes the UI charset at every scaled UI font size
+//                and counts the glyphs that still had to be rasterized
+//                while a scene was running.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "GlyphCache.h"
+#include "AssetManager.h"
+#include "Macros.h"
+#include "ResolutionScaleManager.h"
+#include "UIPresets.h"
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+/// @brief Bit holding the bold flag in a glyph key, above the 32 bit code point and the 16 bit size.
+constexpr unsigned int GLYPH_KEY_BOLD_SHIFT = 48;
+
+/// @brief Bit holding the outline flag in a glyph key.
+constexpr unsigned int GLYPH_KEY_OUTLINE_SHIFT = 49;
+
+/// @brief Packs everything sf::Font keys a glyph page entry on, except the exact outline thickness.
+/// @param size character size.
+/// @param isBold bold variant.
+/// @param isOutline outline variant.
+/// @param codePoint unicode code point.
+/// @return key unique per font.
+std::uint64_t MakeGlyphKey(unsigned int size, bool isBold, bool isOutline, sf::Uint32 codePoint)
+{
+    return static_cast<std::uint64_t>(codePoint) | (static_cast<std::uint64_t>(size & 0xFFFF) << 32) |
+           (static_cast<std::uint64_t>(isBold) << GLYPH_KEY_BOLD_SHIFT) |
+           (static_cast<std::uint64_t>(isOutline) << GLYPH_KEY_OUTLINE_SHIFT);
+}
+
+/// @brief Control characters are laid out by sf::Text without touching the font.
+/// @param codePoint unicode code point.
+/// @return true for whitespace sf::Text handles itself.
+bool IsLayoutOnly(sf::Uint32 codePoint)
+{
+    return codePoint == '\n' || codePoint == '\t' || codePoint == '\r';
+}
+} // namespace
+
+/// @brief Get the current Instance for this GlyphCache singleton.
+/// @return reference to existing GlyphCache interface.
+GlyphCache &GlyphCache::Instance()
+{
+    static GlyphCache instance;
+    return instance;
+}
+
+/// @brief Rasterizes every UI charset glyph of font at each size. Glyphs that are already warm are skipped, so
+/// calling this again after a scale change only pays for the new sizes.
+/// @note sf::Font glyph pages are GL textures and are not synchronized, so this must run on the main thread.
+/// @param font font to warm.
+/// @param sizes character sizes, in pixels.
+/// @return number of glyphs rasterized by this call.
+std::size_t GlyphCache::Prewarm(const sf::Font &font, const std::vector<unsigned int> &sizes)
+{
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t rasterized = 0;
+
+    for (const unsigned int size : sizes)
+    {
+        for (sf::Uint32 codePoint = UI_CHARSET_FIRST; codePoint <= UI_CHARSET_LAST; ++codePoint)
+        {
+            if (Insert(font, size, false, false, codePoint))
+            {
+                font.getGlyph(codePoint, size, false);
+                ++rasterized;
+            }
+        }
+
+        MarkRasterized(font, size);
+    }
+
+    if (rasterized > 0)
+    {
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        CT_LOG_INFO("GlyphCache: rasterized {} glyphs at {} sizes in {:.2f} ms.", rasterized, sizes.size(),
+                    elapsed.count());
+    }
+
+    return rasterized;
+}
+
+/// @brief Warms the default UI font at every UIFactory and title size, scaled for the current resolution.
+/// @return number of glyphs rasterized, 0 when the default font is not resident yet.
+std::size_t GlyphCache::PrewarmUI()
+{
+    if (!AssetManager::Instance().IsInitialized())
+    {
+        return 0;
+    }
+
+    const sf::Font *font = AssetManager::Instance().GetFont(DEFAULT_FONT_ID);
+
+    if (!font)
+    {
+        return 0;
+    }
+
+    std::vector<unsigned int> sizes;
+    sizes.reserve(UI_PREWARM_BASE_FONT_SIZES.size());
+
+    for (const unsigned int baseSize : UI_PREWARM_BASE_FONT_SIZES)
+    {
+        sizes.push_back(ResolutionScaleManager::Instance().ScaleFont(baseSize));
+    }
+
+    return Prewarm(*font, sizes);
+}
+
+/// @brief Records the glyphs text will need. Any that were not warm are rasterized now, as drawing the text would, and
+/// counted as a loading miss while a scene is being set up, or as a frame miss once it is running.
+/// @note Rasterizing touches glyph page textures, so this must run on the main thread.
+/// @param text text whose string, font, size and style were just set.
+void GlyphCache::Track(const sf::Text &text)
+{
+    const sf::Font *font = text.getFont();
+
+    if (!font)
+    {
+        return;
+    }
+
+    const unsigned int size = text.getCharacterSize();
+    const bool isBold = (text.getStyle() & sf::Text::Bold) != 0;
+    const float outlineThickness = text.getOutlineThickness();
+    const bool hasOutline = outlineThickness != 0.f;
+
+    std::size_t misses = 0;
+
+    for (const sf::Uint32 codePoint : text.getString())
+    {
+        if (IsLayoutOnly(codePoint))
+        {
+            continue;
+        }
+
+        if (Insert(*font, size, isBold, false, codePoint))
+        {
+            font->getGlyph(codePoint, size, isBold);
+            ++misses;
+        }
+
+        if (hasOutline && Insert(*font, size, isBold, true, codePoint))
+        {
+            font->getGlyph(codePoint, size, isBold, outlineThickness);
+            ++misses;
+        }
+    }
+
+    if (misses == 0)
+    {
+        return;
+    }
+
+    MarkRasterized(*font, size);
+
+    if (IsLoading())
+    {
+        m_loadingMisses += misses;
+    }
+    else
+    {
+        m_frameMisses += misses;
+        CT_LOG_DEBUG("GlyphCache: {} glyph miss(es) at size {} during a frame.", misses, size);
+    }
+}
+
+/// @brief Marks the start of scene setup; misses until the matching EndLoading are not charged to frames.
+void GlyphCache::BeginLoading()
+{
+    ++m_loadingDepth;
+}
+
+/// @brief Marks the end of scene setup.
+void GlyphCache::EndLoading()
+{
+    if (m_loadingDepth > 0)
+    {
+        --m_loadingDepth;
+    }
+}
+
+/// @brief Returns whether a scene is currently being set up.
+/// @return true / false
+bool GlyphCache::IsLoading() const
+{
+    return m_loadingDepth > 0;
+}
+
+/// @brief Returns how many glyphs are known to be rasterized.
+/// @return m_warmGlyphCount.
+std::size_t GlyphCache::GetWarmGlyphCount() const
+{
+    return m_warmGlyphCount;
+}
+
+/// @brief Returns how many glyphs were first requested while a scene was being set up.
+/// @return m_loadingMisses.
+std::size_t GlyphCache::GetLoadingMissCount() const
+{
+    return m_loadingMisses;
+}
+
+/// @brief Returns how many glyphs were first requested while a scene was running; this should stay at 0.
+/// @return m_frameMisses.
+std::size_t GlyphCache::GetFrameMissCount() const
+{
+    return m_frameMisses;
+}
+
+/// @brief Returns every character size this cache rasterized glyphs of a font at. Each already has a glyph page, so
+/// measuring those pages allocates nothing.
+/// @param font font to query.
+/// @return sorted, unique character sizes.
+std::vector<unsigned int> GlyphCache::GetWarmSizes(const sf::Font &font) const
+{
+    auto it = m_warmSizes.find(&font);
+
+    return it != m_warmSizes.end() ? it->second : std::vector<unsigned int>{};
+}
+
+/// @brief Writes the warm glyph count and both miss counters to the log.
+void GlyphCache::LogStats() const
+{
+    CT_LOG_INFO("GlyphCache: {} warm glyphs, {} loading misses, {} frame misses.", m_warmGlyphCount, m_loadingMisses,
+                m_frameMisses);
+}
+
+/// @brief Forgets every warm glyph, keeping the counters. Call when a font is reloaded or released.
+void GlyphCache::Invalidate()
+{
+    m_warmGlyphs.clear();
+    m_warmSizes.clear();
+    m_warmGlyphCount = 0;
+}
+
+/// @brief Forgets every warm glyph and resets the counters.
+void GlyphCache::Clear()
+{
+    Invalidate();
+    m_loadingMisses = 0;
+    m_frameMisses = 0;
+    m_loadingDepth = 0;
+}
+
+/// @brief Marks a glyph as rasterized.
+/// @param font owning font.
+/// @param size character size.
+/// @param isBold bold variant.
+/// @param isOutline outline variant.
+/// @param codePoint unicode code point.
+/// @return true if the glyph was not warm before.
+bool GlyphCache::Insert(const sf::Font &font, unsigned int size, bool isBold, bool isOutline, sf::Uint32 codePoint)
+{
+    const bool isNew = m_warmGlyphs[&font].insert(MakeGlyphKey(size, isBold, isOutline, codePoint)).second;
+
+    m_warmGlyphCount += isNew ? 1 : 0;
+
+    return isNew;
+}
+
+/// @brief Records that a font has glyphs rasterized at a size, and so a glyph page for it.
+/// @param font owning font.
+/// @param size character size.
+void GlyphCache::MarkRasterized(const sf::Font &font, unsigned int size)
+{
+    std::vector<unsigned int> &sizes = m_warmSizes[&font];
+    auto it = std::lower_bound(sizes.begin(), sizes.end(), size);
+
+    if (it == sizes.end() || *it != size)
+    {
+        sizes.insert(it, size);
+    }
+}
@@ -0,0 +1,80 @@
+// ============================================================================
+//  File        : GlyphCache.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-08
+//  Description : Pre-rasterizes the UI charset at every scaled UI font size
+//                and counts the glyphs that still had to be rasterized
+//                while a scene was running.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// ============================================================================
+//  Class       : GlyphCache
+//  Purpose     : Singleton that keeps sf::Font glyph pages warm for the UI.
+//
+//  Responsibilities:
+//      - Rasterizes the UI charset for a font at a list of sizes
+//      - Re-runs the prewarm for the default font when the UI scale changes
+//      - Tracks which glyphs the UI text has requested, rasterizing any
+//        that were cold so the sizes it reports all have glyph pages
+//      - Counts glyph misses during loading and during running frames
+//      - Forgets its warm set when fonts are reloaded or released
+//
+// ============================================================================
+class GlyphCache
+{
+  public:
+    static GlyphCache &Instance();
+
+    std::size_t Prewarm(const sf::Font &font, const std::vector<unsigned int> &sizes);
+    std::size_t PrewarmUI();
+
+    void Track(const sf::Text &text);
+
+    void BeginLoading();
+    void EndLoading();
+    bool IsLoading() const;
+
+    std::size_t GetWarmGlyphCount() const;
+    std::size_t GetLoadingMissCount() const;
+    std::size_t GetFrameMissCount() const;
+    std::vector<unsigned int> GetWarmSizes(const sf::Font &font) const;
+
+    void LogStats() const;
+    void Invalidate();
+    void Clear();
+
+  private:
+    GlyphCache() = default;
+    ~GlyphCache() = default;
+
+    GlyphCache(const GlyphCache &) = delete;
+    GlyphCache &operator=(const GlyphCache &) = delete;
+
+    bool Insert(const sf::Font &font, unsigned int size, bool isBold, bool isOutline, sf::Uint32 codePoint);
+    void MarkRasterized(const sf::Font &font, unsigned int size);
+
+  private:
+    /// @brief Per font set of (size, bold, outline, code point) keys that have been rasterized.
+    std::unordered_map<const sf::Font *, std::unordered_set<std::uint64_t>> m_warmGlyphs;
+
+    /// @brief Per font sorted character sizes this cache has rasterized glyphs at, so each has a glyph page.
+    std::unordered_map<const sf::Font *, std::vector<unsigned int>> m_warmSizes;
+
+    std::size_t m_warmGlyphCount = 0;
+    std::size_t m_loadingMisses = 0;
+    std::size_t m_frameMisses = 0;
+    int m_loadingDepth = 0;
+};
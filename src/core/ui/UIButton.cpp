@@ -11,6 +11,7 @@
 // ============================================================================
 
 #include "UIButton.h"
+#include "GlyphCache.h"
 #include "Macros.h"
 
 /// @brief Constructor for the UIButton.
@@ -46,6 +47,7 @@ void UIButton::SetText(const std::string &text, const sf::Font &font, unsigned i
         textRect = m_label.getLocalBounds();
     }
 
+    GlyphCache::Instance().Track(m_label);
     CenterLabel();
 }
 
@@ -92,6 +94,7 @@ void UIButton::SetFontSize(unsigned int size)
 {
     m_fontSize = size;
     m_label.setCharacterSize(m_fontSize);
+    GlyphCache::Instance().Track(m_label);
     CenterLabel();
 }
 
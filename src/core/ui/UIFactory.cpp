@@ -32,11 +32,11 @@ std::shared_ptr<UIButton> UIFactory::CreateButton(const sf::Vector2f &position,
 {
     sf::Vector2f scaledSize(ResolutionScaleManager::Instance().ScaleX(size.x),
                             ResolutionScaleManager::Instance().ScaleY(size.y));
-    unsigned int scaledFontSize = ResolutionScaleManager::Instance().ScaleFont(18);
+    unsigned int scaledFontSize = ResolutionScaleManager::Instance().ScaleFont(BASE_BUTTON_FONT_SIZE);
 
     auto button = std::make_shared<UIButton>(position, scaledSize);
 
-    button->SetText(label, *AssetManager::Instance().GetFont("Default.ttf"), scaledFontSize);
+    button->SetText(label, *AssetManager::Instance().GetFont(DEFAULT_FONT_ID), scaledFontSize);
     button->SetCallback(std::move(onClick));
     button->SetIdleColor(BUTTON_DEFAULT_IDLE_COLOR);
     button->SetHoverColor(BUTTON_DEFAULT_HOVER_COLOR);
@@ -60,11 +60,11 @@ std::shared_ptr<UISelectableButton> UIFactory::CreateSelectableButton(const sf::
 {
     sf::Vector2f scaledSize(ResolutionScaleManager::Instance().ScaleX(size.x),
                             ResolutionScaleManager::Instance().ScaleY(size.y));
-    unsigned int scaledFontSize = ResolutionScaleManager::Instance().ScaleFont(18);
+    unsigned int scaledFontSize = ResolutionScaleManager::Instance().ScaleFont(BASE_BUTTON_FONT_SIZE);
 
     auto selectableButton = std::make_shared<UISelectableButton>(position, scaledSize);
 
-    selectableButton->SetText(label, *AssetManager::Instance().GetFont("Default.ttf"), scaledFontSize);
+    selectableButton->SetText(label, *AssetManager::Instance().GetFont(DEFAULT_FONT_ID), scaledFontSize);
     selectableButton->SetCallback(std::move(onClick));
     selectableButton->SetTextColor(BUTTON_DEFAULT_TEXT_COLOR);
     selectableButton->SetHoverColor(BUTTON_DEFAULT_HOVER_COLOR);
@@ -92,10 +92,10 @@ std::shared_ptr<UISlider> UIFactory::CreateSlider(const std::string &label, cons
     const sf::Vector2f scaledPos = {scaleMgr.ScaledReferenceX(position.x), scaleMgr.ScaledReferenceY(position.y)};
 
     const auto scaledSize = sf::Vector2f(scaleMgr.ScaledReferenceX(size.x), scaleMgr.ScaleY(size.y));
-    const auto scaledFontSize = ResolutionScaleManager::Instance().ScaleFont(14);
+    const auto scaledFontSize = ResolutionScaleManager::Instance().ScaleFont(BASE_SLIDER_FONT_SIZE);
 
     auto slider = std::make_shared<UISlider>(label, minValue, maxValue, initialValue, scaledPos, scaledSize, onChange);
-    slider->SetFont(*AssetManager::Instance().GetFont("Default.ttf"));
+    slider->SetFont(*AssetManager::Instance().GetFont(DEFAULT_FONT_ID));
     slider->SetFontSize(scaledFontSize);
     slider->SetTitlePositionOffset(sf::Vector2f(0.f, -ResolutionScaleManager::Instance().ScaleY(24.f)));
 
@@ -135,7 +135,7 @@ std::shared_ptr<UIGroupBox> UIFactory::CreateGroupBox(const std::string &title,
     const float edgePadding = scaleMgr.ScaledReferenceY(BASE_GROUPBOX_EDGE_PAD_RATIO);
 
     auto groupBox = std::make_shared<UIGroupBox>(scaledPos, scaledSize);
-    groupBox->SetTitle(title, *AssetManager::Instance().GetFont("Default.ttf"),
+    groupBox->SetTitle(title, *AssetManager::Instance().GetFont(DEFAULT_FONT_ID),
                        scaleMgr.ScaleFont(BASE_GROUPBOX_FONT_SIZE));
     groupBox->SetLayoutMode(LayoutMode::Vertical); // safe default state
     groupBox->SetCenterChildren(true);             // safe default state
@@ -156,7 +156,7 @@ std::shared_ptr<UITextLabel> UIFactory::CreateTextLabel(const std::string &text,
 {
     auto scaledFontSize = ResolutionScaleManager::Instance().ScaleFont(baseFontSize);
     auto label =
-        std::make_shared<UITextLabel>(text, *AssetManager::Instance().GetFont("Default.ttf"), scaledFontSize, position);
+        std::make_shared<UITextLabel>(text, *AssetManager::Instance().GetFont(DEFAULT_FONT_ID), scaledFontSize, position);
 
     if (!centerOrigin)
         label->SetPosition(position); // no auto-centering
@@ -172,8 +172,8 @@ std::shared_ptr<UITextLabel> UIFactory::CreateTextLabel(const std::string &text,
 std::shared_ptr<UIToastMessage> UIFactory::CreateToastMessage(const std::string &text, const sf::Vector2f &position,
                                                               float duration)
 {
-    const auto &font = *AssetManager::Instance().GetFont("Default.ttf");
-    unsigned int fontSize = ResolutionScaleManager::Instance().ScaleFont(18);
+    const auto &font = *AssetManager::Instance().GetFont(DEFAULT_FONT_ID);
+    unsigned int fontSize = ResolutionScaleManager::Instance().ScaleFont(BASE_TOAST_FONT_SIZE);
     sf::Color color = sf::Color::White;
     bool centerOrigin = true;
 
@@ -10,6 +10,7 @@
 // ============================================================================
 
 #include "UIGroupBox.h"
+#include "GlyphCache.h"
 #include "Macros.h"
 
 /// @brief Constructor for the UIGroupBox.
@@ -36,6 +37,7 @@ void UIGroupBox::SetTitle(const std::string &title, const sf::Font &font, unsign
     m_title.setString(title);
     m_title.setCharacterSize(fontSize);
     m_title.setFillColor(sf::Color::White);
+    GlyphCache::Instance().Track(m_title);
 
     const auto bounds = m_title.getLocalBounds();
     m_title.setOrigin(bounds.left, bounds.top);
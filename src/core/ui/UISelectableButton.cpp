@@ -12,6 +12,7 @@
 
 #include "UISelectableButton.h"
 #include "AssetManager.h"
+#include "GlyphCache.h"
 #include "Macros.h"
 
 /// @brief Constructs a UISelectableButton.
@@ -62,6 +63,7 @@ void UISelectableButton::SetText(const std::string &text, const sf::Font &font,
     }
 
     m_label.setFillColor(m_textColor);
+    GlyphCache::Instance().Track(m_label);
 
     CenterLabel();
 }
@@ -103,6 +105,7 @@ void UISelectableButton::SetFontSize(unsigned int size)
 {
     m_fontSize = size;
     m_label.setCharacterSize(size);
+    GlyphCache::Instance().Track(m_label);
     CenterLabel();
 }
 
@@ -10,6 +10,7 @@
 // ============================================================================
 
 #include "UISlider.h"
+#include "GlyphCache.h"
 #include "Macros.h"
 #include "UIPresets.h"
 #include <algorithm>
@@ -57,7 +58,7 @@ void UISlider::SetupGraphics()
     std::stringstream ss;
     ss << m_label << ": " << static_cast<int>(m_value);
     m_labelText.setString(ss.str());
-    m_labelText.setCharacterSize(14);
+    m_labelText.setCharacterSize(BASE_SLIDER_FONT_SIZE);
     m_labelText.setFillColor(sf::Color::White);
     m_labelText.setPosition(m_position.x, m_position.y - 20);
 }
@@ -99,6 +100,7 @@ void UISlider::Update(const sf::Vector2i &mousePos, bool isMousePressed, bool is
         std::stringstream ss;
         ss << m_label << ": " << static_cast<int>(m_value);
         m_labelText.setString(ss.str());
+        GlyphCache::Instance().Track(m_labelText);
 
         if (m_onChange)
         {
@@ -178,6 +180,7 @@ void UISlider::draw(sf::RenderTarget &target, sf::RenderStates states) const
 void UISlider::SetFont(const sf::Font &font)
 {
     m_labelText.setFont(font);
+    GlyphCache::Instance().Track(m_labelText);
 }
 
 /// @brief Sets the internal font size for this UISlider.
@@ -185,6 +188,7 @@ void UISlider::SetFont(const sf::Font &font)
 void UISlider::SetFontSize(unsigned int size)
 {
     m_labelText.setCharacterSize(size);
+    GlyphCache::Instance().Track(m_labelText);
 }
 
 /// @brief Sets the position for the Title on this UISlider.
@@ -217,6 +221,7 @@ void UISlider::SetValue(float value)
     std::stringstream ss;
     ss << m_label << ": " << static_cast<int>(m_value);
     m_labelText.setString(ss.str());
+    GlyphCache::Instance().Track(m_labelText);
 }
 
 /// @brief Gets the value for this UISlider.
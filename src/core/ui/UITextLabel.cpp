@@ -11,6 +11,7 @@
 // ============================================================================
 
 #include "UITextLabel.h"
+#include "GlyphCache.h"
 
 /// @brief Constructor for the UITextLabel.
 /// @param text String representation for this UITextLabel.
@@ -25,6 +26,7 @@ UITextLabel::UITextLabel(const std::string &text, const sf::Font &font, unsigned
     m_text.setCharacterSize(fontSize);
     m_text.setFillColor(sf::Color::White);
     m_text.setPosition(position);
+    GlyphCache::Instance().Track(m_text);
     CenterOrigin();
 }
 
@@ -33,6 +35,7 @@ UITextLabel::UITextLabel(const std::string &text, const sf::Font &font, unsigned
 void UITextLabel::SetText(const std::string &text)
 {
     m_text.setString(text);
+    GlyphCache::Instance().Track(m_text);
     CenterOrigin();
 }
 
@@ -41,6 +44,7 @@ void UITextLabel::SetText(const std::string &text)
 void UITextLabel::SetFont(const sf::Font &font)
 {
     m_text.setFont(font);
+    GlyphCache::Instance().Track(m_text);
     CenterOrigin();
 }
 
@@ -49,6 +53,7 @@ void UITextLabel::SetFont(const sf::Font &font)
 void UITextLabel::SetFontSize(unsigned int size)
 {
     m_text.setCharacterSize(size);
+    GlyphCache::Instance().Track(m_text);
     CenterOrigin();
 }
 
@@ -10,6 +10,7 @@
 // ============================================================================
 
 #include "UIToastMessage.h"
+#include "GlyphCache.h"
 #include "ResolutionScaleManager.h"
 #include "WindowManager.h"
 
@@ -30,6 +31,7 @@ UIToastMessage::UIToastMessage(const std::string &text, const sf::Vector2f &posi
     m_text.setString(text);
     m_text.setCharacterSize(fontSize);
     m_text.setFillColor(textColor);
+    GlyphCache::Instance().Track(m_text);
 
     SetPosition(position);
 }
@@ -127,6 +129,7 @@ sf::Vector2f UIToastMessage::GetSize() const
 void UIToastMessage::SetFont(const sf::Font &font)
 {
     m_text.setFont(font);
+    GlyphCache::Instance().Track(m_text);
 }
 
 /// @brief Sets the font for this UIToastMessage.
@@ -134,6 +137,7 @@ void UIToastMessage::SetFont(const sf::Font &font)
 void UIToastMessage::SetFontSize(unsigned int size)
 {
     m_text.setCharacterSize(size);
+    GlyphCache::Instance().Track(m_text);
     // Optional: Re-center origin if needed
     sf::FloatRect bounds = m_text.getLocalBounds();
     m_text.setOrigin(bounds.left + bounds.width / 2.f, bounds.top + bounds.height / 2.f);
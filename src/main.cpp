@@ -10,19 +10,86 @@
 // ============================================================================
 
 #include "Application.h"
+#include "AudioImporter.h"
+#include "LogManager.h"
+#include "SettingsManager.h"
 #include <iostream>
+#include <string_view>
 
 #if defined(_MSC_VER) && defined(_DEBUG)
 #define _CRTDBG_MAP_ALLOC
 #include <crtdbg.h>
 #endif
 
+namespace
+{
+/// @brief Command line flag that converts the WAV sources to OGG / FLAC and exits instead of running the game.
+constexpr std::string_view IMPORT_AUDIO_FLAG = "--import-audio";
+
+/// @brief Command line flag that records the session's input to the file that follows it.
+constexpr std::string_view RECORD_INPUT_FLAG = "--record-input";
+
+/// @brief Command line flag that replays the input recorded in the file that follows it, then exits.
+constexpr std::string_view REPLAY_INPUT_FLAG = "--replay-input";
+
+/// @brief Runs the audio import step over the configured audio directory, or over directory when one is given.
+/// @param directory optional override of Settings::m_audioDirectory.
+/// @return process exit code, non zero if any file failed.
+int RunAudioImport(const char *directory)
+{
+    LogManager::Instance().Init();
+    SettingsManager::Instance().LoadFromFile("config.json");
+
+    const std::string target = directory ? directory : SettingsManager::Instance().GetSettings()->m_audioDirectory;
+    const AudioImportReport report = AudioImporter::ImportDirectory(target);
+    AudioImporter::LogReport(report);
+
+    LogManager::Instance().Shutdown();
+
+    return report.failedCount == 0 ? 0 : 1;
+}
+} // namespace
+
 /// @brief Entry point in the application.
-/// @return return value is mostly ignored.
-int main()
+/// @param argc argument count.
+/// @param argv arguments; "--import-audio [dir]" runs the audio import step instead of the game, "--record-input <file>"
+/// records the session's input and "--replay-input <file>" plays a recording back instead of the keyboard.
+/// @return 0 once the game closes, or the audio import result; a recording or replay that cannot be opened only warns.
+int main(int argc, char *argv[])
 {
+    if (argc > 1 && argv[1] == IMPORT_AUDIO_FLAG)
+    {
+        return RunAudioImport(argc > 2 ? argv[2] : nullptr);
+    }
+
+    const char *recordPath = nullptr;
+    const char *replayPath = nullptr;
+
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        if (argv[i] == RECORD_INPUT_FLAG)
+        {
+            recordPath = argv[++i];
+        }
+        else if (argv[i] == REPLAY_INPUT_FLAG)
+        {
+            replayPath = argv[++i];
+        }
+    }
+
     Application app;
     app.Init();
+
+    if (recordPath && !app.RecordInput(recordPath))
+    {
+        std::cerr << "Could not create the input recording '" << recordPath << "', running without one." << std::endl;
+    }
+
+    if (replayPath && !app.ReplayInput(replayPath))
+    {
+        std::cerr << "Could not load the input replay '" << replayPath << "', running on live input." << std::endl;
+    }
+
     app.Run();
 
     std::cout << "CT application successfully concluded." << std::endl;
@@ -12,6 +12,7 @@
 #include "AssetManager.h"
 #include "Macros.h"
 #include "TestHelpers.h"
+#include <filesystem>
 #include <gtest/gtest.h>
 
 class AssetManagerTest : public ::testing::Test
@@ -29,6 +30,8 @@ class AssetManagerTest : public ::testing::Test
         }
 
         AssetManager::Instance().Init(m_settings);
+        AssetManager::Instance().GetTextureDiskCache().SetDirectory(TextureCacheDirectory().generic_string());
+        AssetManager::Instance().GetSoundDiskCache().SetDirectory(SoundCacheDirectory().generic_string());
     }
 
     void TearDown() override
@@ -40,6 +43,16 @@ class AssetManagerTest : public ::testing::Test
 
         m_settings.reset();
     }
+
+    static std::filesystem::path TextureCacheDirectory()
+    {
+        return std::filesystem::temp_directory_path() / "ct_asset_manager_texture_cache";
+    }
+
+    static std::filesystem::path SoundCacheDirectory()
+    {
+        return std::filesystem::temp_directory_path() / "ct_asset_manager_sound_cache";
+    }
 };
 
 // =========================================================================
@@ -72,3 +85,251 @@ TEST_F(AssetManagerTest, ReturnsNullptrForMissingTexture)
     const auto &sound = *AssetManager::Instance().GetSound("nonexistent");
     EXPECT_EQ(&sound, nullptr);
 }
+
+TEST_F(AssetManagerTest, SameFileUnderTwoNamesSharesOneResource)
+{
+    EXPECT_TRUE(AssetManager::Instance().LoadFont("Default.ttf", "assets/fonts/Default.ttf"));
+    EXPECT_TRUE(AssetManager::Instance().LoadFont("MenuFont", "assets/fonts/../fonts/Default.ttf"));
+
+    EXPECT_EQ(AssetManager::Instance().GetFont("Default.ttf"), AssetManager::Instance().GetFont("MenuFont"));
+
+    const auto report = AssetManager::Instance().GetCacheReport();
+    EXPECT_EQ(report.uniqueResources, 1u);
+    EXPECT_EQ(report.aliasCount, 1u);
+    EXPECT_EQ(report.dedupedLoads, 1u);
+    EXPECT_EQ(report.dedupedBytes, report.residentBytes);
+}
+
+TEST_F(AssetManagerTest, DistinctFilesAreNotAliased)
+{
+    AssetManager::Instance().LoadTexture("BulletRed", "assets/sprites/BulletRed.png");
+    AssetManager::Instance().LoadTexture("BulletBlue", "assets/sprites/BulletBlue.png");
+
+    EXPECT_NE(AssetManager::Instance().GetTexture("BulletRed"), AssetManager::Instance().GetTexture("BulletBlue"));
+    EXPECT_EQ(AssetManager::Instance().GetCacheReport().dedupedLoads, 0u);
+}
+
+TEST_F(AssetManagerTest, AssetIdIsComputedAtCompileTime)
+{
+    constexpr AssetId id = MakeAssetId("Default.ttf");
+    static_assert(id == MakeAssetId("Default.ttf"));
+    static_assert(!(id == MakeAssetId("MenuFont")));
+
+    EXPECT_NE(id.value, 0u);
+}
+
+TEST_F(AssetManagerTest, HandleLookupMatchesStringLookup)
+{
+    constexpr AssetId bombId = MakeAssetId("Bomb");
+
+    EXPECT_FALSE(AssetManager::Instance().GetSoundHandle(bombId).IsValid());
+
+    AssetManager::Instance().LoadSound("Bomb", "assets/audio/Bomb.wav");
+
+    const AssetHandle handle = AssetManager::Instance().GetSoundHandle(bombId);
+    ASSERT_TRUE(handle.IsValid());
+
+    EXPECT_EQ(AssetManager::Instance().GetSound(handle), AssetManager::Instance().GetSound("Bomb"));
+    EXPECT_EQ(AssetManager::Instance().GetSound(bombId), AssetManager::Instance().GetSound("Bomb"));
+}
+
+TEST_F(AssetManagerTest, StaleHandleReturnsNullptr)
+{
+    EXPECT_EQ(AssetManager::Instance().GetTexture(AssetHandle{}), nullptr);
+    EXPECT_EQ(AssetManager::Instance().GetTexture(AssetHandle{42}), nullptr);
+}
+
+TEST_F(AssetManagerTest, ReloadFromDiskKeepsTheSameTextureObject)
+{
+    const auto path = std::filesystem::temp_directory_path() / "ct_reload_texture.png";
+    std::filesystem::copy_file("assets/sprites/BulletRed.png", path, std::filesystem::copy_options::overwrite_existing);
+
+    ASSERT_TRUE(AssetManager::Instance().LoadTexture("Reloadable", path.generic_string()));
+    const sf::Texture *before = AssetManager::Instance().GetTexture("Reloadable");
+
+    // Unchanged content is not re-decoded.
+    EXPECT_FALSE(AssetManager::Instance().ReloadFromDisk(path.generic_string()));
+
+    std::filesystem::copy_file("assets/sprites/playerShip.png", path, std::filesystem::copy_options::overwrite_existing);
+    EXPECT_TRUE(AssetManager::Instance().ReloadFromDisk(path.generic_string()));
+
+    const sf::Texture *after = AssetManager::Instance().GetTexture("Reloadable");
+    EXPECT_EQ(before, after);
+
+    sf::Image expected;
+    expected.loadFromFile("assets/sprites/playerShip.png");
+    EXPECT_EQ(after->getSize(), expected.getSize());
+
+    std::filesystem::remove(path);
+}
+
+TEST_F(AssetManagerTest, ReloadLeavesNamesFromOtherFilesOnTheirContent)
+{
+    const auto edited = std::filesystem::temp_directory_path() / "ct_reload_edited.png";
+    const auto untouched = std::filesystem::temp_directory_path() / "ct_reload_untouched.png";
+    constexpr auto overwrite = std::filesystem::copy_options::overwrite_existing;
+    std::filesystem::copy_file("assets/sprites/BulletRed.png", edited, overwrite);
+    std::filesystem::copy_file("assets/sprites/BulletRed.png", untouched, overwrite);
+
+    ASSERT_TRUE(AssetManager::Instance().LoadTexture("Edited", edited.generic_string()));
+    ASSERT_TRUE(AssetManager::Instance().LoadTexture("Untouched", untouched.generic_string()));
+    ASSERT_EQ(AssetManager::Instance().GetTexture("Edited"), AssetManager::Instance().GetTexture("Untouched"));
+
+    std::filesystem::copy_file("assets/sprites/playerShip.png", edited, overwrite);
+    EXPECT_TRUE(AssetManager::Instance().ReloadFromDisk(edited.generic_string()));
+
+    sf::Image ship;
+    sf::Image bullet;
+    ship.loadFromFile("assets/sprites/playerShip.png");
+    bullet.loadFromFile("assets/sprites/BulletRed.png");
+
+    const sf::Texture *editedTexture = AssetManager::Instance().GetTexture("Edited");
+    const sf::Texture *untouchedTexture = AssetManager::Instance().GetTexture("Untouched");
+    ASSERT_NE(editedTexture, untouchedTexture);
+    EXPECT_EQ(editedTexture->getSize(), ship.getSize());
+    EXPECT_EQ(untouchedTexture->getSize(), bullet.getSize());
+    EXPECT_EQ(AssetManager::Instance().GetCacheReport().uniqueResources, 2u);
+
+    // The untouched file now reloads on its own entry.
+    EXPECT_FALSE(AssetManager::Instance().ReloadFromDisk(untouched.generic_string()));
+
+    std::filesystem::remove(edited);
+    std::filesystem::remove(untouched);
+}
+
+TEST_F(AssetManagerTest, LoadsAreRecordedForTheLoadingScene)
+{
+    AssetManager::Instance().SetLoadingScene("Splash");
+    AssetManager::Instance().LoadTexture("BulletRed", "assets/sprites/BulletRed.png");
+    AssetManager::Instance().LoadTexture("BulletRedAlias", "assets/sprites/BulletRed.png");
+
+    const auto &records = AssetManager::Instance().GetTelemetry().GetRecords();
+
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[0].scene, "Splash");
+    EXPECT_EQ(records[0].type, "texture");
+    EXPECT_GT(records[0].bytes, 0u);
+    EXPECT_FALSE(records[0].wasAliased);
+    EXPECT_TRUE(records[1].wasAliased);
+    EXPECT_DOUBLE_EQ(records[1].TotalMs(), 0.0);
+}
+
+TEST_F(AssetManagerTest, PrefetchedTextureSkipsReadAndDecodeOnLoad)
+{
+    ASSERT_TRUE(AssetManager::Instance().PrefetchTexture("assets/sprites/playerShip.png"));
+    ASSERT_TRUE(AssetManager::Instance().LoadTexture("PlayerShip", "assets/sprites/playerShip.png"));
+
+    const auto &record = AssetManager::Instance().GetTelemetry().GetRecords().back();
+    sf::Texture expected;
+    expected.loadFromFile("assets/sprites/playerShip.png");
+
+    EXPECT_TRUE(record.wasPrefetched);
+    EXPECT_DOUBLE_EQ(record.readMs, 0.0);
+    EXPECT_EQ(AssetManager::Instance().GetTexture("PlayerShip")->getSize(), expected.getSize());
+}
+
+TEST_F(AssetManagerTest, TextureIsLoadedFromDiskCacheUntilItsSourceChanges)
+{
+    std::filesystem::remove_all(TextureCacheDirectory());
+
+    const auto path = std::filesystem::temp_directory_path() / "ct_cooked_texture.png";
+    std::filesystem::copy_file("assets/sprites/BulletRed.png", path, std::filesystem::copy_options::overwrite_existing);
+
+    const auto restart = []()
+    {
+        AssetManager::Instance().Shutdown();
+        AssetManager::Instance().Init(CreateTestSettings());
+    };
+
+    ASSERT_TRUE(AssetManager::Instance().LoadTexture("Cooked", path.generic_string()));
+    EXPECT_FALSE(AssetManager::Instance().GetTelemetry().GetRecords().back().wasCooked);
+    const sf::Vector2u decodedSize = AssetManager::Instance().GetTexture("Cooked")->getSize();
+
+    restart();
+    ASSERT_TRUE(AssetManager::Instance().LoadTexture("Cooked", path.generic_string()));
+
+    const auto cooked = AssetManager::Instance().GetTelemetry().GetRecords().back();
+    EXPECT_TRUE(cooked.wasCooked);
+    EXPECT_DOUBLE_EQ(cooked.decodeMs, 0.0);
+    EXPECT_EQ(cooked.bytes, std::filesystem::file_size(path));
+    EXPECT_EQ(AssetManager::Instance().GetTexture("Cooked")->getSize(), decodedSize);
+
+    std::filesystem::copy_file("assets/sprites/playerShip.png", path, std::filesystem::copy_options::overwrite_existing);
+
+    restart();
+    ASSERT_TRUE(AssetManager::Instance().LoadTexture("Cooked", path.generic_string()));
+
+    sf::Image expected;
+    expected.loadFromFile("assets/sprites/playerShip.png");
+    EXPECT_FALSE(AssetManager::Instance().GetTelemetry().GetRecords().back().wasCooked);
+    EXPECT_EQ(AssetManager::Instance().GetTexture("Cooked")->getSize(), expected.getSize());
+
+    std::filesystem::remove(path);
+    std::filesystem::remove_all(TextureCacheDirectory());
+}
+
+TEST_F(AssetManagerTest, SoundsAreNormalizedToTheDeviceRateAndCooked)
+{
+    std::filesystem::remove_all(SoundCacheDirectory());
+    ASSERT_EQ(AssetManager::Instance().GetSoundSampleRate(), 44100u);
+
+    // Bomb.wav is real stereo at 48 kHz: resampled, but kept stereo.
+    ASSERT_TRUE(AssetManager::Instance().LoadSound("Bomb", "assets/audio/Bomb.wav"));
+    EXPECT_FALSE(AssetManager::Instance().GetTelemetry().GetRecords().back().wasCooked);
+
+    const sf::SoundBuffer &bomb = *AssetManager::Instance().GetSound("Bomb");
+    EXPECT_EQ(bomb.getSampleRate(), 44100u);
+    EXPECT_EQ(bomb.getChannelCount(), 2u);
+    EXPECT_EQ(bomb.getSampleCount(), 155603u * 2);
+
+    // PewPew.wav is mono at 16 kHz: upsampled.
+    ASSERT_TRUE(AssetManager::Instance().LoadSound("PewPew", "assets/audio/PewPew.wav"));
+    EXPECT_EQ(AssetManager::Instance().GetSound("PewPew")->getSampleRate(), 44100u);
+    EXPECT_EQ(AssetManager::Instance().GetSound("PewPew")->getChannelCount(), 1u);
+
+    AssetManager::Instance().Shutdown();
+    AssetManager::Instance().Init(CreateTestSettings());
+    ASSERT_TRUE(AssetManager::Instance().LoadSound("Bomb", "assets/audio/Bomb.wav"));
+
+    const auto cooked = AssetManager::Instance().GetTelemetry().GetRecords().back();
+    EXPECT_TRUE(cooked.wasCooked);
+    EXPECT_EQ(cooked.bytes, std::filesystem::file_size("assets/audio/Bomb.wav"));
+    EXPECT_EQ(AssetManager::Instance().GetSound("Bomb")->getSampleCount(), 155603u * 2);
+
+    // A cache entry for another rate is not used.
+    AssetManager::Instance().Shutdown();
+    AssetManager::Instance().Init(CreateTestSettings());
+    AssetManager::Instance().SetSoundSampleRate(0);
+    ASSERT_TRUE(AssetManager::Instance().LoadSound("Bomb", "assets/audio/Bomb.wav"));
+    EXPECT_FALSE(AssetManager::Instance().GetTelemetry().GetRecords().back().wasCooked);
+    EXPECT_EQ(AssetManager::Instance().GetSound("Bomb")->getSampleRate(), 48000u);
+
+    AssetManager::Instance().SetSoundSampleRate(44100);
+    std::filesystem::remove_all(SoundCacheDirectory());
+}
+
+TEST_F(AssetManagerTest, MemoryReportTracksTypesScenesAndAliases)
+{
+    AssetManager::Instance().SetLoadingScene("MainMenu");
+    AssetManager::Instance().LoadTexture("PlayerShip", "assets/sprites/playerShip.png");
+    AssetManager::Instance().LoadTexture("PlayerShipAlias", "assets/sprites/playerShip.png");
+
+    AssetManager::Instance().SetLoadingScene("Game");
+    AssetManager::Instance().LoadSound("Bomb", "assets/audio/Bomb.wav");
+
+    const AssetMemoryReport report = AssetManager::Instance().GetMemoryReport();
+    const sf::Vector2u size = AssetManager::Instance().GetTexture("PlayerShip")->getSize();
+    const sf::SoundBuffer &bomb = *AssetManager::Instance().GetSound("Bomb");
+
+    ASSERT_EQ(report.GetRecords().size(), 2u);
+    EXPECT_EQ(report.GetByType("texture").gpuBytes, static_cast<std::size_t>(size.x) * size.y * 4);
+    EXPECT_EQ(report.GetByType("sound").cpuBytes, static_cast<std::size_t>(bomb.getSampleCount()) * 2);
+    EXPECT_EQ(report.GetByScene("MainMenu").assetCount, 1u);
+    EXPECT_EQ(report.GetByScene("Game").assetCount, 1u);
+
+    const AssetMemoryRecord *alias = report.FindAsset("PlayerShipAlias");
+
+    ASSERT_NE(alias, nullptr);
+    EXPECT_EQ(alias->type, "texture");
+    EXPECT_EQ(alias->aliases.size(), 2u);
+}
@@ -0,0 +1,83 @@
+// ============================================================================
+//  File        : AssetMemoryTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-11
+//  Description : Unit tests for the Chaos Theory AssetMemoryReport class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "AssetMemory.h"
+#include <gtest/gtest.h>
+
+namespace
+{
+AssetMemoryRecord MakeRecord(const std::string &type, const std::string &scene, const std::string &alias,
+                             std::size_t cpuBytes, std::size_t gpuBytes)
+{
+    AssetMemoryRecord record;
+    record.type = type;
+    record.scene = scene;
+    record.path = "assets/" + alias;
+    record.aliases = {alias};
+    record.usage.cpuBytes = cpuBytes;
+    record.usage.gpuBytes = gpuBytes;
+    record.usage.assetCount = 1;
+
+    return record;
+}
+} // namespace
+
+TEST(AssetMemoryTest, TextureBytesAreFourPerTexel)
+{
+    EXPECT_EQ(EstimateTextureBytes({16, 8}, false), 16u * 8u * 4u);
+    EXPECT_EQ(EstimateTextureBytes({0, 0}, true), 0u);
+}
+
+TEST(AssetMemoryTest, MipmapAddsEveryLevelDownToOneTexel)
+{
+    // 4x4 + 2x2 + 1x1 texels.
+    EXPECT_EQ(EstimateTextureBytes({4, 4}, true), (16u + 4u + 1u) * 4u);
+
+    // Non square chains keep halving the long side once the short one reaches 1.
+    EXPECT_EQ(EstimateTextureBytes({4, 1}, true), (4u + 2u + 1u) * 4u);
+}
+
+TEST(AssetMemoryTest, SoundBytesAreTwoPerSampleOfEveryChannel)
+{
+    const std::vector<sf::Int16> samples(200, 0);
+    sf::SoundBuffer buffer;
+
+    ASSERT_TRUE(buffer.loadFromSamples(samples.data(), samples.size(), 2, 44100));
+    EXPECT_EQ(EstimateAssetMemory(buffer).cpuBytes, 400u);
+    EXPECT_EQ(EstimateAssetMemory(buffer).gpuBytes, 0u);
+}
+
+TEST(AssetMemoryTest, ReportSumsPerTypeAndPerScene)
+{
+    AssetMemoryReport report;
+    report.Add(MakeRecord("texture", "MainMenu", "Logo", 0, 1000));
+    report.Add(MakeRecord("texture", "Game", "Ship", 0, 500));
+    report.Add(MakeRecord("sound", "Game", "Bomb", 300, 0));
+
+    EXPECT_EQ(report.GetTotal().TotalBytes(), 1800u);
+    EXPECT_EQ(report.GetTotal().assetCount, 3u);
+    EXPECT_EQ(report.GetByType("texture").gpuBytes, 1500u);
+    EXPECT_EQ(report.GetByType("font").assetCount, 0u);
+    EXPECT_EQ(report.GetByScene("Game").TotalBytes(), 800u);
+    EXPECT_EQ(report.GroupByScene().size(), 2u);
+    EXPECT_EQ(report.GroupByType().at("sound").cpuBytes, 300u);
+}
+
+TEST(AssetMemoryTest, FindAssetResolvesAnyAlias)
+{
+    AssetMemoryReport report;
+    AssetMemoryRecord record = MakeRecord("texture", "Game", "Ship", 0, 500);
+    record.aliases.push_back("ShipAlias");
+    report.Add(record);
+
+    ASSERT_NE(report.FindAsset("ShipAlias"), nullptr);
+    EXPECT_EQ(report.FindAsset("ShipAlias")->path, "assets/Ship");
+    EXPECT_EQ(report.FindAsset("Missing"), nullptr);
+}
@@ -0,0 +1,108 @@
+// ============================================================================
+//  File        : AssetTelemetryTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-06
+//  Description : Unit tests for the Chaos Theory Asset Telemetry class
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "AssetTelemetry.h"
+#include "Macros.h"
+#include "nlohmann/json.hpp"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+class AssetTelemetryTest : public ::testing::Test
+{
+  protected:
+    AssetTelemetry m_telemetry;
+
+    void SetUp() override
+    {
+        if (!LogManager::Instance().IsInitialized())
+        {
+            LogManager::Instance().Init();
+        }
+    }
+
+    static AssetLoadRecord MakeRecord(const std::string &name, double readMs, double decodeMs, double uploadMs)
+    {
+        AssetLoadRecord record;
+        record.name = name;
+        record.type = "texture";
+        record.readMs = readMs;
+        record.decodeMs = decodeMs;
+        record.uploadMs = uploadMs;
+        record.bytes = 100;
+
+        return record;
+    }
+};
+
+// =========================================================================
+// TEST CASES
+// =========================================================================
+
+TEST_F(AssetTelemetryTest, RecordsAreTaggedWithTheCurrentScene)
+{
+    m_telemetry.SetScene("Splash");
+    m_telemetry.Record(MakeRecord("A", 1.0, 2.0, 3.0));
+    m_telemetry.SetScene("MainMenu");
+    m_telemetry.Record(MakeRecord("B", 1.0, 1.0, 1.0));
+
+    ASSERT_EQ(m_telemetry.GetRecords().size(), 2u);
+    EXPECT_EQ(m_telemetry.GetRecords()[0].scene, "Splash");
+    EXPECT_EQ(m_telemetry.GetRecords()[1].scene, "MainMenu");
+    EXPECT_DOUBLE_EQ(m_telemetry.GetTotalMs(), 9.0);
+}
+
+TEST_F(AssetTelemetryTest, SortedRecordsAreSlowestFirst)
+{
+    m_telemetry.Record(MakeRecord("Fast", 0.5, 0.0, 0.0));
+    m_telemetry.Record(MakeRecord("Slow", 1.0, 10.0, 5.0));
+    m_telemetry.Record(MakeRecord("Medium", 2.0, 2.0, 0.0));
+
+    const auto sorted = m_telemetry.GetSortedRecords();
+
+    ASSERT_EQ(sorted.size(), 3u);
+    EXPECT_EQ(sorted[0].name, "Slow");
+    EXPECT_EQ(sorted[1].name, "Medium");
+    EXPECT_EQ(sorted[2].name, "Fast");
+}
+
+TEST_F(AssetTelemetryTest, JsonReportHoldsLoadsAndSceneTotals)
+{
+    const auto path = std::filesystem::temp_directory_path() / "ct_telemetry_test" / "report.json";
+
+    m_telemetry.SetScene("MainMenu");
+    m_telemetry.Record(MakeRecord("Fast", 1.0, 0.0, 0.0));
+    m_telemetry.Record(MakeRecord("Slow", 1.0, 4.0, 2.0));
+
+    ASSERT_TRUE(m_telemetry.WriteJson(path.string()));
+
+    std::ifstream in(path);
+    const auto report = nlohmann::json::parse(in);
+
+    ASSERT_EQ(report["loads"].size(), 2u);
+    EXPECT_EQ(report["loads"][0]["name"], "Slow");
+    EXPECT_EQ(report["scenes"]["MainMenu"]["count"], 2);
+    EXPECT_DOUBLE_EQ(report["scenes"]["MainMenu"]["total_ms"].get<double>(), 8.0);
+    EXPECT_DOUBLE_EQ(report["types"]["texture"]["decode_ms"].get<double>(), 4.0);
+
+    in.close();
+    std::filesystem::remove_all(path.parent_path());
+}
+
+TEST_F(AssetTelemetryTest, ClearKeepsTheCurrentScene)
+{
+    m_telemetry.SetScene("Game");
+    m_telemetry.Record(MakeRecord("A", 1.0, 0.0, 0.0));
+    m_telemetry.Clear();
+
+    EXPECT_TRUE(m_telemetry.GetRecords().empty());
+    EXPECT_EQ(m_telemetry.GetScene(), "Game");
+}
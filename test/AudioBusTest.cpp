@@ -0,0 +1,61 @@
+// ============================================================================
+//  File        : AudioBusTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-15
+//  Description : Unit tests for the Chaos Theory AudioBuses class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "AudioBus.h"
+#include <gtest/gtest.h>
+
+TEST(AudioBusTest, BusesStartAtFullGain)
+{
+    AudioBuses buses;
+
+    EXPECT_FLOAT_EQ(buses.GetEffectiveGain(AudioBusId::Master), 1.f);
+    EXPECT_FLOAT_EQ(buses.GetEffectiveGain(AudioBusId::Sfx), 1.f);
+    EXPECT_FALSE(buses.IsMuted(AudioBusId::UI));
+}
+
+TEST(AudioBusTest, MasterGainScalesEveryBus)
+{
+    AudioBuses buses;
+    buses.SetGain(AudioBusId::Master, 0.5f);
+    buses.SetGain(AudioBusId::Music, 0.5f);
+
+    EXPECT_FLOAT_EQ(buses.GetEffectiveGain(AudioBusId::Master), 0.5f);
+    EXPECT_FLOAT_EQ(buses.GetEffectiveGain(AudioBusId::Music), 0.25f);
+    EXPECT_FLOAT_EQ(buses.GetEffectiveGain(AudioBusId::UI), 0.5f);
+    EXPECT_FLOAT_EQ(buses.GetGain(AudioBusId::Music), 0.5f);
+}
+
+TEST(AudioBusTest, MuteSilencesWithoutLosingGain)
+{
+    AudioBuses buses;
+    buses.SetGain(AudioBusId::Sfx, 0.8f);
+    buses.SetMuted(AudioBusId::Sfx, true);
+
+    EXPECT_FLOAT_EQ(buses.GetEffectiveGain(AudioBusId::Sfx), 0.f);
+    EXPECT_FLOAT_EQ(buses.GetEffectiveGain(AudioBusId::Music), 1.f);
+
+    buses.SetMuted(AudioBusId::Sfx, false);
+    buses.SetMuted(AudioBusId::Master, true);
+
+    EXPECT_FLOAT_EQ(buses.GetEffectiveGain(AudioBusId::Music), 0.f);
+
+    buses.SetMuted(AudioBusId::Master, false);
+    EXPECT_FLOAT_EQ(buses.GetEffectiveGain(AudioBusId::Sfx), 0.8f);
+}
+
+TEST(AudioBusTest, GainIsClamped)
+{
+    AudioBuses buses;
+    buses.SetGain(AudioBusId::UI, 3.f);
+    EXPECT_FLOAT_EQ(buses.GetGain(AudioBusId::UI), 1.f);
+
+    buses.SetGain(AudioBusId::UI, -1.f);
+    EXPECT_FLOAT_EQ(buses.GetGain(AudioBusId::UI), 0.f);
+}
@@ -0,0 +1,58 @@
+// ============================================================================
+//  File        : AudioEnvelopeTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-18
+//  Description : Unit tests for the Chaos Theory AudioEnvelope class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "AudioEnvelope.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(AudioEnvelopeTest, CurvesMeetTheirEndpoints)
+{
+    for (EnvelopeCurve curve : {EnvelopeCurve::Linear, EnvelopeCurve::EqualPower, EnvelopeCurve::Exponential})
+    {
+        EXPECT_FLOAT_EQ(AudioEnvelope::Evaluate(0.f, 1.f, 1.f, curve), 1.f);
+        EXPECT_FLOAT_EQ(AudioEnvelope::Evaluate(1.f, 0.f, 1.f, curve), 0.f);
+        EXPECT_FLOAT_EQ(AudioEnvelope::Evaluate(1.f, 0.f, 0.f, curve), 1.f);
+    }
+
+    EXPECT_FLOAT_EQ(AudioEnvelope::Evaluate(0.f, 1.f, 0.5f, EnvelopeCurve::Linear), 0.5f);
+    EXPECT_NEAR(AudioEnvelope::Evaluate(0.f, 1.f, 0.5f, EnvelopeCurve::EqualPower), 0.7071f, 1e-4f);
+    EXPECT_NEAR(AudioEnvelope::Evaluate(1.f, 0.01f, 0.5f, EnvelopeCurve::Exponential), 0.1f, 1e-4f);
+}
+
+TEST(AudioEnvelopeTest, RampStartsFromTheCurrentGain)
+{
+    AudioEnvelope envelope;
+    envelope.Set(0.f);
+    envelope.Start(1.f, 10.0, EnvelopeCurve::Linear);
+    envelope.Advance(4.0);
+
+    envelope.Start(0.f, 4.0, EnvelopeCurve::Linear);
+    EXPECT_FLOAT_EQ(envelope.GetGain(), 0.4f);
+    EXPECT_FLOAT_EQ(envelope.Advance(2.0), 0.2f);
+    EXPECT_FALSE(envelope.IsDone());
+
+    envelope.Advance(2.0);
+    EXPECT_TRUE(envelope.IsDone());
+    EXPECT_FALSE(envelope.IsDone(1.0));
+    EXPECT_FLOAT_EQ(envelope.GetGain(), 0.f);
+}
+
+TEST(AudioEnvelopeTest, ApplyRampsEveryFrame)
+{
+    AudioEnvelope envelope;
+    envelope.Set(0.f);
+    envelope.Start(1.f, 4.0, EnvelopeCurve::Linear);
+
+    std::vector<std::int16_t> samples(6 * 2, 1000);
+    envelope.Apply(samples.data(), 6, 2);
+
+    const std::vector<std::int16_t> expected = {0, 0, 250, 250, 500, 500, 750, 750, 1000, 1000, 1000, 1000};
+    EXPECT_EQ(samples, expected);
+}
@@ -0,0 +1,154 @@
+// ============================================================================
+//  File        : AudioEventBankTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-19
+//  Description : Unit tests for the Chaos Theory AudioEventBank class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "AudioEventBank.h"
+#include "AssetManager.h"
+#include "Macros.h"
+#include "TestHelpers.h"
+#include <gtest/gtest.h>
+
+namespace
+{
+/// @brief Two events, one with two variations, and one music track.
+constexpr auto EVENTS_JSON = R"({
+    "music": { "Game": "Gametrack.wav" },
+    "events": {
+        "Shot": {
+            "sounds": ["PewPew.wav"],
+            "bus": "ui",
+            "category": "weapon",
+            "priority": 3,
+            "max_instances": 2,
+            "cooldown_ms": 40,
+            "volume": [0.5, 0.75],
+            "pitch": 1.25
+        },
+        "Boom": { "sounds": ["Bomb.wav", "Explosion.wav"] },
+        "Ghost": { "sounds": ["DoesNotExist.wav"] }
+    }
+})";
+} // namespace
+
+class AudioEventBankTest : public ::testing::Test
+{
+  protected:
+    std::shared_ptr<Settings> m_settings;
+    AudioEventBank m_bank;
+
+    void SetUp() override
+    {
+        m_settings = CreateTestSettings();
+
+        if (!LogManager::Instance().IsInitialized())
+        {
+            LogManager::Instance().Init();
+        }
+
+        AssetManager::Instance().Init(m_settings);
+        ASSERT_TRUE(m_bank.LoadFromString(EVENTS_JSON, m_settings->m_audioDirectory));
+    }
+
+    void TearDown() override
+    {
+        m_bank.Clear();
+
+        if (AssetManager::Instance().IsInitialized())
+        {
+            AssetManager::Instance().Shutdown();
+        }
+
+        m_settings.reset();
+    }
+};
+
+TEST_F(AudioEventBankTest, ResolvesEventsAndTracksAtLoad)
+{
+    EXPECT_EQ(m_bank.GetEventCount(), 2u);
+    EXPECT_TRUE(m_bank.GetHandle(MakeAssetId("Shot")).IsValid());
+    EXPECT_TRUE(m_bank.GetHandle(MakeAssetId("Boom")).IsValid());
+    EXPECT_FALSE(m_bank.GetHandle(MakeAssetId("Ghost")).IsValid());
+    EXPECT_FALSE(m_bank.GetHandle(MakeAssetId("Unknown")).IsValid());
+
+    EXPECT_EQ(m_bank.GetTrack(MakeAssetId("Game")), "assets/audio/Gametrack.wav");
+    EXPECT_TRUE(m_bank.GetTrack(MakeAssetId("Menu")).empty());
+}
+
+TEST_F(AudioEventBankTest, TriggerAppliesTheEventDefinition)
+{
+    AudioEventShot shot;
+    ASSERT_TRUE(m_bank.Trigger(m_bank.GetHandle(MakeAssetId("Shot")), 0.0, shot));
+
+    EXPECT_EQ(shot.buffer, AssetManager::Instance().GetSound("PewPew.wav"));
+    EXPECT_GE(shot.gain, 0.5f);
+    EXPECT_LE(shot.gain, 0.75f);
+    EXPECT_FLOAT_EQ(shot.pitch, 1.25f);
+    EXPECT_EQ(shot.bus, AudioBusId::UI);
+    EXPECT_EQ(shot.params.priority, 3);
+    EXPECT_EQ(shot.params.category, SfxCategory::Weapon);
+    EXPECT_EQ(shot.params.maxInstances, 2u);
+}
+
+TEST_F(AudioEventBankTest, CooldownDropsEarlyTriggers)
+{
+    const AudioEventHandle shot = m_bank.GetHandle(MakeAssetId("Shot"));
+    AudioEventShot result;
+
+    EXPECT_TRUE(m_bank.Trigger(shot, 100.0, result));
+    EXPECT_FALSE(m_bank.Trigger(shot, 120.0, result));
+    EXPECT_TRUE(m_bank.Trigger(shot, 140.0, result));
+    EXPECT_EQ(m_bank.GetCooldownDropCount(), 1u);
+}
+
+TEST_F(AudioEventBankTest, VariationsNeverRepeatBackToBack)
+{
+    const AudioEventHandle boom = m_bank.GetHandle(MakeAssetId("Boom"));
+    AudioEventShot shot;
+    const sf::SoundBuffer *previous = nullptr;
+
+    for (int i = 0; i < 20; ++i)
+    {
+        ASSERT_TRUE(m_bank.Trigger(boom, i * 1000.0, shot));
+        EXPECT_NE(shot.buffer, previous);
+        EXPECT_FLOAT_EQ(shot.gain, 1.f);
+        previous = shot.buffer;
+    }
+}
+
+TEST_F(AudioEventBankTest, InvalidHandlesAndBadDataAreHarmless)
+{
+    AudioEventShot shot;
+    EXPECT_FALSE(m_bank.Trigger(AudioEventHandle{}, 0.0, shot));
+
+    EXPECT_FALSE(m_bank.LoadFromString("{ not json", m_settings->m_audioDirectory));
+    EXPECT_EQ(m_bank.GetEventCount(), 0u);
+}
+
+TEST_F(AudioEventBankTest, HandlesKeepTheirEventAcrossReloads)
+{
+    const AudioEventHandle shot = m_bank.GetHandle(MakeAssetId("Shot"));
+    const AudioEventHandle boom = m_bank.GetHandle(MakeAssetId("Boom"));
+
+    // "Aaa" sorts first and "Shot" is gone: a plain index would now point Boom's handle at another event.
+    ASSERT_TRUE(m_bank.LoadFromString(R"({ "events": {
+        "Aaa": { "sounds": ["PewPew.wav"] },
+        "Boom": { "sounds": ["Bomb.wav"] }
+    } })",
+                                      m_settings->m_audioDirectory));
+
+    EXPECT_EQ(m_bank.GetEventCount(), 2u);
+    EXPECT_EQ(m_bank.GetHandle(MakeAssetId("Boom")).index, boom.index);
+    EXPECT_FALSE(m_bank.GetHandle(MakeAssetId("Shot")).IsValid());
+
+    AudioEventShot played;
+    EXPECT_FALSE(m_bank.Trigger(shot, 0.0, played));
+
+    ASSERT_TRUE(m_bank.Trigger(boom, 0.0, played));
+    EXPECT_EQ(played.buffer, AssetManager::Instance().GetSound(MakeAssetId("Bomb.wav")));
+}
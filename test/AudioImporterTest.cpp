@@ -0,0 +1,99 @@
+// ============================================================================
+//  File        : AudioImporterTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-05
+//  Description : Unit tests for the Chaos Theory Audio Importer class
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "AudioImporter.h"
+#include "Macros.h"
+#include "TempDirectoryTest.h"
+#include <chrono>
+#include <filesystem>
+#include <gtest/gtest.h>
+
+class AudioImporterTest : public TempDirectoryTest
+{
+  protected:
+    AudioImporterTest() : TempDirectoryTest("ct_audioimporter_test")
+    {
+    }
+
+    std::string Touch(const std::string &name)
+    {
+        const auto path = m_root / name;
+        WriteFile(path, name);
+
+        return path.generic_string();
+    }
+};
+
+// =========================================================================
+// TEST CASES
+// =========================================================================
+
+TEST_F(AudioImporterTest, ResolveSourceKeepsWavWithoutImport)
+{
+    const std::string wav = Touch("Song.wav");
+
+    EXPECT_EQ(AudioImporter::ResolveSource(wav), wav);
+}
+
+TEST_F(AudioImporterTest, ResolveSourcePrefersUpToDateCompressedFile)
+{
+    const std::string wav = Touch("Song.wav");
+    const std::string ogg = Touch("Song.ogg");
+
+    EXPECT_EQ(AudioImporter::ResolveSource(wav), ogg);
+}
+
+TEST_F(AudioImporterTest, ResolveSourceIgnoresStaleCompressedFile)
+{
+    const std::string wav = Touch("Song.wav");
+    const std::string ogg = Touch("Song.ogg");
+
+    std::filesystem::last_write_time(ogg, std::filesystem::last_write_time(wav) - std::chrono::hours(1));
+
+    EXPECT_EQ(AudioImporter::ResolveSource(wav), wav);
+}
+
+TEST_F(AudioImporterTest, ResolveSourceFindsCompressedFileWhenWavIsGone)
+{
+    const std::string flac = Touch("Click.flac");
+
+    EXPECT_EQ(AudioImporter::ResolveSource((m_root / "Click.wav").generic_string()), flac);
+}
+
+TEST_F(AudioImporterTest, ResolveSourceLeavesOtherFormatsAlone)
+{
+    const std::string ogg = Touch("Song.ogg");
+
+    EXPECT_EQ(AudioImporter::ResolveSource(ogg), ogg);
+}
+
+TEST_F(AudioImporterTest, OnlyLongAudioIsStreamed)
+{
+    EXPECT_FALSE(AudioImporter::ShouldStream(0.8f));
+    EXPECT_FALSE(AudioImporter::ShouldStream(3.5f));
+    EXPECT_TRUE(AudioImporter::ShouldStream(41.7f));
+}
+
+TEST_F(AudioImporterTest, ShortEffectImportsAsSmallerFlac)
+{
+    const auto wav = m_root / "PewPew.wav";
+    std::filesystem::copy_file("assets/audio/PewPew.wav", wav);
+
+    const AudioImportResult result = AudioImporter::ImportFile(wav.generic_string());
+
+    ASSERT_TRUE(result.isOk);
+    EXPECT_FALSE(result.isStreamed);
+    EXPECT_TRUE(result.wasConverted);
+    EXPECT_EQ(std::filesystem::path(result.outputPath).extension(), ".flac");
+    EXPECT_LT(result.outputBytes, result.sourceBytes);
+    EXPECT_EQ(result.residentBytes, result.decodedBytes);
+    EXPECT_EQ(AudioImporter::ResolveSource(wav.generic_string()), result.outputPath);
+}
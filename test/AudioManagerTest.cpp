@@ -13,7 +13,12 @@
 #include "AssetManager.h"
 #include "Macros.h"
 #include "TestHelpers.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 
 class AudioManagerTest : public ::testing::Test
 {
@@ -25,6 +30,8 @@ class AudioManagerTest : public ::testing::Test
         m_settings = CreateTestSettings(); // sets up test audio paths + volumes
 
         AssetManager::Instance().Init(m_settings);
+        AssetManager::Instance().GetSoundDiskCache().SetDirectory(
+            (std::filesystem::temp_directory_path() / "ct_audio_manager_sound_cache").generic_string());
         AudioManager::Instance().Init(m_settings);
 
         if (!LogManager::Instance().IsInitialized())
@@ -108,3 +115,403 @@ TEST_F(AudioManagerTest, PlaySFXDoesNotCrash)
     AssetManager::Instance().LoadSound("Bomb", "assets/audio/Bomb.wav");
     AudioManager::Instance().PlaySFX("Bomb");
 }
+
+TEST_F(AudioManagerTest, SwitchTrackCrossfadesBetweenDecks)
+{
+    const std::string menu = m_settings->m_audioDirectory + "Default.wav";
+    const std::string game = m_settings->m_audioDirectory + "MainMenu.wav";
+
+    AudioManager::Instance().PlayMusic(menu);
+    EXPECT_TRUE(AudioManager::Instance().PrepareMusic(game));
+
+    AudioManager::Instance().SwitchTrack(game, true, 0.2f);
+
+    EXPECT_TRUE(AudioManager::Instance().IsCrossfading());
+    EXPECT_TRUE(AudioManager::Instance().IsMusicPlaying());
+    EXPECT_EQ(AudioManager::Instance().GetCurrentMusicName(), game);
+
+    // The crossfade runs on the music streams; a long frame does not skip it ahead.
+    AudioManager::Instance().Update(1.0f);
+    EXPECT_TRUE(AudioManager::Instance().IsCrossfading());
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+
+    while (AudioManager::Instance().IsCrossfading() && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        AudioManager::Instance().Update(0.005f);
+    }
+
+    EXPECT_FALSE(AudioManager::Instance().IsCrossfading());
+    EXPECT_TRUE(AudioManager::Instance().IsMusicPlaying());
+}
+
+TEST_F(AudioManagerTest, FadeOutLengthDoesNotDependOnFrameRate)
+{
+    // Renders 10 ms blocks offline, claiming dt per block as a game at that frame rate would, and returns how many
+    // frames the fade took.
+    const auto fadeFrames = [this](float dt)
+    {
+        EXPECT_TRUE(AudioManager::Instance().StartOfflineRender(48000));
+
+        AudioManager::Instance().PlayMusic(m_settings->m_audioDirectory + "Default.wav");
+        AudioManager::Instance().StopMusic(true, 0.3f);
+
+        std::vector<sf::Int16> block(480 * 2);
+
+        while (AudioManager::Instance().IsFadingOut() && AudioManager::Instance().GetRenderedFrames() < 48000)
+        {
+            AudioManager::Instance().Render(block.data(), 480);
+            AudioManager::Instance().Update(dt);
+        }
+
+        const std::uint64_t frames = AudioManager::Instance().GetRenderedFrames();
+        AudioManager::Instance().StopOfflineRender();
+
+        return frames;
+    };
+
+    const std::uint64_t smooth = fadeFrames(1.f / 60.f);
+    const std::uint64_t choppy = fadeFrames(0.1f);
+
+    EXPECT_EQ(smooth, choppy);
+    EXPECT_GE(smooth, 14400u);
+    EXPECT_LE(smooth, 14400u + 480u);
+}
+
+TEST_F(AudioManagerTest, PreparedTrackStartsOnPlayMusic)
+{
+    const std::string track = m_settings->m_audioDirectory + "Default.wav";
+
+    EXPECT_TRUE(AudioManager::Instance().PrepareMusic(track));
+    EXPECT_FALSE(AudioManager::Instance().IsMusicPlaying());
+
+    AudioManager::Instance().PlayMusic(track);
+    EXPECT_TRUE(AudioManager::Instance().IsMusicPlaying());
+}
+
+TEST_F(AudioManagerTest, PrepareMusicFinishesInTheBackground)
+{
+    const std::string track = m_settings->m_audioDirectory + "Default.wav";
+
+    EXPECT_TRUE(AudioManager::Instance().PrepareMusic(track));
+
+    AudioManager::Instance().WaitForPreparedMusic();
+    EXPECT_FALSE(AudioManager::Instance().IsPreparingMusic());
+    EXPECT_FALSE(AudioManager::Instance().IsMusicPlaying());
+
+    // Already on the idle deck, so nothing is queued again.
+    EXPECT_TRUE(AudioManager::Instance().PrepareMusic(track));
+    EXPECT_FALSE(AudioManager::Instance().IsPreparingMusic());
+}
+
+TEST_F(AudioManagerTest, VolumesDriveTheBuses)
+{
+    AudioManager::Instance().SetMasterVolume(50.f);
+    AudioManager::Instance().SetSFXVolume(50.f);
+
+    EXPECT_FLOAT_EQ(AudioManager::Instance().GetBuses()->GetEffectiveGain(AudioBusId::Sfx), 0.25f);
+
+    AudioManager::Instance().Mute();
+    EXPECT_FLOAT_EQ(AudioManager::Instance().GetBuses()->GetEffectiveGain(AudioBusId::Music), 0.f);
+
+    AudioManager::Instance().Unmute();
+    EXPECT_FLOAT_EQ(AudioManager::Instance().GetBuses()->GetEffectiveGain(AudioBusId::Music), 0.5f);
+}
+
+TEST_F(AudioManagerTest, SoftwareMixingCanBeToggled)
+{
+    EXPECT_FALSE(AudioManager::Instance().IsSoftwareMixing());
+
+    AudioManager::Instance().SetSoftwareMixing(true);
+    ASSERT_NE(AudioManager::Instance().GetSoftwareMixer().Get(), nullptr);
+
+    AudioManager::Instance().PlaySFX("nonexistent.wav");
+    AudioManager::Instance().FlushSFX();
+
+    AudioManager::Instance().SetSoftwareMixing(false);
+    EXPECT_EQ(AudioManager::Instance().GetSoftwareMixer().Get(), nullptr);
+}
+
+TEST_F(AudioManagerTest, AudioThreadRunsQueuedRequests)
+{
+    const std::string track = m_settings->m_audioDirectory + "Default.wav";
+
+    AudioManager::Instance().StartAudioThread();
+    ASSERT_TRUE(AudioManager::Instance().IsAudioThreadRunning());
+
+    AudioManager::Instance().PlayMusic(track);
+    AudioManager::Instance().SetMusicVolume(40.f);
+    EXPECT_EQ(AudioManager::Instance().GetCurrentMusicName(), track);
+    EXPECT_FLOAT_EQ(AudioManager::Instance().GetMusicVolume(), 40.f);
+
+    AudioManager::Instance().SyncAudioThread();
+    EXPECT_TRUE(AudioManager::Instance().IsMusicPlaying());
+    EXPECT_FLOAT_EQ(AudioManager::Instance().GetBuses()->GetGain(AudioBusId::Music), 0.4f);
+
+    AudioManager::Instance().StopAudioThread();
+    EXPECT_FALSE(AudioManager::Instance().IsAudioThreadRunning());
+}
+
+TEST_F(AudioManagerTest, AudioThreadFadesWithoutGameFrames)
+{
+    AudioManager::Instance().StartAudioThread();
+    AudioManager::Instance().PlayMusic(m_settings->m_audioDirectory + "Default.wav", true, true, 0.05f);
+    AudioManager::Instance().SyncAudioThread();
+
+    EXPECT_TRUE(AudioManager::Instance().IsFadingIn());
+
+    // No Update calls: the fade advances on the audio thread's own clock. The deadline only bounds a broken run; a
+    // loaded machine may take a few ticks longer than the fade itself.
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+    while (AudioManager::Instance().IsFadingIn() && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_FALSE(AudioManager::Instance().IsFadingIn());
+    EXPECT_TRUE(AudioManager::Instance().IsMusicPlaying());
+}
+
+TEST_F(AudioManagerTest, FullQueueMergesVolumesAndDropsSoundsInsteadOfWaiting)
+{
+    ASSERT_TRUE(AssetManager::Instance().LoadSound("Bomb", "assets/audio/Bomb.wav"));
+    AudioManager::Instance().StartAudioThread();
+
+    {
+        // Holding the buses stalls the audio thread on its first command, so the queue fills up behind it.
+        AudioStateAccess<AudioBuses> buses = AudioManager::Instance().GetBuses();
+
+        for (int i = 0; i <= 300; ++i)
+        {
+            AudioManager::Instance().PlaySFX("Bomb");
+            AudioManager::Instance().SetMusicVolume(static_cast<float>(i % 100));
+        }
+    }
+
+    EXPECT_GT(AudioManager::Instance().GetDroppedSFXCount(), 0u);
+
+    AudioManager::Instance().SyncAudioThread();
+    EXPECT_FLOAT_EQ(AudioManager::Instance().GetBuses()->GetGain(AudioBusId::Music), 0.f);
+}
+
+TEST_F(AudioManagerTest, MusicQueriesSeeTheirOwnRequestsWithoutWaiting)
+{
+    AudioManager::Instance().StartAudioThread();
+    AudioManager::Instance().PlayMusic(m_settings->m_audioDirectory + "Default.wav");
+    EXPECT_TRUE(AudioManager::Instance().IsMusicPlaying());
+
+    // Whether or not the audio thread got to it yet, a scene waiting on its own fade out sees it.
+    AudioManager::Instance().StopMusic(true, 1.f);
+    EXPECT_TRUE(AudioManager::Instance().IsFadingOut());
+
+    AudioManager::Instance().StopMusic();
+    EXPECT_FALSE(AudioManager::Instance().IsFadingOut());
+    EXPECT_FALSE(AudioManager::Instance().IsMusicPlaying());
+}
+
+TEST_F(AudioManagerTest, AudioThreadHoldsMusicBackUntilThePrepareFinishes)
+{
+    const std::string track = m_settings->m_audioDirectory + "Default.wav";
+
+    AudioManager::Instance().StartAudioThread();
+    EXPECT_TRUE(AudioManager::Instance().PrepareMusic(track));
+    AudioManager::Instance().PlayMusic(track);
+    AudioManager::Instance().SetMusicVolume(40.f);
+
+    // The play waits on the audio thread for the prepared deck, in order; the volume does not wait for either.
+    AudioManager::Instance().SyncAudioThread();
+    EXPECT_FALSE(AudioManager::Instance().IsPreparingMusic());
+    EXPECT_TRUE(AudioManager::Instance().IsMusicPlaying());
+    EXPECT_FLOAT_EQ(AudioManager::Instance().GetBuses()->GetGain(AudioBusId::Music), 0.4f);
+}
+
+TEST_F(AudioManagerTest, OffScreenPositionalSoundsAreCulled)
+{
+    ASSERT_TRUE(AssetManager::Instance().LoadSound("Bomb", "assets/audio/Bomb.wav"));
+    AudioManager::Instance().SetListener({0.f, 0.f}, {1280.f, 720.f});
+
+    const std::size_t culled = AudioManager::Instance().GetCulledSFXCount();
+
+    AudioManager::Instance().PlaySFX("Bomb", sf::Vector2f(200.f, 0.f));
+    AudioManager::Instance().PlaySFX("Bomb", sf::Vector2f(5000.f, 0.f));
+    AudioManager::Instance().FlushSFX();
+
+    EXPECT_EQ(AudioManager::Instance().GetCulledSFXCount(), culled + 1);
+
+    // Moving the camera away culls the voice that is still playing.
+    AudioManager::Instance().SetListener({10000.f, 0.f}, {1280.f, 720.f});
+    AudioManager::Instance().FlushSFX();
+
+    EXPECT_EQ(AudioManager::Instance().GetCulledSFXCount(), culled + 2);
+}
+
+TEST_F(AudioManagerTest, EventsLoadFromTheDataFile)
+{
+    ASSERT_TRUE(AudioManager::Instance().LoadEvents(m_settings->m_audioDirectory + "events.json"));
+
+    EXPECT_EQ(AudioManager::Instance().GetEventTrack(MakeAssetId("Menu")), m_settings->m_audioDirectory + "RootMenu.wav");
+
+    const AudioEventHandle bomb = AudioManager::Instance().GetEventHandle(MakeAssetId("Bomb"));
+    ASSERT_TRUE(bomb.IsValid());
+
+    AudioManager::Instance().PlayEvent(bomb);
+    AudioManager::Instance().PlayEvent(bomb, sf::Vector2f(0.f, 0.f));
+    AudioManager::Instance().FlushSFX();
+}
+
+TEST_F(AudioManagerTest, OfflineRenderFadesOnTheVirtualClock)
+{
+    ASSERT_TRUE(AudioManager::Instance().StartOfflineRender(48000));
+
+    AudioManager::Instance().PlayMusic(m_settings->m_audioDirectory + "Default.wav");
+    AudioManager::Instance().StopMusic(true, 0.5f);
+
+    std::vector<sf::Int16> samples(24000 * 2);
+    AudioManager::Instance().Render(samples.data(), 12000);
+    EXPECT_TRUE(AudioManager::Instance().IsFadingOut());
+    EXPECT_TRUE(std::any_of(samples.begin(), samples.begin() + 24000, [](sf::Int16 s) { return s != 0; }));
+
+    // Real time plays no part: the fade ends after exactly 0.5 s of rendered audio.
+    AudioManager::Instance().Render(samples.data(), 11999);
+    EXPECT_TRUE(AudioManager::Instance().IsFadingOut());
+
+    AudioManager::Instance().Render(samples.data(), 241);
+    EXPECT_FALSE(AudioManager::Instance().IsFadingOut());
+    EXPECT_FALSE(AudioManager::Instance().IsMusicPlaying());
+    EXPECT_EQ(AudioManager::Instance().GetRenderedFrames(), 24240u);
+
+    AudioManager::Instance().Render(samples.data(), 24000);
+    EXPECT_TRUE(std::all_of(samples.begin(), samples.end(), [](sf::Int16 s) { return s == 0; }));
+}
+
+TEST_F(AudioManagerTest, OfflineRenderMixesSoundEffects)
+{
+    // Sounds are normalized to the 44.1 kHz device rate on load, so the mix runs at that rate.
+    ASSERT_TRUE(AssetManager::Instance().LoadSound("Bomb", "assets/audio/Bomb.wav"));
+    ASSERT_TRUE(AudioManager::Instance().StartOfflineRender(44100));
+
+    AudioManager::Instance().PlaySFX("Bomb");
+
+    std::vector<sf::Int16> samples(44100 * 2);
+    AudioManager::Instance().Render(samples.data(), 44100);
+    EXPECT_TRUE(std::any_of(samples.begin(), samples.end(), [](sf::Int16 s) { return s != 0; }));
+    EXPECT_EQ(AudioManager::Instance().GetSoftwareMixer()->GetActiveVoiceCount(), 1u);
+
+    // Bomb.wav lasts about 3.5 s.
+    for (int i = 0; i < 3; ++i)
+    {
+        AudioManager::Instance().Render(samples.data(), 44100);
+    }
+
+    EXPECT_EQ(AudioManager::Instance().GetSoftwareMixer()->GetActiveVoiceCount(), 0u);
+}
+
+TEST_F(AudioManagerTest, OfflineRenderWritesAWavFile)
+{
+    const std::string path = (std::filesystem::temp_directory_path() / "ct_offline_render.wav").string();
+
+    EXPECT_FALSE(AudioManager::Instance().RenderToFile(path, 0.25f));
+    ASSERT_TRUE(AudioManager::Instance().StartOfflineRender(48000));
+    ASSERT_TRUE(AudioManager::Instance().RenderToFile(path, 0.25f));
+
+    {
+        sf::InputSoundFile file;
+        ASSERT_TRUE(file.openFromFile(path));
+        EXPECT_EQ(file.getSampleRate(), 48000u);
+        EXPECT_EQ(file.getChannelCount(), 2u);
+        EXPECT_EQ(file.getSampleCount(), 24000u);
+    }
+
+    std::filesystem::remove(path);
+
+    AudioManager::Instance().StopOfflineRender();
+    EXPECT_FALSE(AudioManager::Instance().IsOfflineRendering());
+}
+
+TEST_F(AudioManagerTest, OfflineRenderAndTheAudioThreadExcludeEachOther)
+{
+    AudioManager::Instance().StartAudioThread();
+    EXPECT_FALSE(AudioManager::Instance().StartOfflineRender());
+
+    AudioManager::Instance().StopAudioThread();
+    ASSERT_TRUE(AudioManager::Instance().StartOfflineRender());
+
+    AudioManager::Instance().StartAudioThread();
+    EXPECT_FALSE(AudioManager::Instance().IsAudioThreadRunning());
+}
+
+TEST_F(AudioManagerTest, OffScreenSoundsResumeWhereTheyWouldBe)
+{
+    ASSERT_TRUE(AssetManager::Instance().LoadSound("Bomb", "assets/audio/Bomb.wav"));
+    ASSERT_TRUE(AudioManager::Instance().StartOfflineRender(44100));
+    AudioManager::Instance().SetListener({0.f, 0.f}, {1280.f, 720.f});
+
+    AudioManager::Instance().PlaySFX("Bomb", sf::Vector2f(5000.f, 0.f));
+
+    // Half a second off screen: tracked, but no voice and no sound.
+    std::vector<sf::Int16> samples(44100 * 2);
+    AudioManager::Instance().Render(samples.data(), 22050);
+    EXPECT_EQ(AudioManager::Instance().GetVirtualSFXCount(), 1u);
+    EXPECT_EQ(AudioManager::Instance().GetSoftwareMixer()->GetActiveVoiceCount(), 0u);
+    EXPECT_TRUE(std::all_of(samples.begin(), samples.begin() + 44100, [](sf::Int16 s) { return s == 0; }));
+
+    AudioManager::Instance().SetListener({5000.f, 0.f}, {1280.f, 720.f});
+    AudioManager::Instance().Render(samples.data(), 441);
+    EXPECT_EQ(AudioManager::Instance().GetVirtualSFXCount(), 0u);
+    EXPECT_EQ(AudioManager::Instance().GetSoftwareMixer()->GetActiveVoiceCount(), 1u);
+
+    // Bomb.wav is 155603 frames long at 44.1 kHz, and resumed half a second in, so it still ends on time.
+    AudioManager::Instance().Render(samples.data(), 44100);
+    AudioManager::Instance().Render(samples.data(), 44100);
+    AudioManager::Instance().Render(samples.data(), 44100);
+    EXPECT_EQ(AudioManager::Instance().GetSoftwareMixer()->GetActiveVoiceCount(), 1u);
+
+    AudioManager::Instance().Render(samples.data(), 2205);
+    EXPECT_EQ(AudioManager::Instance().GetSoftwareMixer()->GetActiveVoiceCount(), 0u);
+}
+
+TEST_F(AudioManagerTest, MutedSoundsGiveUpTheirVoice)
+{
+    ASSERT_TRUE(AssetManager::Instance().LoadSound("Bomb", "assets/audio/Bomb.wav"));
+    ASSERT_TRUE(AudioManager::Instance().StartOfflineRender(44100));
+
+    std::vector<sf::Int16> samples(441 * 2);
+    AudioManager::Instance().PlaySFX("Bomb");
+    AudioManager::Instance().Render(samples.data(), 441);
+    EXPECT_EQ(AudioManager::Instance().GetSoftwareMixer()->GetActiveVoiceCount(), 1u);
+
+    AudioManager::Instance().Mute();
+    AudioManager::Instance().Render(samples.data(), 441);
+    EXPECT_EQ(AudioManager::Instance().GetVirtualSFXCount(), 1u);
+    EXPECT_EQ(AudioManager::Instance().GetSoftwareMixer()->GetActiveVoiceCount(), 0u);
+
+    AudioManager::Instance().Unmute();
+    AudioManager::Instance().Render(samples.data(), 441);
+    EXPECT_EQ(AudioManager::Instance().GetVirtualSFXCount(), 0u);
+    EXPECT_EQ(AudioManager::Instance().GetSoftwareMixer()->GetActiveVoiceCount(), 1u);
+}
+
+TEST_F(AudioManagerTest, StolenSoundsWaitVirtuallyForAVoice)
+{
+    ASSERT_TRUE(AssetManager::Instance().LoadSound("Bomb", "assets/audio/Bomb.wav"));
+    ASSERT_TRUE(AssetManager::Instance().LoadSound("Explosion", "assets/audio/Explosion.wav"));
+
+    const std::size_t voiceCount = AudioManager::Instance().GetSFXVoicePool()->GetVoiceCount();
+    AudioManager::Instance().GetSFXVoicePool()->SetVoiceCount(1);
+
+    AudioManager::Instance().PlaySFX("Bomb");
+    AudioManager::Instance().FlushSFX();
+    EXPECT_EQ(AudioManager::Instance().GetVirtualSFXCount(), 0u);
+
+    AudioManager::Instance().PlaySFX("Explosion");
+    AudioManager::Instance().FlushSFX();
+    EXPECT_EQ(AudioManager::Instance().GetSFXVoicePool()->GetActiveCount(), 1u);
+    EXPECT_EQ(AudioManager::Instance().GetVirtualSFXCount(), 1u);
+
+    AudioManager::Instance().StopAllSFX();
+    EXPECT_EQ(AudioManager::Instance().GetVirtualSFXCount(), 0u);
+
+    AudioManager::Instance().GetSFXVoicePool()->SetVoiceCount(voiceCount);
+}
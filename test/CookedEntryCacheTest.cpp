@@ -0,0 +1,181 @@
+// ============================================================================
+//  File        : CookedEntryCacheTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-24
+//  Description : Unit tests for the Chaos Theory CookedEntryCache class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "CookedEntryCache.h"
+#include "TempDirectoryTest.h"
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <string>
+
+namespace
+{
+/// @brief A minimal entry header: the shared prefix plus one field.
+struct TestEntryHeader
+{
+    CookedEntryPrefix prefix{0x54534554, 1};
+    std::uint32_t value = 0;
+    std::uint32_t reserved = 0;
+};
+
+/// @brief Same layout, another kind of entry.
+struct OtherEntryHeader
+{
+    CookedEntryPrefix prefix{0x52485443, 1};
+    std::uint32_t value = 0;
+    std::uint32_t reserved = 0;
+};
+
+/// @brief Exposes the entry plumbing the concrete caches build on.
+class TestEntryCache : public CookedEntryCache
+{
+  public:
+    TestEntryCache() : CookedEntryCache("TestEntryCache", "cache/test/", ".ctst")
+    {
+    }
+
+    using CookedEntryCache::LoadEntry;
+    using CookedEntryCache::StoreEntry;
+};
+} // namespace
+
+class CookedEntryCacheTest : public TempDirectoryTest
+{
+  protected:
+    CookedEntryCacheTest() : TempDirectoryTest("ct_cooked_entry_cache_test")
+    {
+    }
+
+    void SetUp() override
+    {
+        TempDirectoryTest::SetUp();
+
+        m_source = m_root / "source.bin";
+        WriteFile(m_source, "encoded source");
+
+        m_cache.SetDirectory((m_root / "cache").generic_string());
+    }
+
+    bool StoreSource()
+    {
+        TestEntryHeader header;
+        header.prefix.contentHash = 1234u;
+        header.value = 42u;
+
+        return m_cache.StoreEntry(m_source.generic_string(), std::filesystem::file_size(m_source), header,
+                                  m_payload.data(), m_payload.size());
+    }
+
+    bool LoadSource()
+    {
+        MappedFile file;
+        TestEntryHeader header;
+
+        return m_cache.LoadEntry(m_source.generic_string(), file, header);
+    }
+
+    const std::string m_payload = "payload";
+
+    TestEntryCache m_cache;
+    std::filesystem::path m_source;
+};
+
+// =========================================================================
+// TEST CASES
+// =========================================================================
+
+TEST_F(CookedEntryCacheTest, StoredEntryLoadsBackMapped)
+{
+    ASSERT_TRUE(StoreSource());
+
+    MappedFile file;
+    TestEntryHeader header;
+    ASSERT_TRUE(m_cache.LoadEntry(m_source.generic_string(), file, header));
+
+    EXPECT_EQ(header.value, 42u);
+    EXPECT_EQ(header.prefix.contentHash, 1234u);
+    EXPECT_EQ(header.prefix.sourceSize, std::filesystem::file_size(m_source));
+    ASSERT_EQ(file.Size(), sizeof(TestEntryHeader) + m_payload.size());
+    EXPECT_EQ(std::memcmp(file.Data() + sizeof(TestEntryHeader), m_payload.data(), m_payload.size()), 0);
+}
+
+TEST_F(CookedEntryCacheTest, EntriesAreNamedBySourcePath)
+{
+    const std::string entry = m_cache.EntryPath(m_source.generic_string());
+
+    EXPECT_EQ(entry.rfind(m_cache.GetDirectory(), 0), 0u);
+    EXPECT_EQ(std::filesystem::path(entry).extension(), ".ctst");
+    EXPECT_EQ(entry, m_cache.EntryPath(m_source.generic_string()));
+    EXPECT_NE(entry, m_cache.EntryPath((m_root / "other.bin").generic_string()));
+}
+
+TEST_F(CookedEntryCacheTest, MissingEntryMisses)
+{
+    EXPECT_FALSE(LoadSource());
+}
+
+TEST_F(CookedEntryCacheTest, ChangedSourceInvalidatesTheEntry)
+{
+    ASSERT_TRUE(StoreSource());
+
+    WriteFile(m_source, "a different encoded source");
+
+    EXPECT_FALSE(LoadSource());
+}
+
+TEST_F(CookedEntryCacheTest, TouchedSourceInvalidatesTheEntry)
+{
+    ASSERT_TRUE(StoreSource());
+
+    const auto writeTime = std::filesystem::last_write_time(m_source);
+    std::filesystem::last_write_time(m_source, writeTime + std::chrono::seconds(5));
+
+    EXPECT_FALSE(LoadSource());
+}
+
+TEST_F(CookedEntryCacheTest, EntryShorterThanItsHeaderIsRejected)
+{
+    ASSERT_TRUE(StoreSource());
+
+    std::filesystem::resize_file(m_cache.EntryPath(m_source.generic_string()), sizeof(TestEntryHeader) - 1);
+
+    EXPECT_FALSE(LoadSource());
+}
+
+TEST_F(CookedEntryCacheTest, EntryOfAnotherKindMisses)
+{
+    ASSERT_TRUE(StoreSource());
+
+    MappedFile file;
+    OtherEntryHeader header;
+    EXPECT_FALSE(m_cache.LoadEntry(m_source.generic_string(), file, header));
+}
+
+TEST_F(CookedEntryCacheTest, DisabledCacheNeitherStoresNorLoads)
+{
+    m_cache.SetEnabled(false);
+
+    EXPECT_FALSE(StoreSource());
+    EXPECT_FALSE(std::filesystem::exists(m_cache.EntryPath(m_source.generic_string())));
+
+    m_cache.SetEnabled(true);
+    ASSERT_TRUE(StoreSource());
+    m_cache.SetEnabled(false);
+
+    EXPECT_FALSE(LoadSource());
+}
+
+TEST_F(CookedEntryCacheTest, SourceSizeMismatchIsNotStored)
+{
+    const TestEntryHeader header;
+
+    EXPECT_FALSE(m_cache.StoreEntry(m_source.generic_string(), 1, header, m_payload.data(), m_payload.size()));
+}
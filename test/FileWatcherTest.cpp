@@ -0,0 +1,92 @@
+// ============================================================================
+//  File        : FileWatcherTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-04
+//  Description : Unit tests for the Chaos Theory File Watcher class
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "FileWatcher.h"
+#include "Macros.h"
+#include "TempDirectoryTest.h"
+#include <chrono>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <thread>
+
+class FileWatcherTest : public TempDirectoryTest
+{
+  protected:
+    FileWatcherTest() : TempDirectoryTest("ct_filewatcher_test")
+    {
+    }
+
+    void SetUp() override
+    {
+        TempDirectoryTest::SetUp();
+        std::filesystem::create_directories(m_root / "sub");
+    }
+
+    /// @brief Polls the watcher until a change arrives or the timeout passes.
+    std::vector<std::string> WaitForChanges(FileWatcher &watcher)
+    {
+        for (int i = 0; i < 50; ++i)
+        {
+            auto changes = watcher.ConsumeChanges();
+
+            if (!changes.empty())
+            {
+                return changes;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+
+        return {};
+    }
+};
+
+// =========================================================================
+// TEST CASES
+// =========================================================================
+
+TEST_F(FileWatcherTest, ReportsWritesInNestedDirectories)
+{
+    if (!FileWatcher::IsSupported())
+    {
+        GTEST_SKIP() << "FileWatcher has no backend on this platform.";
+    }
+
+    FileWatcher watcher;
+    ASSERT_TRUE(watcher.Start({m_root.generic_string()}));
+
+    WriteFile(m_root / "sub" / "texture.png", "data");
+
+    const auto changes = WaitForChanges(watcher);
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(std::filesystem::path(changes.front()).filename(), "texture.png");
+
+    watcher.Stop();
+    EXPECT_FALSE(watcher.IsRunning());
+}
+
+TEST_F(FileWatcherTest, SingleFileWatchIgnoresSiblings)
+{
+    if (!FileWatcher::IsSupported())
+    {
+        GTEST_SKIP() << "FileWatcher has no backend on this platform.";
+    }
+
+    FileWatcher watcher;
+    ASSERT_TRUE(watcher.Start({(m_root / "config.json").generic_string()}));
+
+    WriteFile(m_root / "other.json", "{}");
+    WriteFile(m_root / "config.json", "{}");
+
+    const auto changes = WaitForChanges(watcher);
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(std::filesystem::path(changes.front()).filename(), "config.json");
+}
@@ -0,0 +1,144 @@
+// ============================================================================
+//  File        : GlyphCacheTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-08
+//  Description : Unit tests for the Chaos Theory GlyphCache class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "GlyphCache.h"
+#include "LogManager.h"
+#include "UIPresets.h"
+#include <gtest/gtest.h>
+
+namespace
+{
+/// @brief Glyphs in the UI charset, per size.
+constexpr std::size_t CHARSET_SIZE = UI_CHARSET_LAST - UI_CHARSET_FIRST + 1;
+} // namespace
+
+class GlyphCacheTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        if (!LogManager::Instance().IsInitialized())
+        {
+            LogManager::Instance().Init();
+        }
+
+        GlyphCache::Instance().Clear();
+        ASSERT_TRUE(m_font.loadFromFile("assets/fonts/Default.ttf"));
+    }
+
+    void TearDown() override
+    {
+        GlyphCache::Instance().Clear();
+    }
+
+    sf::Text MakeText(const std::string &string, unsigned int size) const
+    {
+        sf::Text text;
+        text.setFont(m_font);
+        text.setString(string);
+        text.setCharacterSize(size);
+
+        return text;
+    }
+
+    sf::Font m_font;
+};
+
+// =========================================================================
+// TEST CASES
+// =========================================================================
+
+TEST_F(GlyphCacheTest, PrewarmRasterizesTheCharsetOncePerSize)
+{
+    auto &cache = GlyphCache::Instance();
+
+    EXPECT_EQ(cache.Prewarm(m_font, {14, 18}), 2 * CHARSET_SIZE);
+    EXPECT_EQ(cache.Prewarm(m_font, {14, 18}), 0u);
+    EXPECT_EQ(cache.Prewarm(m_font, {18, 24}), CHARSET_SIZE);
+    EXPECT_EQ(cache.GetWarmGlyphCount(), 3 * CHARSET_SIZE);
+}
+
+TEST_F(GlyphCacheTest, WarmTextCausesNoFrameMisses)
+{
+    auto &cache = GlyphCache::Instance();
+    cache.Prewarm(m_font, {18});
+
+    cache.Track(MakeText("Play Settings Exit 100%", 18));
+
+    EXPECT_EQ(cache.GetFrameMissCount(), 0u);
+    EXPECT_EQ(cache.GetLoadingMissCount(), 0u);
+}
+
+TEST_F(GlyphCacheTest, ColdSizeCountsAsFrameMissOnlyOnce)
+{
+    auto &cache = GlyphCache::Instance();
+    cache.Prewarm(m_font, {18});
+
+    cache.Track(MakeText("abca", 20));
+    cache.Track(MakeText("abc", 20));
+
+    EXPECT_EQ(cache.GetFrameMissCount(), 3u);
+}
+
+TEST_F(GlyphCacheTest, MissesWhileLoadingAreNotChargedToFrames)
+{
+    auto &cache = GlyphCache::Instance();
+
+    cache.BeginLoading();
+    cache.Track(MakeText("Menu", 30));
+    cache.EndLoading();
+
+    EXPECT_FALSE(cache.IsLoading());
+    EXPECT_EQ(cache.GetLoadingMissCount(), 4u);
+    EXPECT_EQ(cache.GetFrameMissCount(), 0u);
+}
+
+TEST_F(GlyphCacheTest, NewlinesAndFontlessTextAreIgnored)
+{
+    auto &cache = GlyphCache::Instance();
+    cache.Prewarm(m_font, {18});
+
+    cache.Track(MakeText("line\nline", 18));
+
+    sf::Text noFont;
+    noFont.setString("no font");
+    cache.Track(noFont);
+
+    EXPECT_EQ(cache.GetFrameMissCount(), 0u);
+}
+
+TEST_F(GlyphCacheTest, InvalidateForgetsWarmGlyphsButKeepsCounters)
+{
+    auto &cache = GlyphCache::Instance();
+    cache.Prewarm(m_font, {18});
+    cache.Track(MakeText("x", 40));
+
+    cache.Invalidate();
+
+    EXPECT_EQ(cache.GetWarmGlyphCount(), 0u);
+    EXPECT_EQ(cache.GetFrameMissCount(), 1u);
+    EXPECT_EQ(cache.Prewarm(m_font, {18}), CHARSET_SIZE);
+}
+
+TEST_F(GlyphCacheTest, WarmSizesAreTheRasterizedOnes)
+{
+    auto &cache = GlyphCache::Instance();
+    EXPECT_TRUE(cache.GetWarmSizes(m_font).empty());
+
+    cache.Prewarm(m_font, {18, 12});
+    cache.Track(MakeText("x", 40));
+    cache.Track(MakeText("", 50));
+
+    const std::vector<unsigned int> expected = {12, 18, 40};
+    EXPECT_EQ(cache.GetWarmSizes(m_font), expected);
+
+    cache.Invalidate();
+    EXPECT_TRUE(cache.GetWarmSizes(m_font).empty());
+}
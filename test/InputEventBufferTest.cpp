@@ -0,0 +1,141 @@
+// ============================================================================
+//  File        : InputEventBufferTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-22
+//  Description : Unit tests for the Chaos Theory InputEventBuffer class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "InputEventBuffer.h"
+#include <gtest/gtest.h>
+
+namespace
+{
+/// @brief A key press event for a key code.
+sf::Event MakeKey(sf::Keyboard::Key key)
+{
+    sf::Event event;
+    event.type = sf::Event::KeyPressed;
+    event.key.code = key;
+
+    return event;
+}
+
+/// @brief A mouse move event to a position.
+sf::Event MakeMouseMove(int x, int y)
+{
+    sf::Event event;
+    event.type = sf::Event::MouseMoved;
+    event.mouseMove = {x, y};
+
+    return event;
+}
+
+/// @brief A joystick axis move event.
+sf::Event MakeStick(unsigned int joystickId, sf::Joystick::Axis axis, float position)
+{
+    sf::Event event;
+    event.type = sf::Event::JoystickMoved;
+    event.joystickMove = {joystickId, axis, position};
+
+    return event;
+}
+} // namespace
+
+TEST(InputEventBufferTest, EventsComeBackOldestFirst)
+{
+    InputEventBuffer buffer;
+    EXPECT_TRUE(buffer.IsEmpty());
+
+    buffer.Push(MakeKey(sf::Keyboard::A), 1.0);
+    buffer.Push(MakeKey(sf::Keyboard::B), 1.5);
+    buffer.Push(MakeKey(sf::Keyboard::C), 2.25);
+
+    ASSERT_EQ(buffer.Size(), 3u);
+    EXPECT_EQ(buffer[0].event.key.code, sf::Keyboard::A);
+    EXPECT_EQ(buffer[1].event.key.code, sf::Keyboard::B);
+    EXPECT_EQ(buffer[2].event.key.code, sf::Keyboard::C);
+    EXPECT_DOUBLE_EQ(buffer[2].timeMs, 2.25);
+}
+
+TEST(InputEventBufferTest, FullBufferDropsTheOldest)
+{
+    InputEventBuffer buffer;
+
+    for (std::size_t i = 0; i < InputEventBuffer::Capacity + 3; ++i)
+    {
+        buffer.Push(MakeKey(sf::Keyboard::A), static_cast<double>(i));
+    }
+
+    ASSERT_EQ(buffer.Size(), InputEventBuffer::Capacity);
+    EXPECT_EQ(buffer.GetDroppedCount(), 3u);
+    EXPECT_DOUBLE_EQ(buffer[0].timeMs, 3.0);
+    EXPECT_DOUBLE_EQ(buffer[InputEventBuffer::Capacity - 1].timeMs, InputEventBuffer::Capacity + 2.0);
+}
+
+TEST(InputEventBufferTest, ClearEmptiesButKeepsTheDropCount)
+{
+    InputEventBuffer buffer;
+
+    for (std::size_t i = 0; i < InputEventBuffer::Capacity + 1; ++i)
+    {
+        buffer.Push(MakeKey(sf::Keyboard::A), 0.0);
+    }
+
+    buffer.Clear();
+    EXPECT_TRUE(buffer.IsEmpty());
+    EXPECT_EQ(buffer.GetDroppedCount(), 1u);
+
+    buffer.Push(MakeKey(sf::Keyboard::Z), 9.0);
+    ASSERT_EQ(buffer.Size(), 1u);
+    EXPECT_EQ(buffer[0].event.key.code, sf::Keyboard::Z);
+}
+
+TEST(InputEventBufferTest, ConsecutiveMotionIsMerged)
+{
+    InputEventBuffer buffer;
+
+    buffer.Push(MakeMouseMove(1, 1), 1.0);
+    buffer.Push(MakeMouseMove(2, 3), 2.0);
+    buffer.Push(MakeStick(0, sf::Joystick::X, 10.0f), 3.0);
+    buffer.Push(MakeStick(0, sf::Joystick::X, 20.0f), 4.0);
+    buffer.Push(MakeStick(0, sf::Joystick::Y, 5.0f), 5.0);
+    buffer.Push(MakeStick(1, sf::Joystick::Y, 6.0f), 6.0);
+    buffer.Push(MakeKey(sf::Keyboard::A), 7.0);
+    buffer.Push(MakeMouseMove(4, 5), 8.0);
+
+    ASSERT_EQ(buffer.Size(), 6u);
+    EXPECT_EQ(buffer.GetDroppedCount(), 0u);
+
+    EXPECT_EQ(buffer[0].event.mouseMove.x, 2);
+    EXPECT_EQ(buffer[0].event.mouseMove.y, 3);
+    EXPECT_DOUBLE_EQ(buffer[0].timeMs, 2.0);
+    EXPECT_FLOAT_EQ(buffer[1].event.joystickMove.position, 20.0f);
+    EXPECT_EQ(buffer[2].event.joystickMove.axis, sf::Joystick::Y);
+    EXPECT_EQ(buffer[3].event.joystickMove.joystickId, 1u);
+    EXPECT_EQ(buffer[4].event.type, sf::Event::KeyPressed);
+    EXPECT_EQ(buffer[5].event.mouseMove.x, 4);
+}
+
+TEST(InputEventBufferTest, FullBufferDropsMotionBeforePresses)
+{
+    InputEventBuffer buffer;
+    buffer.Push(MakeKey(sf::Keyboard::A), 0.0);
+
+    // Alternating sources are not merged, so they fill the buffer.
+    for (std::size_t i = 1; i < InputEventBuffer::Capacity; ++i)
+    {
+        const sf::Joystick::Axis axis = i % 2 == 0 ? sf::Joystick::X : sf::Joystick::Y;
+        buffer.Push(MakeStick(0, axis, static_cast<float>(i)), static_cast<double>(i));
+    }
+
+    buffer.Push(MakeKey(sf::Keyboard::B), 1000.0);
+
+    ASSERT_EQ(buffer.Size(), InputEventBuffer::Capacity);
+    EXPECT_EQ(buffer.GetDroppedCount(), 1u);
+    EXPECT_EQ(buffer[0].event.key.code, sf::Keyboard::A);
+    EXPECT_DOUBLE_EQ(buffer[1].timeMs, 2.0);
+    EXPECT_EQ(buffer[InputEventBuffer::Capacity - 1].event.key.code, sf::Keyboard::B);
+}
@@ -57,6 +57,21 @@ TEST_F(InputManagerTest, CanBindAndRetrieveKey)
     EXPECT_EQ(InputManager::Instance().GetBoundKey("Shoot"), sf::Keyboard::F);
 }
 
+TEST_F(InputManagerTest, HotReloadRebindsActionsKeepingTheirIds)
+{
+    const InputActionId moveUp = InputManager::Instance().GetActionId("MoveUp");
+    ASSERT_TRUE(moveUp.IsValid());
+
+    auto settings = CreateTestSettings();
+    settings->m_keyBindings["MoveUp"] = sf::Keyboard::Up;
+    settings->m_keyBindings["Dash"] = sf::Keyboard::LShift;
+    InputManager::Instance().HotReload(settings);
+
+    EXPECT_EQ(InputManager::Instance().GetActionId("MoveUp"), moveUp);
+    EXPECT_EQ(InputManager::Instance().GetBoundKey(moveUp), sf::Keyboard::Up);
+    EXPECT_EQ(InputManager::Instance().GetBoundKey("Dash"), sf::Keyboard::LShift);
+}
+
 TEST_F(InputManagerTest, CanUnbindKey)
 {
     InputManager::Instance().BindKey("Jump", sf::Keyboard::Space);
@@ -157,4 +172,126 @@ TEST_F(InputManagerTest, MouseButtonJustReleased)
     // Frame 3: Still released
     InputManager::Instance().PostUpdate();
     EXPECT_FALSE(InputManager::Instance().IsMouseButtonJustReleased(sf::Mouse::Right));
-}
\ No newline at end of file
+}
+
+TEST_F(InputManagerTest, ActionIdsMatchTheStringApi)
+{
+    const InputActionId shoot = InputManager::Instance().BindKey("Shoot", sf::Keyboard::F);
+
+    ASSERT_TRUE(shoot.IsValid());
+    EXPECT_EQ(InputManager::Instance().GetActionId("Shoot"), shoot);
+    EXPECT_EQ(InputManager::Instance().GetBoundKey(shoot), sf::Keyboard::F);
+    EXPECT_FALSE(InputManager::Instance().GetActionId("Fly").IsValid());
+
+    sf::Event event;
+    event.type = sf::Event::KeyPressed;
+    event.key.code = sf::Keyboard::F;
+    InputManager::Instance().Update(event);
+
+    EXPECT_TRUE(InputManager::Instance().IsKeyPressed(shoot));
+    EXPECT_TRUE(InputManager::Instance().IsKeyJustPressed(shoot));
+    EXPECT_EQ(InputManager::Instance().IsKeyJustPressed("Shoot"), InputManager::Instance().IsKeyJustPressed(shoot));
+
+    InputManager::Instance().PostUpdate();
+    event.type = sf::Event::KeyReleased;
+    InputManager::Instance().Update(event);
+
+    EXPECT_FALSE(InputManager::Instance().IsKeyPressed(shoot));
+    EXPECT_TRUE(InputManager::Instance().IsKeyJustReleased(shoot));
+    EXPECT_TRUE(InputManager::Instance().IsKeyJustReleased("Shoot"));
+}
+
+TEST_F(InputManagerTest, RebindingKeepsTheActionId)
+{
+    const InputActionId shoot = InputManager::Instance().BindKey("Shoot", sf::Keyboard::F);
+    EXPECT_EQ(InputManager::Instance().BindKey("Shoot", sf::Keyboard::Space), shoot);
+    EXPECT_EQ(InputManager::Instance().GetBoundKey(shoot), sf::Keyboard::Space);
+
+    // Unbound, the id stays but no key reads as pressed through it.
+    InputManager::Instance().UnbindKey("Shoot");
+    EXPECT_EQ(InputManager::Instance().GetActionId("Shoot"), shoot);
+    EXPECT_EQ(InputManager::Instance().GetBoundKey(shoot), sf::Keyboard::Unknown);
+    EXPECT_FALSE(InputManager::Instance().IsKeyPressed(shoot));
+    EXPECT_FALSE(InputManager::Instance().IsKeyPressed(InputActionId{}));
+}
+
+TEST_F(InputManagerTest, UnknownKeysAndButtonsAreIgnored)
+{
+    sf::Event event;
+    event.type = sf::Event::KeyPressed;
+    event.key.code = sf::Keyboard::Unknown;
+    InputManager::Instance().Update(event);
+
+    event.type = sf::Event::MouseButtonPressed;
+    event.mouseButton.button = sf::Mouse::ButtonCount;
+    InputManager::Instance().Update(event);
+
+    EXPECT_FALSE(InputManager::Instance().IsMouseButtonPressed(sf::Mouse::ButtonCount));
+    EXPECT_FALSE(InputManager::Instance().IsKeyPressed("MoveUp"));
+}
+
+TEST_F(InputManagerTest, FrameEventsKeepOrderAndTime)
+{
+    sf::Event press;
+    press.type = sf::Event::KeyPressed;
+    press.key.code = sf::Keyboard::D;
+
+    sf::Event release = press;
+    release.type = sf::Event::KeyReleased;
+
+    sf::Event resized;
+    resized.type = sf::Event::Resized;
+
+    // A tap inside one frame: the per frame state has lost it, the events have not.
+    InputManager::Instance().Update(press);
+    InputManager::Instance().Update(resized);
+    InputManager::Instance().Update(release);
+
+    EXPECT_FALSE(InputManager::Instance().IsKeyPressed("MoveRight"));
+
+    const InputEventBuffer &events = InputManager::Instance().GetFrameEvents();
+    ASSERT_EQ(events.Size(), 2u);
+    EXPECT_EQ(events[0].event.type, sf::Event::KeyPressed);
+    EXPECT_EQ(events[1].event.type, sf::Event::KeyReleased);
+    EXPECT_LE(events[0].timeMs, events[1].timeMs);
+    EXPECT_LE(events[1].timeMs, InputManager::Instance().NowMs());
+
+    const double lastMs = events[1].timeMs;
+
+    // The next frame starts empty, after the last event.
+    InputManager::Instance().PostUpdate();
+    EXPECT_TRUE(InputManager::Instance().GetFrameEvents().IsEmpty());
+    EXPECT_GE(InputManager::Instance().GetFrameStartMs(), lastMs);
+}
+
+TEST_F(InputManagerTest, SuppliedTimestampsAreKept)
+{
+    sf::Event press;
+    press.type = sf::Event::KeyPressed;
+    press.key.code = sf::Keyboard::W;
+
+    InputManager::Instance().Update(press, 12.5);
+
+    ASSERT_EQ(InputManager::Instance().GetFrameEvents().Size(), 1u);
+    EXPECT_DOUBLE_EQ(InputManager::Instance().GetFrameEvents()[0].timeMs, 12.5);
+    EXPECT_TRUE(InputManager::Instance().IsKeyJustPressed("MoveUp"));
+}
+
+TEST_F(InputManagerTest, ManualClockOnlyMovesWhenAdvanced)
+{
+    InputManager::Instance().SetManualClock(true);
+    ASSERT_TRUE(InputManager::Instance().IsManualClock());
+
+    const double startMs = InputManager::Instance().NowMs();
+    InputManager::Instance().AdvanceManualClock(16.0);
+    InputManager::Instance().AdvanceManualClock(-5.0);
+    EXPECT_DOUBLE_EQ(InputManager::Instance().NowMs(), startMs + 16.0);
+
+    InputManager::Instance().PostUpdate();
+    EXPECT_DOUBLE_EQ(InputManager::Instance().GetFrameStartMs(), startMs + 16.0);
+
+    // Back on the steady clock, time carries on from the manual one.
+    InputManager::Instance().SetManualClock(false);
+    EXPECT_FALSE(InputManager::Instance().IsManualClock());
+    EXPECT_GE(InputManager::Instance().NowMs(), startMs + 16.0);
+}
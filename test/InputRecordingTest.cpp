@@ -0,0 +1,185 @@
+// ============================================================================
+//  File        : InputRecordingTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-23
+//  Description : Unit tests for the Chaos Theory InputRecording class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "InputRecording.h"
+#include "TempDirectoryTest.h"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+class InputRecordingTest : public TempDirectoryTest
+{
+  protected:
+    InputRecordingTest()
+        : TempDirectoryTest("ct_input_recording_test"), m_path((m_root / "recording.ctir").generic_string())
+    {
+    }
+
+    std::string m_path;
+};
+
+// =========================================================================
+// TEST CASES
+// =========================================================================
+
+TEST_F(InputRecordingTest, FramesRoundTripThroughTheFile)
+{
+    InputEventBuffer buffer;
+
+    sf::Event key;
+    key.type = sf::Event::KeyPressed;
+    key.key = {sf::Keyboard::Escape, false, true, false, false};
+    buffer.Push(key, 1002.5);
+
+    sf::Event click;
+    click.type = sf::Event::MouseButtonReleased;
+    click.mouseButton = {sf::Mouse::Right, 640, -12};
+    buffer.Push(click, 1010.0);
+
+    sf::Event scroll;
+    scroll.type = sf::Event::MouseWheelScrolled;
+    scroll.mouseWheelScroll = {sf::Mouse::VerticalWheel, -1.5f, 3, 4};
+    buffer.Push(scroll, 1012.0);
+
+    sf::Event text;
+    text.type = sf::Event::TextEntered;
+    text.text.unicode = 0x263A;
+    buffer.Push(text, 1013.0);
+
+    InputRecording recording;
+    recording.AddFrame(0.016f, buffer, 1000.0);
+    recording.AddFrame(0.5f, InputEventBuffer{}, 1016.0);
+
+    ASSERT_TRUE(recording.SaveToFile(m_path));
+
+    InputRecording loaded;
+    ASSERT_TRUE(loaded.LoadFromFile(m_path));
+    ASSERT_EQ(loaded.GetFrameCount(), 2u);
+    EXPECT_EQ(loaded.GetEventCount(), 4u);
+
+    const InputFrame &frame = loaded.GetFrame(0);
+    EXPECT_FLOAT_EQ(frame.dt, 0.016f);
+    ASSERT_EQ(frame.events.size(), 4u);
+
+    EXPECT_EQ(frame.events[0].event.type, sf::Event::KeyPressed);
+    EXPECT_EQ(frame.events[0].event.key.code, sf::Keyboard::Escape);
+    EXPECT_TRUE(frame.events[0].event.key.control);
+    EXPECT_FALSE(frame.events[0].event.key.shift);
+    EXPECT_DOUBLE_EQ(frame.events[0].timeMs, 2.5);
+
+    EXPECT_EQ(frame.events[1].event.type, sf::Event::MouseButtonReleased);
+    EXPECT_EQ(frame.events[1].event.mouseButton.button, sf::Mouse::Right);
+    EXPECT_EQ(frame.events[1].event.mouseButton.x, 640);
+    EXPECT_EQ(frame.events[1].event.mouseButton.y, -12);
+    EXPECT_DOUBLE_EQ(frame.events[1].timeMs, 10.0);
+
+    EXPECT_EQ(frame.events[2].event.mouseWheelScroll.wheel, sf::Mouse::VerticalWheel);
+    EXPECT_FLOAT_EQ(frame.events[2].event.mouseWheelScroll.delta, -1.5f);
+    EXPECT_EQ(frame.events[3].event.text.unicode, 0x263Au);
+
+    EXPECT_FLOAT_EQ(loaded.GetFrame(1).dt, 0.5f);
+    EXPECT_TRUE(loaded.GetFrame(1).events.empty());
+}
+
+TEST_F(InputRecordingTest, WindowEventsAreLeftOut)
+{
+    InputFrame frame;
+    frame.dt = 0.016f;
+
+    sf::Event resized;
+    resized.type = sf::Event::Resized;
+    resized.size = {800, 600};
+    frame.events.push_back({resized, 0.0});
+
+    sf::Event moved;
+    moved.type = sf::Event::MouseMoved;
+    moved.mouseMove = {10, 20};
+    frame.events.push_back({moved, 1.0});
+
+    InputRecording recording;
+    recording.AddFrame(frame);
+    ASSERT_TRUE(recording.SaveToFile(m_path));
+
+    InputRecording loaded;
+    ASSERT_TRUE(loaded.LoadFromFile(m_path));
+    ASSERT_EQ(loaded.GetFrame(0).events.size(), 1u);
+    EXPECT_EQ(loaded.GetFrame(0).events[0].event.type, sf::Event::MouseMoved);
+    EXPECT_EQ(loaded.GetFrame(0).events[0].event.mouseMove.y, 20);
+}
+
+TEST_F(InputRecordingTest, CutLastFrameIsDroppedAndForeignFilesAreRejected)
+{
+    InputEventBuffer buffer;
+    sf::Event key;
+    key.type = sf::Event::KeyReleased;
+    key.key = {sf::Keyboard::A, false, false, false, false};
+    buffer.Push(key, 5.0);
+
+    InputRecording recording;
+    recording.AddFrame(0.016f, buffer, 0.0);
+    recording.AddFrame(0.02f, buffer, 16.0);
+    ASSERT_TRUE(recording.SaveToFile(m_path));
+
+    // As if the process died while writing the second frame.
+    std::filesystem::resize_file(m_path, std::filesystem::file_size(m_path) - 1);
+
+    InputRecording loaded;
+    ASSERT_TRUE(loaded.LoadFromFile(m_path));
+    ASSERT_EQ(loaded.GetFrameCount(), 1u);
+    EXPECT_FLOAT_EQ(loaded.GetFrame(0).dt, 0.016f);
+
+    // A header cut short is no recording at all.
+    std::filesystem::resize_file(m_path, 6);
+    EXPECT_FALSE(loaded.LoadFromFile(m_path));
+    EXPECT_EQ(loaded.GetFrameCount(), 0u);
+
+    WriteFile(m_path, "not a recording at all");
+    EXPECT_FALSE(loaded.LoadFromFile(m_path));
+    EXPECT_FALSE(loaded.LoadFromFile(m_path + ".missing"));
+
+    // Version 1 headers carried a frame count; such recordings are refused rather than misread as frames.
+    {
+        std::ofstream out(m_path, std::ios::binary | std::ios::trunc);
+        const std::uint32_t header[] = {0x52495443, 1, 0xFFFFFFFF};
+        out.write(reinterpret_cast<const char *>(header), sizeof(header));
+    }
+
+    EXPECT_FALSE(loaded.LoadFromFile(m_path));
+}
+
+TEST_F(InputRecordingTest, WrittenFramesAreOnDiskBeforeClose)
+{
+    InputEventBuffer buffer;
+    sf::Event key;
+    key.type = sf::Event::KeyPressed;
+    key.key = {sf::Keyboard::Space, false, false, false, false};
+    buffer.Push(key, 103.0);
+
+    InputRecordingWriter writer;
+    ASSERT_TRUE(writer.Open(m_path));
+    ASSERT_TRUE(writer.WriteFrame(0.016f, buffer, 100.0));
+    ASSERT_TRUE(writer.WriteFrame(0.02f, InputEventBuffer{}, 116.0));
+
+    // As if the process died here: the file already holds both frames.
+    InputRecording loaded;
+    ASSERT_TRUE(loaded.LoadFromFile(m_path));
+    ASSERT_EQ(loaded.GetFrameCount(), 2u);
+    ASSERT_EQ(loaded.GetFrame(0).events.size(), 1u);
+    EXPECT_EQ(loaded.GetFrame(0).events[0].event.key.code, sf::Keyboard::Space);
+    EXPECT_DOUBLE_EQ(loaded.GetFrame(0).events[0].timeMs, 3.0);
+    EXPECT_FLOAT_EQ(loaded.GetFrame(1).dt, 0.02f);
+
+    EXPECT_TRUE(writer.Close());
+    EXPECT_EQ(writer.GetFrameCount(), 2u);
+    EXPECT_EQ(writer.GetEventCount(), 1u);
+    EXPECT_FALSE(writer.IsOpen());
+    EXPECT_FALSE(writer.WriteFrame(0.016f, buffer, 0.0));
+}
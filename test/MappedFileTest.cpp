@@ -0,0 +1,80 @@
+// ============================================================================
+//  File        : MappedFileTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-09
+//  Description : Unit tests for the Chaos Theory MappedFile class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "MappedFile.h"
+#include "TempDirectoryTest.h"
+#include <cstring>
+#include <filesystem>
+#include <gtest/gtest.h>
+
+class MappedFileTest : public TempDirectoryTest
+{
+  protected:
+    MappedFileTest() : TempDirectoryTest("ct_mapped_file_test"), m_path(m_root / "mapped.bin")
+    {
+    }
+
+    std::filesystem::path m_path;
+};
+
+// =========================================================================
+// TEST CASES
+// =========================================================================
+
+TEST_F(MappedFileTest, MapsTheWholeFile)
+{
+    WriteFile(m_path, "chaos theory");
+
+    MappedFile file;
+    ASSERT_TRUE(file.Open(m_path.string()));
+
+    EXPECT_TRUE(file.IsOpen());
+    ASSERT_EQ(file.Size(), 12u);
+    EXPECT_EQ(std::memcmp(file.Data(), "chaos theory", 12), 0);
+}
+
+TEST_F(MappedFileTest, MissingFileFailsToOpen)
+{
+    MappedFile file;
+
+    EXPECT_FALSE(file.Open((std::filesystem::temp_directory_path() / "ct_mapped_file_missing.bin").string()));
+    EXPECT_FALSE(file.IsOpen());
+    EXPECT_EQ(file.Data(), nullptr);
+}
+
+TEST_F(MappedFileTest, EmptyFileOpensWithoutData)
+{
+    WriteFile(m_path, "");
+
+    MappedFile file;
+    ASSERT_TRUE(file.Open(m_path.string()));
+
+    EXPECT_EQ(file.Size(), 0u);
+    EXPECT_EQ(file.Data(), nullptr);
+}
+
+TEST_F(MappedFileTest, MoveTransfersTheMapping)
+{
+    WriteFile(m_path, "moved");
+
+    MappedFile first;
+    ASSERT_TRUE(first.Open(m_path.string()));
+    const std::uint8_t *data = first.Data();
+
+    MappedFile second = std::move(first);
+
+    EXPECT_FALSE(first.IsOpen());
+    EXPECT_EQ(first.Data(), nullptr);
+    EXPECT_TRUE(second.IsOpen());
+    EXPECT_EQ(second.Data(), data);
+
+    second.Close();
+    EXPECT_FALSE(second.IsOpen());
+}
@@ -0,0 +1,83 @@
+// ============================================================================
+//  File        : MixKernelsTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-15
+//  Description : Unit tests for the Chaos Theory software mixer kernels
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "MixKernels.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+/// @brief Deterministic samples covering the full 16 bit range; odd length so the SIMD tail is exercised.
+std::vector<std::int16_t> MakeSamples(std::size_t count)
+{
+    std::vector<std::int16_t> samples(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        samples[i] = static_cast<std::int16_t>((i * 7919) % 65536 - 32768);
+    }
+
+    return samples;
+}
+} // namespace
+
+TEST(MixKernelsTest, StereoMatchesScalar)
+{
+    const std::size_t frames = 37;
+    const auto source = MakeSamples(frames * 2);
+
+    std::vector<float> simd(frames * 2, 1.f);
+    std::vector<float> scalar(frames * 2, 1.f);
+
+    MixStereo(simd.data(), source.data(), frames, 0.5f, 0.25f);
+    MixStereoScalar(scalar.data(), source.data(), frames, 0.5f, 0.25f);
+
+    for (std::size_t i = 0; i < simd.size(); ++i)
+    {
+        EXPECT_FLOAT_EQ(simd[i], scalar[i]);
+    }
+}
+
+TEST(MixKernelsTest, MonoIsSpreadToBothChannels)
+{
+    const std::size_t frames = 13;
+    const auto source = MakeSamples(frames);
+
+    std::vector<float> simd(frames * 2, 0.f);
+    std::vector<float> scalar(frames * 2, 0.f);
+
+    MixMonoToStereo(simd.data(), source.data(), frames, 1.f, 0.5f);
+    MixMonoToStereoScalar(scalar.data(), source.data(), frames, 1.f, 0.5f);
+
+    for (std::size_t i = 0; i < frames; ++i)
+    {
+        EXPECT_FLOAT_EQ(simd[i * 2], static_cast<float>(source[i]));
+        EXPECT_FLOAT_EQ(simd[i * 2 + 1], source[i] * 0.5f);
+        EXPECT_FLOAT_EQ(simd[i * 2], scalar[i * 2]);
+        EXPECT_FLOAT_EQ(simd[i * 2 + 1], scalar[i * 2 + 1]);
+    }
+}
+
+TEST(MixKernelsTest, ConversionClipsToSixteenBits)
+{
+    const std::vector<float> mix = {0.f, 1.4f, -1.6f, 40000.f, -40000.f, 32767.f, -32768.f, 100.f, 12.5f, -7.f};
+    std::vector<std::int16_t> simd(mix.size());
+    std::vector<std::int16_t> scalar(mix.size());
+
+    ConvertToInt16(mix.data(), simd.data(), mix.size());
+    ConvertToInt16Scalar(mix.data(), scalar.data(), mix.size());
+
+    EXPECT_EQ(simd, scalar);
+    EXPECT_EQ(simd[1], 1);
+    EXPECT_EQ(simd[2], -2);
+    EXPECT_EQ(simd[3], 32767);
+    EXPECT_EQ(simd[4], -32768);
+    EXPECT_EQ(simd[7], 100);
+}
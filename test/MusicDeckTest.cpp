@@ -0,0 +1,123 @@
+// ============================================================================
+//  File        : MusicDeckTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-14
+//  Description : Unit tests for the Chaos Theory MusicDeck class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "MusicDeck.h"
+#include "LogManager.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+class MusicDeckTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        if (!LogManager::Instance().IsInitialized())
+        {
+            LogManager::Instance().Init();
+        }
+    }
+
+    MusicDeck m_deck;
+};
+
+TEST_F(MusicDeckTest, OpenDoesNotStartPlayback)
+{
+    ASSERT_TRUE(m_deck.Open("assets/audio/Default.wav"));
+
+    EXPECT_TRUE(m_deck.IsOpen());
+    EXPECT_EQ(m_deck.GetTrack(), "assets/audio/Default.wav");
+    EXPECT_FALSE(m_deck.IsPlaying());
+
+    m_deck.Play();
+    EXPECT_TRUE(m_deck.IsPlaying());
+
+    m_deck.Close();
+    EXPECT_FALSE(m_deck.IsOpen());
+    EXPECT_TRUE(m_deck.GetTrack().empty());
+}
+
+TEST_F(MusicDeckTest, MissingFileLeavesDeckClosed)
+{
+    EXPECT_FALSE(m_deck.Open("assets/audio/DoesNotExist.wav"));
+    EXPECT_FALSE(m_deck.IsOpen());
+}
+
+TEST_F(MusicDeckTest, LoopPointsMustBeInsideTheTrack)
+{
+    EXPECT_FALSE(m_deck.SetLoopPoints({0, 100}));
+
+    ASSERT_TRUE(m_deck.Open("assets/audio/Default.wav"));
+
+    EXPECT_TRUE(m_deck.SetLoopPoints({0, 0}));
+    EXPECT_TRUE(m_deck.SetLoopPoints({100, 200}));
+    EXPECT_FALSE(m_deck.SetLoopPoints({200, 100}));
+}
+
+TEST_F(MusicDeckTest, GainIsClamped)
+{
+    m_deck.SetGain(2.f);
+    EXPECT_FLOAT_EQ(m_deck.GetGain(), 1.f);
+
+    m_deck.SetGain(-1.f);
+    EXPECT_FLOAT_EQ(m_deck.GetGain(), 0.f);
+}
+
+TEST_F(MusicDeckTest, PrimeLeavesTheDeckSilentAndStopped)
+{
+    m_deck.Prime();
+    EXPECT_FALSE(m_deck.IsPrimed());
+
+    ASSERT_TRUE(m_deck.Open("assets/audio/Default.wav"));
+    m_deck.Prime();
+
+    EXPECT_TRUE(m_deck.IsPrimed());
+    EXPECT_FALSE(m_deck.IsPlaying());
+    EXPECT_FALSE(m_deck.IsPaused());
+
+    m_deck.Play();
+    EXPECT_TRUE(m_deck.IsPlaying());
+    EXPECT_FALSE(m_deck.IsPrimed());
+}
+
+TEST_F(MusicDeckTest, FadeLastsUntilTheDeckStops)
+{
+    ASSERT_TRUE(m_deck.Open("assets/audio/Default.wav"));
+    m_deck.Play();
+
+    m_deck.FadeTo(0.f, 5.f, EnvelopeCurve::Exponential);
+    EXPECT_TRUE(m_deck.IsFading());
+
+    m_deck.Stop();
+    EXPECT_FALSE(m_deck.IsFading());
+
+    m_deck.SetGain(0.5f);
+    EXPECT_FLOAT_EQ(m_deck.GetGain(), 0.5f);
+}
+
+TEST_F(MusicDeckTest, OfflineDeckRendersOnDemand)
+{
+    ASSERT_TRUE(m_deck.Open("assets/audio/Default.wav"));
+    m_deck.SetOffline(true);
+    m_deck.Play();
+    EXPECT_TRUE(m_deck.IsPlaying());
+
+    // Nothing plays on its own: a fade only moves as frames are rendered.
+    m_deck.FadeTo(0.f, 0.01f, EnvelopeCurve::Linear);
+    EXPECT_TRUE(m_deck.IsFading());
+
+    std::vector<float> mix(480 * 2, 0.f);
+    m_deck.Render(mix.data(), 480, 48000);
+    EXPECT_FALSE(m_deck.IsFading());
+    EXPECT_FLOAT_EQ(m_deck.GetGain(), 0.f);
+
+    // A mix at another rate cannot take the track.
+    m_deck.Render(mix.data(), 480, 44100);
+    EXPECT_FALSE(m_deck.IsPlaying());
+}
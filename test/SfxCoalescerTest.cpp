@@ -0,0 +1,89 @@
+// ============================================================================
+//  File        : SfxCoalescerTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-13
+//  Description : Unit tests for the Chaos Theory SfxCoalescer class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "SfxCoalescer.h"
+#include <cmath>
+#include <gtest/gtest.h>
+
+class SfxCoalescerTest : public ::testing::Test
+{
+  protected:
+    const AssetId m_shot = MakeAssetId("PewPew");
+    const AssetId m_bomb = MakeAssetId("Bomb");
+
+    sf::SoundBuffer m_shotBuffer;
+    sf::SoundBuffer m_bombBuffer;
+
+    std::unordered_map<AssetId, SfxParams> m_params;
+    SfxCoalescer m_coalescer;
+};
+
+TEST_F(SfxCoalescerTest, SameFrameRequestsMergeIntoOne)
+{
+    for (int i = 0; i < 24; ++i)
+    {
+        m_coalescer.Queue(m_shot, m_shotBuffer);
+    }
+
+    m_coalescer.Queue(m_bomb, m_bombBuffer);
+
+    EXPECT_EQ(m_coalescer.GetPendingCount(), 2u);
+
+    const auto &requests = m_coalescer.Flush(0.0, m_params);
+
+    ASSERT_EQ(requests.size(), 2u);
+    EXPECT_EQ(requests[0].id, m_shot);
+    EXPECT_EQ(requests[0].count, 24u);
+    EXPECT_FALSE(requests[0].isRetrigger);
+    EXPECT_EQ(requests[1].count, 1u);
+    EXPECT_EQ(m_coalescer.GetMergedCount(), 23u);
+    EXPECT_EQ(m_coalescer.GetPendingCount(), 0u);
+}
+
+TEST_F(SfxCoalescerTest, RequestsInsideTheRetriggerIntervalAreMarked)
+{
+    m_params[m_shot].minRetriggerMs = 40.f;
+
+    m_coalescer.Queue(m_shot, m_shotBuffer);
+    EXPECT_FALSE(m_coalescer.Flush(0.0, m_params)[0].isRetrigger);
+
+    m_coalescer.Queue(m_shot, m_shotBuffer);
+    EXPECT_TRUE(m_coalescer.Flush(16.0, m_params)[0].isRetrigger);
+
+    m_coalescer.Queue(m_shot, m_shotBuffer);
+    EXPECT_TRUE(m_coalescer.Flush(33.0, m_params)[0].isRetrigger);
+
+    // Measured from the last real start, not from the last merge.
+    m_coalescer.Queue(m_shot, m_shotBuffer);
+    EXPECT_FALSE(m_coalescer.Flush(50.0, m_params)[0].isRetrigger);
+}
+
+TEST_F(SfxCoalescerTest, WindowAppliesToSoundsWithoutParams)
+{
+    m_coalescer.SetWindowMs(10.f);
+
+    m_coalescer.Queue(m_bomb, m_bombBuffer);
+    m_coalescer.Flush(0.0, m_params);
+
+    m_coalescer.Queue(m_bomb, m_bombBuffer);
+    EXPECT_TRUE(m_coalescer.Flush(5.0, m_params)[0].isRetrigger);
+
+    m_coalescer.SetWindowMs(0.f);
+    m_coalescer.Queue(m_bomb, m_bombBuffer);
+    EXPECT_FALSE(m_coalescer.Flush(6.0, m_params)[0].isRetrigger);
+}
+
+TEST_F(SfxCoalescerTest, GainGrowsWithCountButIsCapped)
+{
+    EXPECT_FLOAT_EQ(SfxCoalescer::GainFor(0), 1.f);
+    EXPECT_FLOAT_EQ(SfxCoalescer::GainFor(1), 1.f);
+    EXPECT_FLOAT_EQ(SfxCoalescer::GainFor(2), std::sqrt(2.f));
+    EXPECT_FLOAT_EQ(SfxCoalescer::GainFor(100), 2.f);
+}
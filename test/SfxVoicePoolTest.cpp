@@ -0,0 +1,169 @@
+// ============================================================================
+//  File        : SfxVoicePoolTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-12
+//  Description : Unit tests for the Chaos Theory SfxVoicePool class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "SfxVoicePool.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace
+{
+constexpr std::size_t NO_LIMIT = std::numeric_limits<std::size_t>::max();
+
+SfxVoiceState Playing(int priority, SfxCategory category, float ageMs = 0.f, float audibility = 1.f)
+{
+    SfxVoiceState state;
+    state.isPlaying = true;
+    state.priority = priority;
+    state.category = category;
+    state.ageMs = ageMs;
+    state.audibility = audibility;
+
+    return state;
+}
+} // namespace
+
+TEST(SfxVoicePoolTest, FreeVoiceIsPreferred)
+{
+    const std::vector<SfxVoiceState> voices = {Playing(0, SfxCategory::Weapon), SfxVoiceState{}};
+
+    EXPECT_EQ(SfxVoicePool::ChooseVoice(voices, {10, SfxCategory::Explosion}, NO_LIMIT), 1);
+}
+
+TEST(SfxVoicePoolTest, LowestPriorityIsStolenFirst)
+{
+    const std::vector<SfxVoiceState> voices = {Playing(10, SfxCategory::Explosion, 900.f),
+                                               Playing(0, SfxCategory::Weapon, 10.f)};
+
+    EXPECT_EQ(SfxVoicePool::ChooseVoice(voices, {10, SfxCategory::Explosion}, NO_LIMIT), 1);
+}
+
+TEST(SfxVoicePoolTest, OlderThenQuieterBreakPriorityTies)
+{
+    const std::vector<SfxVoiceState> byAge = {Playing(0, SfxCategory::Weapon, 50.f),
+                                              Playing(0, SfxCategory::Weapon, 400.f)};
+
+    EXPECT_EQ(SfxVoicePool::ChooseVoice(byAge, {0, SfxCategory::Weapon}, NO_LIMIT), 1);
+
+    // Started within the same few milliseconds, so the quieter one goes.
+    const std::vector<SfxVoiceState> byVolume = {Playing(0, SfxCategory::Weapon, 100.f, 0.8f),
+                                                 Playing(0, SfxCategory::Weapon, 105.f, 0.3f)};
+
+    EXPECT_EQ(SfxVoicePool::ChooseVoice(byVolume, {0, SfxCategory::Weapon}, NO_LIMIT), 1);
+}
+
+TEST(SfxVoicePoolTest, HigherPriorityVoicesAreNeverStolen)
+{
+    const std::vector<SfxVoiceState> voices = {Playing(10, SfxCategory::Explosion),
+                                               Playing(10, SfxCategory::Explosion)};
+
+    EXPECT_EQ(SfxVoicePool::ChooseVoice(voices, {0, SfxCategory::Weapon}, NO_LIMIT), -1);
+}
+
+TEST(SfxVoicePoolTest, FullCategoryStealsFromItself)
+{
+    const std::vector<SfxVoiceState> voices = {Playing(0, SfxCategory::Default, 900.f),
+                                               Playing(0, SfxCategory::Weapon, 10.f), SfxVoiceState{}};
+
+    EXPECT_EQ(SfxVoicePool::ChooseVoice(voices, {0, SfxCategory::Weapon}, 1), 1);
+}
+
+TEST(SfxVoicePoolTest, HeavyFireNeverCutsTheBomb)
+{
+    const std::vector<sf::Int16> samples(44100, 1000);
+    sf::SoundBuffer buffer;
+    ASSERT_TRUE(buffer.loadFromSamples(samples.data(), samples.size(), 1, 44100));
+
+    SfxVoicePool pool;
+    pool.SetVoiceCount(4);
+    pool.SetCategoryLimit(SfxCategory::Weapon, 4);
+
+    const SfxVoicePool::VoiceId bomb = pool.Play(buffer, {10, SfxCategory::Explosion}, 100.f);
+    ASSERT_NE(bomb, SfxVoicePool::INVALID_VOICE);
+
+    for (int shot = 0; shot < 32; ++shot)
+    {
+        pool.Play(buffer, {0, SfxCategory::Weapon}, 100.f);
+    }
+
+    EXPECT_EQ(pool.GetVoice(bomb)->getStatus(), sf::Sound::Playing);
+    EXPECT_EQ(pool.GetActiveCount(SfxCategory::Explosion), 1u);
+    EXPECT_EQ(pool.GetActiveCount(SfxCategory::Weapon), 3u);
+    EXPECT_EQ(pool.GetStealCount(), 29u);
+}
+
+TEST(SfxVoicePoolTest, LimitsAreClampedToTheVoiceCount)
+{
+    SfxVoicePool pool;
+    pool.SetVoiceCount(0);
+
+    EXPECT_EQ(pool.GetVoiceCount(), 1u);
+    EXPECT_EQ(pool.GetCategoryLimit(SfxCategory::Default), 1u);
+}
+
+TEST(SfxVoicePoolTest, InstanceLimitRestartsTheOldestCopy)
+{
+    std::vector<SfxVoiceState> voices = {Playing(0, SfxCategory::Weapon, 300.f), Playing(0, SfxCategory::Weapon, 80.f),
+                                         SfxVoiceState{}};
+    voices[0].isSameSound = true;
+    voices[1].isSameSound = true;
+
+    SfxParams params{0, SfxCategory::Weapon};
+    params.maxInstances = 2;
+
+    EXPECT_EQ(SfxVoicePool::ChooseVoice(voices, params, NO_LIMIT), 0);
+
+    params.maxInstances = 3;
+
+    EXPECT_EQ(SfxVoicePool::ChooseVoice(voices, params, NO_LIMIT), 2);
+}
+
+TEST(SfxVoicePoolTest, PlayFreeNeverSteals)
+{
+    const std::vector<sf::Int16> samples(44100, 1000);
+    sf::SoundBuffer buffer;
+    ASSERT_TRUE(buffer.loadFromSamples(samples.data(), samples.size(), 1, 44100));
+
+    SfxVoicePool pool;
+    pool.SetVoiceCount(1);
+
+    ASSERT_NE(pool.PlayFree(buffer, {0, SfxCategory::Default}, 100.f), SfxVoicePool::INVALID_VOICE);
+    EXPECT_EQ(pool.PlayFree(buffer, {10, SfxCategory::Default}, 100.f), SfxVoicePool::INVALID_VOICE);
+
+    EXPECT_EQ(pool.GetActiveCount(), 1u);
+    EXPECT_EQ(pool.GetStealCount(), 0u);
+    EXPECT_EQ(pool.GetRejectCount(), 0u);
+}
+
+TEST(SfxVoicePoolTest, VoiceIdsSurviveResizes)
+{
+    const std::vector<sf::Int16> samples(44100, 1000);
+    sf::SoundBuffer buffer;
+    ASSERT_TRUE(buffer.loadFromSamples(samples.data(), samples.size(), 1, 44100));
+
+    SfxVoicePool pool;
+    pool.SetVoiceCount(2);
+
+    const SfxVoicePool::VoiceId first = pool.Play(buffer, {0, SfxCategory::Default}, 100.f);
+    const SfxVoicePool::VoiceId second = pool.Play(buffer, {0, SfxCategory::Default}, 100.f);
+    ASSERT_NE(first, second);
+
+    // Growing moves every voice in memory; the ids still find them.
+    pool.SetVoiceCount(64);
+    ASSERT_NE(pool.GetVoice(first), nullptr);
+    EXPECT_EQ(pool.GetVoice(first)->getStatus(), sf::Sound::Playing);
+    EXPECT_EQ(pool.GetVoice(second)->getBuffer(), &buffer);
+
+    // Shrinking removes the voices past the count; their ids stop resolving.
+    pool.SetVoiceCount(std::min(first, second) + 1);
+    EXPECT_NE(pool.GetVoice(std::min(first, second)), nullptr);
+    EXPECT_EQ(pool.GetVoice(std::max(first, second)), nullptr);
+    EXPECT_EQ(pool.GetVoice(SfxVoicePool::INVALID_VOICE), nullptr);
+}
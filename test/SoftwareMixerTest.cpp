@@ -0,0 +1,177 @@
+// ============================================================================
+//  File        : SoftwareMixerTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-15
+//  Description : Unit tests for the Chaos Theory SoftwareMixer class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "SoftwareMixer.h"
+#include "LogManager.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+class SoftwareMixerTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        if (!LogManager::Instance().IsInitialized())
+        {
+            LogManager::Instance().Init();
+        }
+    }
+
+    /// @brief Builds a buffer holding a constant sample value.
+    static void Fill(sf::SoundBuffer &buffer, sf::Int16 value, std::size_t frames, unsigned int channels,
+                     unsigned int sampleRate = 44100)
+    {
+        const std::vector<sf::Int16> samples(frames * channels, value);
+        ASSERT_TRUE(buffer.loadFromSamples(samples.data(), samples.size(), channels, sampleRate));
+    }
+
+    AudioBuses m_buses;
+};
+
+TEST_F(SoftwareMixerTest, VoicesAreSummedAndClipped)
+{
+    SoftwareMixer mixer(m_buses);
+    sf::SoundBuffer mono;
+    sf::SoundBuffer stereo;
+    Fill(mono, 1000, 64, 1);
+    Fill(stereo, 30000, 64, 2);
+
+    EXPECT_NE(mixer.Play(mono, AudioBusId::Sfx, 1.f), SoftwareMixer::INVALID_VOICE);
+    EXPECT_NE(mixer.Play(mono, AudioBusId::UI, 0.5f), SoftwareMixer::INVALID_VOICE);
+
+    std::vector<sf::Int16> output(16 * 2);
+    mixer.Mix(output.data(), 16);
+    EXPECT_EQ(output[0], 1500);
+    EXPECT_EQ(output[1], 1500);
+
+    mixer.Play(stereo, AudioBusId::Sfx, 1.f);
+    mixer.Mix(output.data(), 16);
+    EXPECT_EQ(output[0], 31500);
+
+    mixer.Play(stereo, AudioBusId::Sfx, 1.f);
+    mixer.Mix(output.data(), 16);
+    EXPECT_EQ(output[0], 32767);
+}
+
+TEST_F(SoftwareMixerTest, BusGainAppliesToPlayingVoices)
+{
+    SoftwareMixer mixer(m_buses);
+    sf::SoundBuffer buffer;
+    Fill(buffer, 1000, 64, 1);
+    mixer.Play(buffer, AudioBusId::Sfx, 1.f);
+
+    std::vector<sf::Int16> output(8 * 2);
+
+    m_buses.SetGain(AudioBusId::Sfx, 0.5f);
+    mixer.Mix(output.data(), 8);
+    EXPECT_EQ(output[0], 500);
+
+    m_buses.SetMuted(AudioBusId::Master, true);
+    mixer.Mix(output.data(), 8);
+    EXPECT_EQ(output[0], 0);
+}
+
+TEST_F(SoftwareMixerTest, VoicesEndWithTheirBuffer)
+{
+    SoftwareMixer mixer(m_buses);
+    sf::SoundBuffer buffer;
+    Fill(buffer, 1000, 10, 2);
+
+    const auto voice = mixer.Play(buffer, AudioBusId::Sfx, 1.f);
+    EXPECT_TRUE(mixer.IsVoicePlaying(voice));
+
+    std::vector<sf::Int16> output(16 * 2);
+    mixer.Mix(output.data(), 16);
+
+    EXPECT_EQ(output[9 * 2], 1000);
+    EXPECT_EQ(output[10 * 2], 0);
+    EXPECT_FALSE(mixer.IsVoicePlaying(voice));
+    EXPECT_EQ(mixer.GetActiveVoiceCount(), 0u);
+}
+
+TEST_F(SoftwareMixerTest, RejectsBuffersAtAnotherRate)
+{
+    SoftwareMixer mixer(m_buses);
+    sf::SoundBuffer buffer;
+    Fill(buffer, 1000, 10, 1, 22050);
+
+    EXPECT_FALSE(mixer.CanMix(buffer));
+    EXPECT_EQ(mixer.Play(buffer, AudioBusId::Sfx, 1.f), SoftwareMixer::INVALID_VOICE);
+}
+
+TEST_F(SoftwareMixerTest, StopAndGainChangesApplyToOneVoice)
+{
+    SoftwareMixer mixer(m_buses);
+    sf::SoundBuffer buffer;
+    Fill(buffer, 1000, 64, 1);
+
+    const auto first = mixer.Play(buffer, AudioBusId::Sfx, 1.f);
+    const auto second = mixer.Play(buffer, AudioBusId::Sfx, 1.f);
+
+    mixer.SetVoiceGain(second, 2.f);
+    mixer.Stop(first);
+
+    std::vector<sf::Int16> output(4 * 2);
+    mixer.Mix(output.data(), 4);
+
+    EXPECT_EQ(output[0], 2000);
+    EXPECT_EQ(mixer.GetActiveVoiceCount(), 1u);
+
+    mixer.StopAll();
+    EXPECT_EQ(mixer.GetActiveVoiceCount(), 0u);
+}
+
+TEST_F(SoftwareMixerTest, PanBalancesLeftAndRight)
+{
+    SoftwareMixer mixer(m_buses);
+    sf::SoundBuffer buffer;
+    Fill(buffer, 1000, 64, 1);
+
+    const auto voice = mixer.Play(buffer, AudioBusId::Sfx, 1.f, -0.5f);
+
+    std::vector<sf::Int16> output(4 * 2);
+    mixer.Mix(output.data(), 4);
+    EXPECT_EQ(output[0], 1000);
+    EXPECT_EQ(output[1], 500);
+
+    mixer.SetVoicePan(voice, 1.f);
+    mixer.Mix(output.data(), 4);
+    EXPECT_EQ(output[0], 0);
+    EXPECT_EQ(output[1], 1000);
+}
+
+TEST_F(SoftwareMixerTest, AccumulateAddsToAnExistingMix)
+{
+    SoftwareMixer mixer(m_buses);
+    sf::SoundBuffer buffer;
+    Fill(buffer, 1000, 64, 1);
+
+    mixer.Play(buffer, AudioBusId::Sfx, 1.f);
+
+    std::vector<float> mix(4 * 2, 250.f);
+    mixer.Accumulate(mix.data(), 4);
+    EXPECT_FLOAT_EQ(mix[0], 1250.f);
+    EXPECT_FLOAT_EQ(mix[7], 1250.f);
+}
+
+TEST_F(SoftwareMixerTest, VoicesCanStartPartWayThrough)
+{
+    SoftwareMixer mixer(m_buses);
+    sf::SoundBuffer buffer;
+    Fill(buffer, 1000, 64, 1);
+
+    mixer.Play(buffer, AudioBusId::Sfx, 1.f, 0.f, 60);
+
+    std::vector<sf::Int16> output(8 * 2);
+    mixer.Mix(output.data(), 8);
+    EXPECT_EQ(output[6], 1000);
+    EXPECT_EQ(output[8], 0);
+    EXPECT_EQ(mixer.GetActiveVoiceCount(), 0u);
+}
@@ -0,0 +1,111 @@
+// ============================================================================
+//  File        : SoundDiskCacheTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-21
+//  Description : Unit tests for the Chaos Theory SoundDiskCache class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "SoundDiskCache.h"
+#include "TempDirectoryTest.h"
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <vector>
+
+class SoundDiskCacheTest : public TempDirectoryTest
+{
+  protected:
+    SoundDiskCacheTest() : TempDirectoryTest("ct_sound_disk_cache_test")
+    {
+    }
+
+    void SetUp() override
+    {
+        TempDirectoryTest::SetUp();
+
+        m_source = m_root / "source.wav";
+        WriteFile(m_source, "encoded sound");
+
+        m_cache.SetDirectory((m_root / "cache").generic_string());
+
+        // 5 stereo frames, every sample distinct.
+        for (std::int16_t i = 0; i < 10; ++i)
+        {
+            m_samples.push_back(static_cast<std::int16_t>(i * 1000 - 5000));
+        }
+    }
+
+    bool StoreSource(unsigned int channelCount = 2)
+    {
+        const std::size_t size = std::filesystem::file_size(m_source);
+
+        return m_cache.Store(m_source.generic_string(), 1234u, size, 44100, channelCount, m_samples.data(),
+                             m_samples.size());
+    }
+
+    SoundDiskCache m_cache;
+    std::filesystem::path m_source;
+    std::vector<std::int16_t> m_samples;
+};
+
+// =========================================================================
+// TEST CASES
+// =========================================================================
+
+TEST_F(SoundDiskCacheTest, StoredSamplesLoadBackMapped)
+{
+    ASSERT_TRUE(StoreSource());
+
+    CookedSound cooked;
+    ASSERT_TRUE(m_cache.Load(m_source.generic_string(), 44100, cooked));
+
+    EXPECT_TRUE(cooked.IsValid());
+    EXPECT_EQ(cooked.sampleRate, 44100u);
+    EXPECT_EQ(cooked.channelCount, 2u);
+    EXPECT_EQ(cooked.sampleCount, m_samples.size());
+    EXPECT_EQ(cooked.contentHash, 1234u);
+    EXPECT_TRUE(std::equal(m_samples.begin(), m_samples.end(), cooked.samples));
+}
+
+TEST_F(SoundDiskCacheTest, OtherSampleRateMisses)
+{
+    ASSERT_TRUE(StoreSource());
+
+    CookedSound cooked;
+    EXPECT_FALSE(m_cache.Load(m_source.generic_string(), 48000, cooked));
+    EXPECT_FALSE(cooked.IsValid());
+}
+
+TEST_F(SoundDiskCacheTest, ChannelLayoutRoundTrips)
+{
+    ASSERT_TRUE(StoreSource(1));
+
+    CookedSound cooked;
+    ASSERT_TRUE(m_cache.Load(m_source.generic_string(), 44100, cooked));
+    EXPECT_EQ(cooked.channelCount, 1u);
+    EXPECT_EQ(cooked.sampleCount, m_samples.size());
+
+    EXPECT_FALSE(StoreSource(0));
+}
+
+TEST_F(SoundDiskCacheTest, EntryOfAnotherVersionMisses)
+{
+    ASSERT_TRUE(StoreSource());
+
+    // The version follows the magic; entries normalized by another version must be redone.
+    {
+        const std::string path = m_cache.EntryPath(m_source.generic_string());
+        std::fstream entry(path, std::ios::binary | std::ios::in | std::ios::out);
+        const std::uint32_t version = 999;
+        entry.seekp(sizeof(std::uint32_t));
+        entry.write(reinterpret_cast<const char *>(&version), sizeof(version));
+    }
+
+    CookedSound cooked;
+    EXPECT_FALSE(m_cache.Load(m_source.generic_string(), 44100, cooked));
+}
@@ -0,0 +1,158 @@
+// ============================================================================
+//  File        : SoundNormalizerTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-21
+//  Description : Unit tests for the Chaos Theory SoundNormalizer class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "SoundNormalizer.h"
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+constexpr double PI = 3.14159265358979323846;
+
+/// @brief A sine tone, written to every channel of each frame.
+std::vector<std::int16_t> MakeTone(double frequency, unsigned int rate, std::size_t frames, unsigned int channels,
+                                   double amplitude = 16000.0)
+{
+    std::vector<std::int16_t> samples(frames * channels);
+
+    for (std::size_t i = 0; i < frames; ++i)
+    {
+        const auto value = static_cast<std::int16_t>(amplitude * std::sin(2.0 * PI * frequency * i / rate));
+
+        for (unsigned int c = 0; c < channels; ++c)
+        {
+            samples[i * channels + c] = value;
+        }
+    }
+
+    return samples;
+}
+
+/// @brief Largest absolute sample in [first, last).
+int Peak(const std::vector<std::int16_t> &samples, std::size_t first, std::size_t last)
+{
+    int peak = 0;
+
+    for (std::size_t i = first; i < last; ++i)
+    {
+        peak = std::max(peak, std::abs(static_cast<int>(samples[i])));
+    }
+
+    return peak;
+}
+} // namespace
+
+TEST(SoundNormalizerTest, ResampledLengthKeepsTheDuration)
+{
+    EXPECT_EQ(SoundNormalizer::GetResampledFrames(48000, 48000, 44100), 44100u);
+    EXPECT_EQ(SoundNormalizer::GetResampledFrames(169363, 48000, 44100), 155603u);
+    EXPECT_EQ(SoundNormalizer::GetResampledFrames(16000, 16000, 44100), 44100u);
+    EXPECT_EQ(SoundNormalizer::GetResampledFrames(100, 0, 44100), 0u);
+}
+
+TEST(SoundNormalizerTest, ResampledToneMatchesTheIdealTone)
+{
+    const auto tone = MakeTone(1000.0, 48000, 4800, 1);
+    const auto resampled = SoundNormalizer::Resample(tone.data(), 4800, 1, 48000, 44100);
+    const auto ideal = MakeTone(1000.0, 44100, 4410, 1);
+
+    ASSERT_EQ(resampled.size(), 4410u);
+
+    // Away from the edges, where the filter runs out of input, the tone is reproduced to well under 0.1 %.
+    for (std::size_t i = 100; i < 4310; ++i)
+    {
+        EXPECT_NEAR(resampled[i], ideal[i], 16) << "frame " << i;
+    }
+}
+
+TEST(SoundNormalizerTest, UpsamplingKeepsChannelsApart)
+{
+    std::vector<std::int16_t> stereo(1600 * 2);
+
+    for (std::size_t i = 0; i < 1600; ++i)
+    {
+        stereo[i * 2] = 8000;
+        stereo[i * 2 + 1] = -8000;
+    }
+
+    const auto resampled = SoundNormalizer::Resample(stereo.data(), 1600, 2, 16000, 44100);
+
+    ASSERT_EQ(resampled.size(), 4410u * 2);
+
+    for (std::size_t i = 200; i < 4200; ++i)
+    {
+        EXPECT_NEAR(resampled[i * 2], 8000, 8);
+        EXPECT_NEAR(resampled[i * 2 + 1], -8000, 8);
+    }
+}
+
+TEST(SoundNormalizerTest, DownsamplingFiltersOutWhatTheNewRateCannotHold)
+{
+    // 20 kHz is above the 8 kHz Nyquist frequency of 16 kHz; without filtering it would alias to a loud 4 kHz tone.
+    const auto tone = MakeTone(20000.0, 48000, 4800, 1);
+    const auto resampled = SoundNormalizer::Resample(tone.data(), 4800, 1, 48000, 16000);
+
+    ASSERT_EQ(resampled.size(), 1600u);
+    EXPECT_LT(Peak(resampled, 100, 1500), 160);
+}
+
+TEST(SoundNormalizerTest, IdenticalChannelsAreDetectedAsMono)
+{
+    auto stereo = MakeTone(440.0, 44100, 441, 2);
+    EXPECT_TRUE(SoundNormalizer::IsEffectivelyMono(stereo.data(), 441));
+
+    // Tiny differences, such as from lossy encoding, still count as mono.
+    stereo[11] = static_cast<std::int16_t>(stereo[11] + 10);
+    EXPECT_TRUE(SoundNormalizer::IsEffectivelyMono(stereo.data(), 441));
+
+    stereo[21] = static_cast<std::int16_t>(stereo[21] + 500);
+    EXPECT_FALSE(SoundNormalizer::IsEffectivelyMono(stereo.data(), 441));
+}
+
+TEST(SoundNormalizerTest, DownmixAveragesTheChannels)
+{
+    const std::vector<std::int16_t> stereo = {100, 110, -32768, -32768, 32767, 32767};
+    const auto mono = SoundNormalizer::DownmixToMono(stereo.data(), 3);
+
+    ASSERT_EQ(mono.size(), 3u);
+    EXPECT_EQ(mono[0], 105);
+    EXPECT_EQ(mono[1], -32768);
+    EXPECT_EQ(mono[2], 32767);
+}
+
+TEST(SoundNormalizerTest, NormalizeConvertsOnlyWhatIsNeeded)
+{
+    std::vector<std::int16_t> normalized;
+    unsigned int channels = 0;
+
+    // Already mono at the target rate.
+    const auto mono = MakeTone(440.0, 44100, 441, 1);
+    EXPECT_FALSE(SoundNormalizer::Normalize(mono.data(), mono.size(), 1, 44100, 44100, normalized, channels));
+    EXPECT_TRUE(normalized.empty());
+
+    // Dual mono at the target rate: only down mixed.
+    const auto dualMono = MakeTone(440.0, 44100, 441, 2);
+    ASSERT_TRUE(SoundNormalizer::Normalize(dualMono.data(), dualMono.size(), 2, 44100, 44100, normalized, channels));
+    EXPECT_EQ(channels, 1u);
+    EXPECT_EQ(normalized, mono);
+
+    // Real stereo at another rate: only resampled.
+    auto stereo = MakeTone(440.0, 48000, 480, 2);
+    stereo[1] = 0;
+    stereo[3] = 20000;
+    ASSERT_TRUE(SoundNormalizer::Normalize(stereo.data(), stereo.size(), 2, 48000, 44100, normalized, channels));
+    EXPECT_EQ(channels, 2u);
+    EXPECT_EQ(normalized.size(), 441u * 2);
+
+    // A rate of 0 keeps the rate.
+    EXPECT_FALSE(SoundNormalizer::Normalize(stereo.data(), stereo.size(), 2, 48000, 0, normalized, channels));
+}
@@ -0,0 +1,117 @@
+// ============================================================================
+//  File        : SpatialAudioTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-17
+//  Description : Unit tests for the Chaos Theory SpatialBatch class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "SpatialAudio.h"
+#include <gtest/gtest.h>
+
+TEST(SpatialAudioTest, LinearFalloffBetweenMinAndMaxDistance)
+{
+    SpatialBatch batch;
+    SpatialListener listener;
+    const SfxAttenuation attenuation{AttenuationModel::Linear, 100.f, 500.f};
+
+    batch.Add({50.f, 0.f}, attenuation);
+    batch.Add({300.f, 0.f}, attenuation);
+    batch.Add({0.f, 500.f}, attenuation);
+    batch.Compute(listener);
+
+    EXPECT_FLOAT_EQ(batch.GetGain(0), 1.f);
+    EXPECT_FLOAT_EQ(batch.GetGain(1), 0.5f);
+    EXPECT_FLOAT_EQ(batch.GetGain(2), 0.f);
+    EXPECT_FALSE(batch.IsAudible(2));
+}
+
+TEST(SpatialAudioTest, InverseAndNoneModels)
+{
+    SpatialBatch batch;
+    SpatialListener listener;
+
+    batch.Add({400.f, 0.f}, {AttenuationModel::Inverse, 100.f, 1000.f});
+    batch.Add({400.f, 0.f}, {AttenuationModel::None, 100.f, 1000.f});
+    batch.Compute(listener);
+
+    EXPECT_FLOAT_EQ(batch.GetGain(0), 0.25f);
+    EXPECT_FLOAT_EQ(batch.GetGain(1), 1.f);
+}
+
+TEST(SpatialAudioTest, OffScreenEmittersAreCulled)
+{
+    SpatialBatch batch;
+    SpatialListener listener;
+    listener.position = {1000.f, 1000.f};
+    const SfxAttenuation loud{AttenuationModel::None, 100.f, 100.f};
+
+    batch.Add({1000.f + listener.halfExtents.x + listener.margin + 1.f, 1000.f}, loud);
+    batch.Add({1000.f, 1000.f - listener.halfExtents.y}, loud);
+    batch.Compute(listener);
+
+    EXPECT_FALSE(batch.IsAudible(0));
+    EXPECT_TRUE(batch.IsAudible(1));
+}
+
+TEST(SpatialAudioTest, PanFollowsHorizontalOffset)
+{
+    SpatialBatch batch;
+    SpatialListener listener;
+
+    batch.Add({-listener.halfExtents.x, 0.f}, {});
+    batch.Add({0.f, 100.f}, {});
+    batch.Add({listener.halfExtents.x / 2.f, 0.f}, {});
+    batch.Add({listener.halfExtents.x * 1.05f, 0.f}, {});
+    batch.Compute(listener);
+
+    EXPECT_FLOAT_EQ(batch.GetPan(0), -1.f);
+    EXPECT_FLOAT_EQ(batch.GetPan(1), 0.f);
+    EXPECT_FLOAT_EQ(batch.GetPan(2), 0.5f);
+    EXPECT_FLOAT_EQ(batch.GetPan(3), 1.f);
+}
+
+TEST(SpatialAudioTest, BatchMatchesScalar)
+{
+    SpatialBatch simd;
+    SpatialBatch scalar;
+    SpatialListener listener;
+    listener.position = {37.f, -12.f};
+
+    // Odd count so the SIMD tail is exercised; every model, near and far, on and off screen.
+    for (int i = 0; i < 23; ++i)
+    {
+        const sf::Vector2f position(static_cast<float>(i * 97 % 1700) - 850.f, static_cast<float>(i * 53 % 900) - 450.f);
+        const SfxAttenuation attenuation{static_cast<AttenuationModel>(i % 3), 50.f + i * 10.f, 400.f + i * 40.f};
+
+        simd.Add(position, attenuation);
+        scalar.Add(position, attenuation);
+    }
+
+    simd.Compute(listener);
+    scalar.ComputeScalar(listener);
+
+    for (std::size_t i = 0; i < simd.GetCount(); ++i)
+    {
+        EXPECT_NEAR(simd.GetGain(i), scalar.GetGain(i), 1e-5f) << "emitter " << i;
+        EXPECT_NEAR(simd.GetPan(i), scalar.GetPan(i), 1e-5f) << "emitter " << i;
+    }
+}
+
+TEST(SpatialAudioTest, RemoveMovesTheLastEmitter)
+{
+    SpatialBatch batch;
+    SpatialListener listener;
+
+    batch.Add({0.f, 0.f}, {});
+    batch.Add({-listener.halfExtents.x, 0.f}, {});
+    batch.Add({listener.halfExtents.x, 0.f}, {});
+    batch.Remove(0);
+    batch.Compute(listener);
+
+    ASSERT_EQ(batch.GetCount(), 2u);
+    EXPECT_FLOAT_EQ(batch.GetPan(0), 1.f);
+    EXPECT_FLOAT_EQ(batch.GetPan(1), -1.f);
+}
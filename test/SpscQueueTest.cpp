@@ -0,0 +1,94 @@
+// ============================================================================
+//  File        : SpscQueueTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-16
+//  Description : Unit tests for the Chaos Theory SpscQueue class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "SpscQueue.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+
+TEST(SpscQueueTest, PopsInPushOrder)
+{
+    SpscQueue<int, 8> queue;
+    EXPECT_TRUE(queue.IsEmpty());
+
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(queue.Push(int(i)));
+    }
+
+    int value = -1;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(queue.Pop(value));
+        EXPECT_EQ(value, i);
+    }
+
+    EXPECT_FALSE(queue.Pop(value));
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(SpscQueueTest, FullQueueRejectsWithoutConsumingTheValue)
+{
+    SpscQueue<std::string, 4> queue;
+    EXPECT_EQ(queue.GetCapacity(), 3u);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(queue.Push(std::to_string(i)));
+    }
+
+    std::string extra = "kept";
+    EXPECT_FALSE(queue.Push(std::move(extra)));
+    EXPECT_EQ(extra, "kept");
+
+    std::string value;
+    ASSERT_TRUE(queue.Pop(value));
+    EXPECT_TRUE(queue.Push(std::move(extra)));
+}
+
+TEST(SpscQueueTest, TransfersEveryValueAcrossThreads)
+{
+    constexpr int COUNT = 100000;
+    SpscQueue<int, 64> queue;
+
+    std::thread producer(
+        [&queue]()
+        {
+            for (int i = 0; i < COUNT; ++i)
+            {
+                while (!queue.Push(int(i)))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+    long long sum = 0;
+    int expected = 0;
+    bool isOrdered = true;
+
+    while (expected < COUNT)
+    {
+        int value = 0;
+
+        if (queue.Pop(value))
+        {
+            isOrdered = isOrdered && value == expected;
+            sum += value;
+            ++expected;
+        }
+    }
+
+    producer.join();
+
+    EXPECT_TRUE(isOrdered);
+    EXPECT_EQ(sum, static_cast<long long>(COUNT) * (COUNT - 1) / 2);
+}
@@ -0,0 +1,154 @@
+// ============================================================================
+//  File        : StartupGraphTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-07
+//  Description : Unit tests for the Chaos Theory Startup Graph class
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "Macros.h"
+#include "StartupGraph.h"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+
+class StartupGraphTest : public ::testing::Test
+{
+  protected:
+    ThreadPool m_pool{2};
+    StartupGraph m_graph;
+
+    std::mutex m_mutex;
+    std::vector<std::string> m_order;
+
+    void SetUp() override
+    {
+        if (!LogManager::Instance().IsInitialized())
+        {
+            LogManager::Instance().Init();
+        }
+    }
+
+    StartupGraph::TaskFunc Step(const std::string &name, bool result = true)
+    {
+        return [this, name, result]()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_order.push_back(name);
+
+            return result;
+        };
+    }
+
+    std::ptrdiff_t PositionOf(const std::string &name)
+    {
+        return std::find(m_order.begin(), m_order.end(), name) - m_order.begin();
+    }
+};
+
+// =========================================================================
+// TEST CASES
+// =========================================================================
+
+TEST_F(StartupGraphTest, DependenciesRunFirst)
+{
+    m_graph.Add("Scene", StartupAffinity::MainThread, {"Window", "Audio"}, Step("Scene"));
+    m_graph.Add("Config", StartupAffinity::Worker, {}, Step("Config"));
+    m_graph.Add("Window", StartupAffinity::MainThread, {"Config"}, Step("Window"));
+    m_graph.Add("Audio", StartupAffinity::Worker, {"Config"}, Step("Audio"));
+
+    ASSERT_TRUE(m_graph.Run(m_pool));
+    ASSERT_EQ(m_order.size(), 4u);
+
+    EXPECT_LT(PositionOf("Config"), PositionOf("Window"));
+    EXPECT_LT(PositionOf("Config"), PositionOf("Audio"));
+    EXPECT_LT(PositionOf("Window"), PositionOf("Scene"));
+    EXPECT_LT(PositionOf("Audio"), PositionOf("Scene"));
+}
+
+TEST_F(StartupGraphTest, AffinityDecidesTheThread)
+{
+    const auto mainThread = std::this_thread::get_id();
+    std::thread::id mainTaskThread;
+    std::thread::id workerTaskThread;
+
+    m_graph.Add("Main", StartupAffinity::MainThread, {},
+                [&]()
+                {
+                    mainTaskThread = std::this_thread::get_id();
+                    return true;
+                });
+    m_graph.Add("Worker", StartupAffinity::Worker, {},
+                [&]()
+                {
+                    workerTaskThread = std::this_thread::get_id();
+                    return true;
+                });
+
+    ASSERT_TRUE(m_graph.Run(m_pool));
+
+    EXPECT_EQ(mainTaskThread, mainThread);
+    EXPECT_NE(workerTaskThread, mainThread);
+}
+
+TEST_F(StartupGraphTest, IndependentWorkerTasksOverlap)
+{
+    std::atomic<int> arrived = 0;
+
+    // Each task only succeeds if the other one is running at the same time.
+    const auto rendezvous = [&]()
+    {
+        ++arrived;
+
+        for (int i = 0; i < 200 && arrived < 2; ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+
+        return arrived == 2;
+    };
+
+    m_graph.Add("A", StartupAffinity::Worker, {}, rendezvous);
+    m_graph.Add("B", StartupAffinity::Worker, {}, rendezvous);
+
+    EXPECT_TRUE(m_graph.Run(m_pool));
+}
+
+TEST_F(StartupGraphTest, FailedTaskSkipsItsDependents)
+{
+    m_graph.Add("Config", StartupAffinity::Worker, {}, Step("Config", false));
+    m_graph.Add("Window", StartupAffinity::MainThread, {"Config"}, Step("Window"));
+    m_graph.Add("Scene", StartupAffinity::MainThread, {"Window"}, Step("Scene"));
+    m_graph.Add("Unrelated", StartupAffinity::MainThread, {}, Step("Unrelated"));
+
+    EXPECT_FALSE(m_graph.Run(m_pool));
+
+    EXPECT_EQ(m_order.size(), 2u);
+    EXPECT_TRUE(m_graph.GetTimings()[1].wasSkipped);
+    EXPECT_TRUE(m_graph.GetTimings()[2].wasSkipped);
+}
+
+TEST_F(StartupGraphTest, RejectsUnknownDependenciesAndCycles)
+{
+    StartupGraph unknown;
+    unknown.Add("Window", StartupAffinity::MainThread, {"Missing"}, Step("Window"));
+
+    EXPECT_FALSE(unknown.Run(m_pool));
+
+    StartupGraph cycle;
+    cycle.Add("A", StartupAffinity::Worker, {"B"}, Step("A"));
+    cycle.Add("B", StartupAffinity::Worker, {"A"}, Step("B"));
+
+    EXPECT_FALSE(cycle.Run(m_pool));
+    EXPECT_TRUE(m_order.empty());
+}
+
+TEST_F(StartupGraphTest, DuplicateNamesAreRejected)
+{
+    EXPECT_TRUE(m_graph.Add("Config", StartupAffinity::Worker, {}, Step("Config")));
+    EXPECT_FALSE(m_graph.Add("Config", StartupAffinity::Worker, {}, Step("Config")));
+}
@@ -0,0 +1,81 @@
+// ============================================================================
+//  File        : TextureDiskCacheTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-09
+//  Description : Unit tests for the Chaos Theory TextureDiskCache class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "TextureDiskCache.h"
+#include "TempDirectoryTest.h"
+#include <algorithm>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <vector>
+
+class TextureDiskCacheTest : public TempDirectoryTest
+{
+  protected:
+    TextureDiskCacheTest() : TempDirectoryTest("ct_texture_disk_cache_test")
+    {
+    }
+
+    void SetUp() override
+    {
+        TempDirectoryTest::SetUp();
+
+        m_source = m_root / "source.png";
+        WriteFile(m_source, "encoded image");
+
+        m_cache.SetDirectory((m_root / "cache").generic_string());
+
+        // 2 x 2 RGBA8, every byte distinct.
+        for (std::uint8_t i = 0; i < 16; ++i)
+        {
+            m_pixels.push_back(i);
+        }
+    }
+
+    bool StoreSource()
+    {
+        const std::size_t size = std::filesystem::file_size(m_source);
+
+        return m_cache.Store(m_source.generic_string(), 1234u, size, 2, 2, m_pixels.data());
+    }
+
+    TextureDiskCache m_cache;
+    std::filesystem::path m_source;
+    std::vector<std::uint8_t> m_pixels;
+};
+
+// =========================================================================
+// TEST CASES
+// =========================================================================
+
+TEST_F(TextureDiskCacheTest, StoredPixelsLoadBackMapped)
+{
+    ASSERT_TRUE(StoreSource());
+
+    CookedTexture cooked;
+    ASSERT_TRUE(m_cache.Load(m_source.generic_string(), cooked));
+
+    EXPECT_TRUE(cooked.IsValid());
+    EXPECT_EQ(cooked.width, 2u);
+    EXPECT_EQ(cooked.height, 2u);
+    EXPECT_EQ(cooked.contentHash, 1234u);
+    EXPECT_EQ(cooked.sourceSize, std::filesystem::file_size(m_source));
+    EXPECT_TRUE(std::equal(m_pixels.begin(), m_pixels.end(), cooked.pixels));
+}
+
+TEST_F(TextureDiskCacheTest, TruncatedPixelsAreRejected)
+{
+    ASSERT_TRUE(StoreSource());
+
+    const std::string entry = m_cache.EntryPath(m_source.generic_string());
+    std::filesystem::resize_file(entry, std::filesystem::file_size(entry) - 4);
+
+    CookedTexture cooked;
+    EXPECT_FALSE(m_cache.Load(m_source.generic_string(), cooked));
+}
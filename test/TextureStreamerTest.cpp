@@ -0,0 +1,112 @@
+// ============================================================================
+//  File        : TextureStreamerTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-10
+//  Description : Unit tests for the Chaos Theory TextureStreamer class
+//
+//  License     : N/A Open source
+// ============================================================================
+
+#include "TextureStreamer.h"
+#include "LogManager.h"
+#include <gtest/gtest.h>
+
+class TextureStreamerTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        if (!LogManager::Instance().IsInitialized())
+        {
+            LogManager::Instance().Init();
+        }
+
+        // 512 x 512 RGBA8 is exactly 1 MiB, the smallest image that streams.
+        m_source.image.create(512, 512, sf::Color::Red);
+        m_source.isDecoded = true;
+        m_source.image.setPixel(0, 511, sf::Color::Blue);
+
+        ASSERT_TRUE(m_texture.create(512, 512));
+    }
+
+    PrefetchedAsset m_source;
+    sf::Texture m_texture;
+    TextureStreamer m_streamer;
+};
+
+TEST_F(TextureStreamerTest, OnlyLargeImagesAreStreamed)
+{
+    EXPECT_TRUE(TextureStreamer::ShouldStream({512, 512}));
+    EXPECT_TRUE(TextureStreamer::ShouldStream({1920, 1080}));
+    EXPECT_FALSE(TextureStreamer::ShouldStream({256, 256}));
+    EXPECT_FALSE(TextureStreamer::ShouldStream({0, 0}));
+}
+
+TEST_F(TextureStreamerTest, EnqueuedTextureHasSmallProxyUntilComplete)
+{
+    m_streamer.Enqueue(m_texture, std::move(m_source));
+
+    ASSERT_TRUE(m_streamer.IsStreaming(&m_texture));
+    ASSERT_NE(m_streamer.GetProxy(&m_texture), nullptr);
+    EXPECT_EQ(m_streamer.GetProxy(&m_texture)->getSize(), sf::Vector2u(64, 64));
+
+    m_streamer.Flush();
+
+    EXPECT_FALSE(m_streamer.IsStreaming(&m_texture));
+    EXPECT_EQ(m_streamer.GetProxy(&m_texture), nullptr);
+    EXPECT_EQ(m_streamer.GetPendingCount(), 0u);
+}
+
+TEST_F(TextureStreamerTest, PumpUploadsAtLeastOneSlicePerCall)
+{
+    m_streamer.SetSliceRows(128);
+    m_streamer.Enqueue(m_texture, std::move(m_source));
+
+    // A zero budget still makes progress, one slice at a time.
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(m_streamer.Pump(0.f), 1u);
+        EXPECT_TRUE(m_streamer.IsStreaming(&m_texture));
+    }
+
+    EXPECT_EQ(m_streamer.Pump(0.f), 1u);
+    EXPECT_FALSE(m_streamer.IsStreaming(&m_texture));
+    EXPECT_EQ(m_streamer.Pump(0.f), 0u);
+}
+
+TEST_F(TextureStreamerTest, CompletedTextureHoldsEverySourceRow)
+{
+    m_streamer.Enqueue(m_texture, std::move(m_source));
+    m_streamer.Flush();
+
+    const sf::Image uploaded = m_texture.copyToImage();
+
+    EXPECT_EQ(uploaded.getPixel(0, 0), sf::Color::Red);
+    EXPECT_EQ(uploaded.getPixel(0, 511), sf::Color::Blue);
+}
+
+TEST_F(TextureStreamerTest, ProxySpriteCoversTheSameArea)
+{
+    m_streamer.Enqueue(m_texture, std::move(m_source));
+
+    sf::Sprite sprite(m_texture);
+    sprite.setPosition(10.f, 20.f);
+    sprite.setScale(0.5f, 0.5f);
+
+    sf::Sprite proxy;
+    ASSERT_TRUE(m_streamer.MakeProxySprite(sprite, proxy));
+
+    EXPECT_EQ(proxy.getGlobalBounds(), sprite.getGlobalBounds());
+
+    m_streamer.Clear();
+
+    EXPECT_FALSE(m_streamer.MakeProxySprite(sprite, proxy));
+}
+
+TEST_F(TextureStreamerTest, SliceRowsAreAtLeastOne)
+{
+    m_streamer.SetSliceRows(0);
+
+    EXPECT_EQ(m_streamer.GetSliceRows(), 1u);
+}
@@ -0,0 +1,57 @@
+// ============================================================================
+//  File        : ThreadPoolTest.cpp
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-07
+//  Description : Unit tests for the Chaos Theory Thread Pool class
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#include "ThreadPool.h"
+#include <atomic>
+#include <gtest/gtest.h>
+
+// =========================================================================
+// TEST CASES
+// =========================================================================
+
+TEST(ThreadPoolTest, AlwaysStartsAtLeastOneWorker)
+{
+    ThreadPool pool(0);
+
+    EXPECT_EQ(pool.GetThreadCount(), 1u);
+    EXPECT_GE(ThreadPool::DefaultThreadCount(), 1u);
+}
+
+TEST(ThreadPoolTest, WaitIdleRunsEverySubmittedJob)
+{
+    ThreadPool pool(4);
+    std::atomic<int> counter = 0;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        pool.Submit([&counter]() { ++counter; });
+    }
+
+    pool.WaitIdle();
+
+    EXPECT_EQ(counter, 100);
+}
+
+TEST(ThreadPoolTest, DestructorDrainsTheQueue)
+{
+    std::atomic<int> counter = 0;
+
+    {
+        ThreadPool pool(1);
+
+        for (int i = 0; i < 10; ++i)
+        {
+            pool.Submit([&counter]() { ++counter; });
+        }
+    }
+
+    EXPECT_EQ(counter, 10);
+}
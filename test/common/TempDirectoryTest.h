@@ -0,0 +1,55 @@
+// ============================================================================
+//  File        : TempDirectoryTest.h
+//  Project     : ChaosTheory (CT)
+//  Author      : Mario Migliacio
+//  Created     : 2025-06-24
+//  Description : Test fixture for tests that touch the disk: a logger and a
+//                scratch directory that starts empty and is removed after.
+//
+//  License     : N/A Open source
+//                Copyright (c) 2025 Mario Migliacio
+// ============================================================================
+
+#pragma once
+
+#include "LogManager.h"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+
+class TempDirectoryTest : public ::testing::Test
+{
+  protected:
+    /// @param name directory under the system temp path; unique per fixture so suites do not share files.
+    explicit TempDirectoryTest(const std::string &name) : m_root(std::filesystem::temp_directory_path() / name)
+    {
+    }
+
+    void SetUp() override
+    {
+        if (!LogManager::Instance().IsInitialized())
+        {
+            LogManager::Instance().Init();
+        }
+
+        std::error_code ec;
+        std::filesystem::remove_all(m_root, ec);
+        std::filesystem::create_directories(m_root);
+    }
+
+    void TearDown() override
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(m_root, ec);
+    }
+
+    /// @brief Creates or replaces a file with the given bytes.
+    void WriteFile(const std::filesystem::path &path, const std::string &contents) const
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << contents;
+    }
+
+    std::filesystem::path m_root;
+};